@@ -0,0 +1,14 @@
+find_path(LZ4_INCLUDE_DIR
+  NAMES lz4.h
+)
+
+find_library(LZ4_LIBRARY
+  NAMES lz4
+)
+
+set(LZ4_INCLUDE_DIRS ${LZ4_INCLUDE_DIR})
+set(LZ4_LIBRARIES ${LZ4_LIBRARY})
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(LZ4 DEFAULT_MSG LZ4_LIBRARY LZ4_INCLUDE_DIR)
@@ -0,0 +1,213 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include "MediaListSnapshot.h"
+#include "WebApi.h"
+#include "Util/util.h"
+#include "Common/config.h"
+#include "Util/NoticeCenter.h"
+#include "Thread/WorkThreadPool.h"
+
+using namespace std;
+using namespace toolkit;
+using namespace mediakit;
+
+// 注销记录保留时长，单位毫秒，超过该时长未查询的客户端需重新全量获取
+// Retention time of unregistered records, in milliseconds, clients not querying within it need to fetch all again
+static constexpr uint64_t kRemovedKeepMS = 300 * 1000;
+// 观看人数变化后延后重建流信息的时长，单位毫秒，期间的多次变化只重建一次
+// Delay of rebuilding the stream information after the reader count changes, in milliseconds,
+// multiple changes during it are rebuilt only once
+static constexpr uint64_t kReaderChangedDelayMS = 1000;
+
+static string getKey(const MediaSource &sender) {
+    auto &tuple = sender.getMediaTuple();
+    return sender.getSchema() + "/" + tuple.vhost + "/" + tuple.app + "/" + tuple.stream;
+}
+
+static shared_ptr<MediaListSnapshot::Item> makeItem(const MediaSource &sender) {
+    auto item = std::make_shared<MediaListSnapshot::Item>();
+    auto &tuple = sender.getMediaTuple();
+    item->schema = sender.getSchema();
+    item->vhost = tuple.vhost;
+    item->app = tuple.app;
+    item->stream = tuple.stream;
+    item->stamp_ms = getCurrentMillisecond();
+    return item;
+}
+
+MediaListSnapshot &MediaListSnapshot::Instance() {
+    static MediaListSnapshot s_instance;
+    return s_instance;
+}
+
+void MediaListSnapshot::start() {
+    GET_CONFIG(bool, enable, API::kMediaListSnapshot);
+    if (!enable) {
+        return;
+    }
+    _enabled = true;
+    NoticeCenter::Instance().addListener(this, Broadcast::kBroadcastMediaChanged, [this](BroadcastMediaChangedArgs) {
+        if (!bRegist) {
+            remove(sender);
+            return;
+        }
+        // 注册可能发生在其他线程，切换到流所在线程生成流信息
+        // Registration may happen in other threads, switch to the thread of the stream to generate the stream information
+        weak_ptr<MediaSource> weak_src = sender.shared_from_this();
+        EventPoller::Ptr poller;
+        try {
+            poller = sender.getOwnerPoller();
+        } catch (std::exception &ex) {
+            WarnL << ex.what();
+            return;
+        }
+        poller->async([this, weak_src]() {
+            if (auto src = weak_src.lock()) {
+                update(*src);
+            }
+        }, false);
+    });
+    NoticeCenter::Instance().addListener(this, Broadcast::kBroadcastReaderChanged, [this](BroadcastReaderChangedArgs) {
+        // 该事件在流所在线程触发，观看者频繁进出时合并，避免每次都重建流信息
+        // The event is emitted in the thread of the stream, merged when readers join and leave frequently,
+        // to avoid rebuilding the stream information every time
+        auto key = getKey(sender);
+        weak_ptr<MediaSource> weak_src = sender.shared_from_this();
+        {
+            lock_guard<mutex> lck(_mtx);
+            auto &pending = _reader_pending[key];
+            if (pending.lock().get() == &sender) {
+                return;
+            }
+            pending = weak_src;
+        }
+        EventPoller::getCurrentPoller()->doDelayTask(kReaderChangedDelayMS, [this, weak_src, key]() {
+            {
+                lock_guard<mutex> lck(_mtx);
+                auto it = _reader_pending.find(key);
+                if (it != _reader_pending.end() && !it->second.owner_before(weak_src) && !weak_src.owner_before(it->second)) {
+                    _reader_pending.erase(it);
+                }
+            }
+            if (auto src = weak_src.lock()) {
+                update(*src);
+            }
+            return 0;
+        });
+    });
+}
+
+bool MediaListSnapshot::isEnabled() const {
+    return _enabled;
+}
+
+MediaListSnapshot::State::Ptr MediaListSnapshot::getState() const {
+    return std::atomic_load(&_state);
+}
+
+Json::Value MediaListSnapshot::makeJson(const Item &item) {
+    auto ret = *item.value;
+    ret["aliveSecond"] = (Json::UInt64)(ret["aliveSecond"].asUInt64() + (getCurrentMillisecond() - item.stamp_ms) / 1000);
+    ret["version"] = (Json::UInt64)item.version;
+    return ret;
+}
+
+static bool isRegistered(MediaSource &sender) {
+    auto &tuple = sender.getMediaTuple();
+    return MediaSource::find(sender.getSchema(), tuple.vhost, tuple.app, tuple.stream).get() == &sender;
+}
+
+void MediaListSnapshot::update(MediaSource &sender) {
+    if (!isRegistered(sender)) {
+        // 已经注销，忽略延后到达的事件
+        // Already unregistered, ignore the events arriving late
+        return;
+    }
+    auto item = makeItem(sender);
+    // 在流所在线程生成，但不获取丢包率，防止影响getMediaInfo接口的间隔丢包率
+    // Generated in the thread of the stream, but without the loss rate, to avoid affecting the interval loss rate of getMediaInfo
+    item->value = std::make_shared<Json::Value>(makeMediaSourceJson(sender, false));
+    auto key = getKey(sender);
+    lock_guard<mutex> lck(_mtx);
+    // 生成期间流可能已注销且remove已执行，在锁内再次确认，防止已注销的流被重新插入；
+    // 注销时先从全局表移除再触发remove，二者在此锁内互斥
+    // The stream may have been unregistered and remove executed during generation, check again within the lock
+    // to prevent the unregistered stream from being re-inserted; unregistration removes it from the global map
+    // before triggering remove, both are mutually exclusive within this lock
+    if (!isRegistered(sender)) {
+        return;
+    }
+    setItem_l(key, std::move(item));
+}
+
+void MediaListSnapshot::remove(MediaSource &sender) {
+    auto key = getKey(sender);
+    auto item = makeItem(sender);
+    lock_guard<mutex> lck(_mtx);
+    if (_items.find(key) == _items.end()) {
+        return;
+    }
+    setItem_l(key, std::move(item));
+}
+
+void MediaListSnapshot::setItem_l(const string &key, shared_ptr<Item> item) {
+    item->version = ++_version;
+    if (item->value) {
+        _removed.erase(key);
+        _items[key] = std::move(item);
+    } else {
+        _items.erase(key);
+        _removed[key] = std::move(item);
+    }
+    schedulePublish();
+}
+
+void MediaListSnapshot::schedulePublish() {
+    // 合并短时间内的多次变化，减少快照重建次数
+    // Merge multiple changes in a short time to reduce the times of rebuilding the snapshot
+    if (_publish_pending) {
+        return;
+    }
+    _publish_pending = true;
+    WorkThreadPool::Instance().getPoller()->doDelayTask(100, [this]() {
+        publish();
+        return 0;
+    });
+}
+
+void MediaListSnapshot::publish() {
+    auto state = std::make_shared<State>();
+    auto now = getCurrentMillisecond();
+    {
+        lock_guard<mutex> lck(_mtx);
+        _publish_pending = false;
+        for (auto it = _removed.begin(); it != _removed.end();) {
+            if (now - it->second->stamp_ms > kRemovedKeepMS) {
+                _min_delta_version = MAX(_min_delta_version, it->second->version);
+                it = _removed.erase(it);
+            } else {
+                state->removed.emplace_back(it->second);
+                ++it;
+            }
+        }
+        state->items.reserve(_items.size());
+        for (auto &pr : _items) {
+            state->items.emplace_back(pr.second);
+        }
+        state->version = _version;
+        state->min_delta_version = _min_delta_version;
+    }
+    auto cmp = [](const Item::Ptr &a, const Item::Ptr &b) { return a->version < b->version; };
+    sort(state->items.begin(), state->items.end(), cmp);
+    sort(state->removed.begin(), state->removed.end(), cmp);
+    std::atomic_store(&_state, State::Ptr(std::move(state)));
+}
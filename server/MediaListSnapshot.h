@@ -0,0 +1,110 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_MEDIALISTSNAPSHOT_H
+#define ZLMEDIAKIT_MEDIALISTSNAPSHOT_H
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include "json/json.h"
+#include "Common/MediaSource.h"
+
+/**
+ * 流列表快照，在流注册、注销与观看人数变化时增量更新，读取时无锁
+ * 每次变化分配递增的版本号，支持查询某版本之后的变化
+ * Snapshot of the stream list, updated incrementally when a stream is registered, unregistered or its reader count changes,
+ * lock free when read. Each change is assigned an increasing version, changes after a version can be queried
+ */
+class MediaListSnapshot {
+public:
+    struct Item {
+        using Ptr = std::shared_ptr<const Item>;
+        std::string schema;
+        std::string vhost;
+        std::string app;
+        std::string stream;
+        uint64_t version = 0;
+        // 生成时的单调时间，用于修正存活时间
+        // Monotonic time when generated, used to correct the alive time
+        uint64_t stamp_ms = 0;
+        // 为nullptr时代表该流已注销
+        // nullptr means the stream has been unregistered
+        std::shared_ptr<const Json::Value> value;
+    };
+
+    struct State {
+        using Ptr = std::shared_ptr<const State>;
+        uint64_t version = 0;
+        // 早于该版本的注销记录已被清理，无法从更早的版本增量查询
+        // Unregistered records earlier than this version have been purged, delta query from an earlier version is impossible
+        uint64_t min_delta_version = 0;
+        // 在线的流与注销记录，都按版本号升序排列
+        // Online streams and unregistered records, both sorted by version in ascending order
+        std::vector<Item::Ptr> items;
+        std::vector<Item::Ptr> removed;
+    };
+
+    static MediaListSnapshot &Instance();
+
+    /**
+     * 按配置监听流变化事件并开始维护快照，只能调用一次
+     * Listen to the stream change events and start maintaining the snapshot according to the configuration,
+     * it can only be called once
+     */
+    void start();
+
+    /**
+     * 是否已开启快照，未开启时快照始终为空
+     * Whether the snapshot is enabled, the snapshot is always empty when disabled
+     */
+    bool isEnabled() const;
+
+    /**
+     * 获取最新发布的快照，无锁
+     * Get the latest published snapshot, lock free
+     */
+    State::Ptr getState() const;
+
+    /**
+     * 生成json格式的流信息，存活时间修正为当前值
+     * Generate the stream information in json format, the alive time is corrected to the current value
+     */
+    static Json::Value makeJson(const Item &item);
+
+private:
+    MediaListSnapshot() = default;
+    void update(mediakit::MediaSource &sender);
+    void remove(mediakit::MediaSource &sender);
+    // 调用方需持有_mtx
+    // The caller must hold _mtx
+    void setItem_l(const std::string &key, std::shared_ptr<Item> item);
+    void schedulePublish();
+    void publish();
+
+private:
+    bool _enabled = false;
+    std::mutex _mtx;
+    uint64_t _version = 0;
+    bool _publish_pending = false;
+    // 写入方维护的最新状态，受_mtx保护，key为schema/vhost/app/stream
+    // The latest state maintained by the writer, protected by _mtx, the key is schema/vhost/app/stream
+    std::map<std::string, Item::Ptr> _items;
+    std::map<std::string, Item::Ptr> _removed;
+    uint64_t _min_delta_version = 0;
+    // 观看人数变化后等待重建流信息的流
+    // Streams waiting for rebuilding the stream information after the reader count changes
+    std::map<std::string, std::weak_ptr<mediakit::MediaSource>> _reader_pending;
+    State::Ptr _state = std::make_shared<State>();
+};
+
+#endif // ZLMEDIAKIT_MEDIALISTSNAPSHOT_H
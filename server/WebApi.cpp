@@ -8,6 +8,7 @@
  * may be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <algorithm>
 #include <exception>
 #include <sys/stat.h>
 #include <math.h>
@@ -42,12 +43,17 @@
 
 #include "Common/config.h"
 #include "Common/MediaSource.h"
+#include "Common/PollerMonitor.h"
+#include "Common/AllocProfiler.h"
+#include "MediaListSnapshot.h"
+#include "Common/SlowReaderGuard.h"
 #include "Http/HttpSession.h"
 #include "Http/HttpRequester.h"
 #include "Player/PlayerProxy.h"
 #include "Pusher/PusherProxy.h"
 #include "Rtp/RtpProcess.h"
 #include "Record/MP4Reader.h"
+#include "Record/MP4Index.h"
 
 #if defined(ENABLE_RTPPROXY)
 #include "Rtp/RtpServer.h"
@@ -79,6 +85,7 @@ const string kSecret = API_FIELD"secret";
 const string kSnapRoot = API_FIELD"snapRoot";
 const string kDefaultSnap = API_FIELD"defaultSnap";
 const string kDownloadRoot = API_FIELD"downloadRoot";
+const string kMediaListSnapshot = API_FIELD"mediaListSnapshot";
 
 static onceToken token([]() {
     mINI::Instance()[kApiDebug] = "1";
@@ -86,6 +93,7 @@ static onceToken token([]() {
     mINI::Instance()[kSnapRoot] = "./www/snap/";
     mINI::Instance()[kDefaultSnap] = "./www/logo.png";
     mINI::Instance()[kDownloadRoot] = "./www";
+    mINI::Instance()[kMediaListSnapshot] = "0";
 });
 }//namespace API
 
@@ -294,6 +302,7 @@ static inline void addHttpListener(){
             ((HttpSession::HttpResponseInvoker &) invoker) = newInvoker;
         }
 
+        PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginApi, parser.url());
         try {
             it->second(parser, invoker, sender);
         } catch (ApiRetException &ex) {
@@ -441,7 +450,7 @@ Value ToJson(const PlayerProxy::Ptr& p) {
     return item;
 }
 
-Value makeMediaSourceJson(MediaSource &media){
+Value makeMediaSourceJson(MediaSource &media, bool with_loss){
     Value item;
     item["schema"] = media.getSchema();
     dumpMediaTuple(media.getMediaTuple(), item);
@@ -455,6 +464,17 @@ Value makeMediaSourceJson(MediaSource &media){
     item["originUrl"] = media.getOriginUrl();
     item["isRecordingMP4"] = media.isRecording(Recorder::type_mp4);
     item["isRecordingHLS"] = media.isRecording(Recorder::type_hls);
+    // 缓存占用的内存字节数，streamMemoryBytes为该流所有协议与复用器缓存的总和
+    // Memory bytes used by the caches, streamMemoryBytes is the sum of the caches of all protocols and the muxer of the stream
+    auto &metrics = media.getMetrics();
+    item["gopCacheBytes"] = (Json::Int64)metrics->get(StreamMetrics::kGopCacheBytes);
+    item["streamMemoryBytes"] = (Json::Int64)metrics->getStreamMemory();
+    if (auto muxer = media.getMuxer()) {
+        auto &muxer_metrics = muxer->getMetrics();
+        item["muxerGopCacheBytes"] = (Json::Int64)muxer_metrics->get(StreamMetrics::kGopCacheBytes);
+        item["unreadyCacheBytes"] = (Json::Int64)muxer_metrics->get(StreamMetrics::kUnreadyBytes);
+        item["pacedCacheBytes"] = (Json::Int64)muxer_metrics->get(StreamMetrics::kPacedBytes);
+    }
     auto originSock = media.getOriginSock();
     if (originSock) {
         fillSockInfo(item["originSock"], originSock.get());
@@ -465,7 +485,7 @@ Value makeMediaSourceJson(MediaSource &media){
     // getLossRate有线程安全问题；使用getMediaInfo接口才能获取丢包率；getMediaList接口将忽略丢包率  [AUTO-TRANSLATED:b2e927c6]
     // getLossRate has thread safety issues; use the getMediaInfo interface to get the packet loss rate; the getMediaList interface will ignore the packet loss rate
     auto current_thread = false;
-    try { current_thread = media.getOwnerPoller()->isCurrentThread();} catch (...) {}
+    try { current_thread = with_loss && media.getOwnerPoller()->isCurrentThread();} catch (...) {}
     float last_loss = -1;
     for(auto &track : media.getTracks(false)){
         Value obj;
@@ -752,6 +772,7 @@ void addStreamPusherProxy(const string &schema,
  */
 void installWebApi() {
     addHttpListener();
+    MediaListSnapshot::Instance().start();
     GET_CONFIG(string,api_secret,API::kSecret);
 
     // 获取线程负载  [AUTO-TRANSLATED:3b0ece5c]
@@ -796,6 +817,75 @@ void installWebApi() {
         });
     });
 
+    // 获取各线程监控数据，需开启general.poller_monitor_ms
+    // Get the monitoring data of each thread, general.poller_monitor_ms needs to be enabled
+    // 测试url http://127.0.0.1/index/api/getThreadsStatistic
+    // Test url http://127.0.0.1/index/api/getThreadsStatistic
+    api_regist("/index/api/getThreadsStatistic", [](API_ARGS_MAP) {
+        CHECK_SECRET();
+        auto dump_histogram = [](const LatencyHistogram &histogram) {
+            uint64_t buckets[LatencyHistogram::kBuckets];
+            histogram.snapshot(buckets);
+            Value obj(objectValue);
+            Json::UInt64 count = 0;
+            for (auto value : buckets) {
+                count += value;
+            }
+            obj["count"] = count;
+            obj["p50"] = LatencyHistogram::quantile(buckets, 0.5) / 1000.0;
+            obj["p99"] = LatencyHistogram::quantile(buckets, 0.99) / 1000.0;
+            obj["p999"] = LatencyHistogram::quantile(buckets, 0.999) / 1000.0;
+            return obj;
+        };
+        val["data"] = Value(arrayValue);
+        for (auto &stats : PollerMonitor::Instance().getStats()) {
+            Value obj(objectValue);
+            obj["threadName"] = stats->name;
+            obj["queueDelay"] = dump_histogram(stats->queue_delay);
+            obj["timerLateness"] = dump_histogram(stats->timer_lateness);
+            for (int i = 0; i < PollerMonitor::kOriginMax; ++i) {
+                obj["taskCost"][PollerMonitor::getOriginName((PollerMonitor::Origin)i)] = dump_histogram(stats->task_cost[i]);
+            }
+            obj["slowTasks"] = Value(arrayValue);
+            for (auto &task : stats->getSlowTasks()) {
+                Value item(objectValue);
+                item["origin"] = PollerMonitor::getOriginName(task.origin);
+                item["label"] = task.label;
+                item["cost"] = task.cost_us / 1000.0;
+                item["stamp"] = (Json::UInt64)task.stamp;
+                obj["slowTasks"].append(item);
+            }
+            val["data"].append(obj);
+        }
+    });
+
+    // 获取各子系统内存分配采样统计，需开启general.alloc_sample_interval
+    // Get the sampled memory allocation statistics of each subsystem, general.alloc_sample_interval needs to be enabled
+    // 测试url http://127.0.0.1/index/api/getAllocStatistic
+    // Test url http://127.0.0.1/index/api/getAllocStatistic
+    api_regist("/index/api/getAllocStatistic", [](API_ARGS_MAP_ASYNC) {
+        CHECK_SECRET();
+        // 遍历存活的采样对象可能较慢，在后台线程执行
+        // Traversing the live sampled objects may be slow, execute it in the background thread
+        WorkThreadPool::Instance().getPoller()->async([headerOut, val, invoker]() mutable {
+            GET_CONFIG(uint32_t, interval, General::kAllocSampleInterval);
+            val["sampleInterval"] = interval;
+            val["data"] = Value(objectValue);
+            auto all = AllocProfiler::Instance().getStats();
+            for (int i = 0; i < AllocProfiler::kSubsystemMax; ++i) {
+                Value obj(objectValue);
+                obj["allocs"] = (Json::UInt64)all[i].allocs;
+                obj["bytes"] = (Json::UInt64)all[i].bytes;
+                obj["liveObjects"] = (Json::UInt64)all[i].live_objects;
+                obj["liveBytes"] = (Json::UInt64)all[i].live_bytes;
+                obj["allocsPerSec"] = (Json::UInt64)all[i].allocs_per_sec;
+                obj["bytesPerSec"] = (Json::UInt64)all[i].bytes_per_sec;
+                val["data"][AllocProfiler::getSubsystemName((AllocProfiler::Subsystem)i)] = obj;
+            }
+            invoker(200, headerOut, val.toStyledString());
+        });
+    });
+
     // 获取服务器配置  [AUTO-TRANSLATED:7dd2f3da]
     // Get server configuration
     // 测试url http://127.0.0.1/index/api/getServerConfig  [AUTO-TRANSLATED:59cd0d71]
@@ -966,8 +1056,56 @@ void installWebApi() {
     // Test url1 (get streams with virtual host "__defaultVost__") http://127.0.0.1/index/api/getMediaList?vhost=__defaultVost__
     // 测试url2(获取rtsp类型的流) http://127.0.0.1/index/api/getMediaList?schema=rtsp  [AUTO-TRANSLATED:21c2c15d]
     // Test url2 (get rtsp type streams) http://127.0.0.1/index/api/getMediaList?schema=rtsp
+    // 测试url3(从快照获取版本号5之后变化的流) http://127.0.0.1/index/api/getMediaList?version=5
+    // Test url3 (get the streams changed after version 5 from the snapshot) http://127.0.0.1/index/api/getMediaList?version=5
     api_regist("/index/api/getMediaList",[](API_ARGS_MAP){
         CHECK_SECRET();
+        if (!allArgs["version"].empty()) {
+            if (!MediaListSnapshot::Instance().isEnabled()) {
+                throw ApiRetException("media list snapshot is disabled, set api.mediaListSnapshot=1 and restart", API::OtherFailed);
+            }
+            // 从快照读取，不加全局锁也不切换到流所在线程；bytesSpeed等为流最近一次变化时的值，且不含丢包率
+            // Read from the snapshot without the global lock or switching to the thread of the stream;
+            // bytesSpeed and so on are the values at the last change of the stream, and the loss rate is not included
+            auto state = MediaListSnapshot::Instance().getState();
+            uint64_t since = allArgs["version"];
+            string schema = allArgs["schema"], vhost = allArgs["vhost"], app = allArgs["app"], stream = allArgs["stream"];
+            auto match = [&](const MediaListSnapshot::Item &item) {
+                return (schema.empty() || schema == item.schema) && (vhost.empty() || vhost == item.vhost) && (app.empty() || app == item.app)
+                    && (stream.empty() || stream == item.stream);
+            };
+            auto cmp = [](uint64_t version, const MediaListSnapshot::Item::Ptr &item) { return version < item->version; };
+            // 版本号过旧时无法得知期间注销的流，返回全量
+            // When the version is too old, the streams unregistered during it are unknown, so return all
+            auto full = since < state->min_delta_version;
+            if (full) {
+                since = 0;
+            }
+            val["version"] = (Json::UInt64)state->version;
+            val["full"] = full || !since;
+            val["data"] = Value(arrayValue);
+            val["removed"] = Value(arrayValue);
+            for (auto it = upper_bound(state->items.begin(), state->items.end(), since, cmp); it != state->items.end(); ++it) {
+                if (match(**it)) {
+                    val["data"].append(MediaListSnapshot::makeJson(**it));
+                }
+            }
+            if (!since) {
+                return;
+            }
+            for (auto it = upper_bound(state->removed.begin(), state->removed.end(), since, cmp); it != state->removed.end(); ++it) {
+                if (match(**it)) {
+                    Value obj;
+                    obj["schema"] = (*it)->schema;
+                    obj["vhost"] = (*it)->vhost;
+                    obj["app"] = (*it)->app;
+                    obj["stream"] = (*it)->stream;
+                    obj["version"] = (Json::UInt64)(*it)->version;
+                    val["removed"].append(obj);
+                }
+            }
+            return;
+        }
         // 获取所有MediaSource列表  [AUTO-TRANSLATED:7bf16dc2]
         // Get all MediaSource lists
         MediaSource::for_each_media([&](const MediaSource::Ptr &media) {
@@ -1010,6 +1148,12 @@ void installWebApi() {
                 auto &sock = info.get<SockInfo>();
                 fillSockInfo(*obj, &sock);
                 (*obj)["typeid"] = toolkit::demangle(typeid(sock).name());
+                if (auto guard = dynamic_cast<SlowReaderGuard *>(&sock)) {
+                    // 慢速播放器跳帧次数与丢弃的数据包个数
+                    // Skip times and dropped packets of the slow reader
+                    (*obj)["slowReaderSkips"] = (Json::UInt64)guard->getSkipCount();
+                    (*obj)["slowReaderDrops"] = (Json::UInt64)guard->getDropCount();
+                }
                 toolkit::Any ret;
                 ret.set(obj);
                 return ret;
@@ -1937,7 +2081,11 @@ void installWebApi() {
             if (pos != string::npos) {
                 string relative_path = path.substr(pos + 1);
                 if (search_mp4) {
+#ifdef ENABLE_MP4
+                    if (!isDir && !MP4Index::isIndexFile(relative_path)) {
+#else
                     if (!isDir) {
+#endif
                         // 我们只收集mp4文件，对文件夹不感兴趣  [AUTO-TRANSLATED:254d9f25]
                         // We only collect mp4 files, we are not interested in folders
                         paths.append(relative_path);
@@ -2070,6 +2218,18 @@ void installWebApi() {
         });
     });
 
+    // OpenMetrics格式的流统计数据，供prometheus抓取
+    // Stream statistics in OpenMetrics format, for prometheus scraping
+    api_regist("/metrics",[](API_ARGS_MAP_ASYNC){
+        CHECK_SECRET();
+        // 在后台线程生成文本，防止大量流时阻塞网络线程
+        // Generate the text in the background thread to prevent blocking the network thread when there are many streams
+        WorkThreadPool::Instance().getPoller()->async([headerOut, invoker]() mutable {
+            headerOut["Content-Type"] = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+            invoker(200, headerOut, MetricsRegistry::Instance().dump());
+        });
+    });
+
 #ifdef ENABLE_WEBRTC
     class WebRtcArgsImp : public WebRtcArgs {
     public:
@@ -2315,4 +2475,5 @@ void unInstallWebApi(){
 #endif
 
     NoticeCenter::Instance().delListener(&web_api_tag);
+    NoticeCenter::Instance().delListener(&MediaListSnapshot::Instance());
 }
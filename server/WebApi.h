@@ -49,6 +49,7 @@ typedef enum {
 } ApiErr;
 
 extern const std::string kSecret;
+extern const std::string kMediaListSnapshot;
 }//namespace API
 
 class ApiRetException: public std::runtime_error {
@@ -217,7 +218,7 @@ void unInstallWebApi();
 uint16_t openRtpServer(uint16_t local_port, const mediakit::MediaTuple &tuple, int tcp_mode, const std::string &local_ip, bool re_use_port, uint32_t ssrc, int only_track, bool multiplex=false);
 #endif
 
-Json::Value makeMediaSourceJson(mediakit::MediaSource &media);
+Json::Value makeMediaSourceJson(mediakit::MediaSource &media, bool with_loss = true);
 void getStatisticJson(const std::function<void(Json::Value &val)> &cb);
 void addStreamProxy(const mediakit::MediaTuple &tuple, const std::string &url, int retry_count,
                     const mediakit::ProtocolOption &option, int rtp_type, float timeout_sec, const toolkit::mINI &args,
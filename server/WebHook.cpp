@@ -14,6 +14,7 @@
 #include "Util/NoticeCenter.h"
 #include "Common/config.h"
 #include "Common/MediaSource.h"
+#include "Common/PollerMonitor.h"
 #include "Http/HttpSession.h"
 #include "Http/HttpRequester.h"
 #include "Network/Session.h"
@@ -52,6 +53,9 @@ const string kOnRtpServerTimeout = HOOK_FIELD "on_rtp_server_timeout";
 const string kAliveInterval = HOOK_FIELD "alive_interval";
 const string kRetry = HOOK_FIELD "retry";
 const string kRetryDelay = HOOK_FIELD "retry_delay";
+const string kBatchMS = HOOK_FIELD "batch_ms";
+const string kBatchSize = HOOK_FIELD "batch_size";
+const string kAuthCacheSec = HOOK_FIELD "auth_cache_sec";
 
 static onceToken token([]() {
     mINI::Instance()[kEnable] = false;
@@ -78,6 +82,9 @@ static onceToken token([]() {
     mINI::Instance()[kAliveInterval] = 30.0;
     mINI::Instance()[kRetry] = 1;
     mINI::Instance()[kRetryDelay] = 3.0;
+    mINI::Instance()[kBatchMS] = 0;
+    mINI::Instance()[kBatchSize] = 100;
+    mINI::Instance()[kAuthCacheSec] = 0;
     mINI::Instance()[kStreamChangedSchemas] = "rtsp/rtmp/fmp4/ts/hls/hls.fmp4";
 });
 } // namespace Hook
@@ -158,6 +165,9 @@ const char *getContentType(const HttpArgs &value) {
 }
 
 string getVhost(const Value &value) {
+    if (!value.isObject()) {
+        return "";
+    }
     const char *key = VHOST_KEY;
     auto val = value.find(key, key + sizeof(VHOST_KEY) - 1);
     return val ? val->asString() : "";
@@ -168,28 +178,75 @@ string getVhost(const HttpArgs &value) {
     return val != value.end() ? val->second : "";
 }
 
+bool isBatch(const Value &value) {
+    return value.isArray();
+}
+
+bool isBatch(const HttpArgs &value) {
+    return false;
+}
+
 static atomic<uint64_t> s_hook_index { 0 };
 
+// 每个hook地址最多保留的空闲连接数
+// Maximum idle connections kept for each hook url
+static constexpr size_t kMaxIdleRequester = 32;
+static mutex s_requester_mtx;
+static unordered_map<string, vector<HttpRequester::Ptr> > s_idle_requester;
+
+// 获取该地址的空闲HttpRequester，复用其keep-alive连接，避免每个事件都新建http连接
+// Get an idle HttpRequester of the url to reuse its keep-alive connection, avoiding creating a new http connection for every event
+static HttpRequester::Ptr obtainRequester(const string &url) {
+    {
+        lock_guard<mutex> lck(s_requester_mtx);
+        auto &idle = s_idle_requester[url];
+        if (!idle.empty()) {
+            auto ret = std::move(idle.back());
+            idle.pop_back();
+            return ret;
+        }
+    }
+    return std::make_shared<HttpRequester>();
+}
+
+static void recycleRequester(const string &url, HttpRequester::Ptr requester) {
+    // 在结果回调返回后再回收，此时HttpRequester已清空回调，可以开始下个请求
+    // Recycle after the result callback returns, HttpRequester has cleared the callback by then and can start the next request
+    auto poller = requester->getPoller();
+    poller->async([url, requester]() mutable {
+        lock_guard<mutex> lck(s_requester_mtx);
+        auto &idle = s_idle_requester[url];
+        if (idle.size() < kMaxIdleRequester) {
+            idle.emplace_back(std::move(requester));
+        }
+    }, false);
+}
+
 void do_http_hook(const string &url, const ArgsType &body, const function<void(const Value &, const string &)> &func, uint32_t retry) {
     GET_CONFIG(string, mediaServerId, General::kMediaServerId);
     GET_CONFIG(float, hook_timeoutSec, Hook::kTimeoutSec);
     GET_CONFIG(float, retry_delay, Hook::kRetryDelay);
 
-    const_cast<ArgsType &>(body)["mediaServerId"] = mediaServerId;
-    const_cast<ArgsType &>(body)["hook_index"] = (Json::UInt64)(s_hook_index++);
+    if (!isBatch(body)) {
+        // 批量事件在加入批次时已经各自添加
+        // Batched events already carry them, added when joining the batch
+        const_cast<ArgsType &>(body)["mediaServerId"] = mediaServerId;
+        const_cast<ArgsType &>(body)["hook_index"] = (Json::UInt64)(s_hook_index++);
+    }
 
-    auto requester = std::make_shared<HttpRequester>();
-    requester->setMethod("POST");
+    auto requester = obtainRequester(url);
     auto bodyStr = to_string(body);
-    requester->setBody(bodyStr);
-    requester->addHeader("Content-Type", getContentType(body));
+    auto content_type = getContentType(body);
     auto vhost = getVhost(body);
-    if (!vhost.empty()) {
-        requester->addHeader("X-VHOST", vhost);
-    }
     Ticker ticker;
-    requester->startRequester(url, [url, func, bodyStr, body, requester, ticker, retry](const SockException &ex, const Parser &res) mutable {
-        onceToken token(nullptr, [&]() mutable { requester.reset(); });
+    auto on_result = [url, func, bodyStr, body, requester, ticker, retry](const SockException &ex, const Parser &res) mutable {
+        PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginHook, url);
+        onceToken token(nullptr, [&]() mutable {
+            if (!ex) {
+                recycleRequester(url, std::move(requester));
+            }
+            requester.reset();
+        });
         parse_http_response(ex, res, [&](const Value &obj, const string &err, bool should_retry) {
             if (!err.empty()) {
                 // hook失败  [AUTO-TRANSLATED:68231f46]
@@ -216,7 +273,19 @@ void do_http_hook(const string &url, const ArgsType &body, const function<void(c
                 func(obj, err);
             }
         });
-    }, hook_timeoutSec);
+    };
+    // 复用的连接属于其他线程，切换到其所在线程发起请求
+    // The reused connection belongs to another thread, switch to its thread to start the request
+    requester->getPoller()->async([requester, url, bodyStr, content_type, vhost, on_result]() mutable {
+        requester->clear();
+        requester->setMethod("POST");
+        requester->setBody(std::move(bodyStr));
+        requester->addHeader("Content-Type", content_type);
+        if (!vhost.empty()) {
+            requester->addHeader("X-VHOST", vhost);
+        }
+        requester->startRequester(url, std::move(on_result), hook_timeoutSec);
+    });
 }
 
 void do_http_hook(const string &url, const ArgsType &body, const function<void(const Value &, const string &)> &func) {
@@ -224,6 +293,80 @@ void do_http_hook(const string &url, const ArgsType &body, const function<void(c
     do_http_hook(url, body, func, hook_retry);
 }
 
+// 各hook地址待批量上报的事件
+// Events waiting to be reported in batch of each hook url
+static mutex s_batch_mtx;
+static unordered_map<string, Value> s_batch;
+
+static void flush_hook_batch(const string &url) {
+    Value batch;
+    {
+        lock_guard<mutex> lck(s_batch_mtx);
+        auto it = s_batch.find(url);
+        if (it == s_batch.end()) {
+            return;
+        }
+        batch.swap(it->second);
+        s_batch.erase(it);
+    }
+    if (!batch.empty()) {
+        do_http_hook(url, batch, nullptr);
+    }
+}
+
+static void flush_all_hook_batch() {
+    vector<string> urls;
+    {
+        lock_guard<mutex> lck(s_batch_mtx);
+        for (auto &pr : s_batch) {
+            urls.emplace_back(pr.first);
+        }
+    }
+    for (auto &url : urls) {
+        flush_hook_batch(url);
+    }
+}
+
+/**
+ * 触发无需回复结果的hook事件，开启hook.batch_ms后同一地址的事件合并为json数组，按个数或时间批量上报
+ * Trigger a hook event whose result is not needed, after hook.batch_ms is enabled, the events of the same url are merged
+ * into a json array and reported in batch by count or time
+ */
+static void do_http_hook_batch(const string &url, const ArgsType &body) {
+#ifdef JSON_ARGS
+    GET_CONFIG(uint32_t, batch_ms, Hook::kBatchMS);
+    GET_CONFIG(uint32_t, batch_size, Hook::kBatchSize);
+    GET_CONFIG(string, mediaServerId, General::kMediaServerId);
+    if (batch_ms) {
+        auto event = body;
+        event["mediaServerId"] = mediaServerId;
+        event["hook_index"] = (Json::UInt64)(s_hook_index++);
+        Value batch;
+        bool start_timer = false;
+        {
+            lock_guard<mutex> lck(s_batch_mtx);
+            auto &pending = s_batch[url];
+            start_timer = pending.empty();
+            pending.append(event);
+            if (pending.size() >= MAX(batch_size, 1u)) {
+                batch.swap(pending);
+                start_timer = false;
+            }
+        }
+        if (!batch.empty()) {
+            do_http_hook(url, batch, nullptr);
+        } else if (start_timer) {
+            EventPollerPool::Instance().getPoller()->doDelayTask(batch_ms, [url]() {
+                flush_hook_batch(url);
+                return 0;
+            });
+        }
+        return;
+    }
+#endif
+    do_http_hook(url, body, nullptr);
+}
+
 void dumpMediaTuple(const MediaTuple &tuple, Json::Value& item);
 
 static ArgsType make_json(const MediaInfo &args) {
@@ -345,6 +488,59 @@ static mINI jsonToMini(const Value &obj) {
     return ret;
 }
 
+// 鉴权结果缓存的最大条数，超出后清理过期项，仍超出则清空
+// Maximum number of cached authentication results, expired items are cleaned up after exceeded, and all are cleared if still exceeded
+static constexpr size_t kMaxAuthCache = 100 * 1000;
+static mutex s_auth_cache_mtx;
+// key为hook地址与客户端的流信息、参数、ip，value为鉴权成功的回复与过期时间
+// The key is the hook url and the stream info, params and ip of the client, the value is the successful reply and the expiration time
+static unordered_map<string, pair<Value, uint64_t> > s_auth_cache;
+
+static string makeAuthCacheKey(const string &url, const ArgsType &body) {
+    string ret = url;
+    for (auto key : { "schema", VHOST_KEY, "app", "stream", "params", "ip" }) {
+        ret.push_back('\n');
+        ret.append(body[key].asString());
+    }
+    return ret;
+}
+
+static bool getAuthCache(const string &key, Value &result) {
+    GET_CONFIG(float, auth_cache_sec, Hook::kAuthCacheSec);
+    if (auth_cache_sec <= 0) {
+        return false;
+    }
+    lock_guard<mutex> lck(s_auth_cache_mtx);
+    auto it = s_auth_cache.find(key);
+    if (it == s_auth_cache.end()) {
+        return false;
+    }
+    if (it->second.second < getCurrentMillisecond()) {
+        s_auth_cache.erase(it);
+        return false;
+    }
+    result = it->second.first;
+    return true;
+}
+
+static void setAuthCache(const string &key, const Value &result) {
+    GET_CONFIG(float, auth_cache_sec, Hook::kAuthCacheSec);
+    if (auth_cache_sec <= 0) {
+        return;
+    }
+    auto now = getCurrentMillisecond();
+    lock_guard<mutex> lck(s_auth_cache_mtx);
+    if (s_auth_cache.size() >= kMaxAuthCache) {
+        for (auto it = s_auth_cache.begin(); it != s_auth_cache.end();) {
+            it = it->second.second < now ? s_auth_cache.erase(it) : std::next(it);
+        }
+        if (s_auth_cache.size() >= kMaxAuthCache) {
+            s_auth_cache.clear();
+        }
+    }
+    s_auth_cache[key] = std::make_pair(result, now + (uint64_t)(auth_cache_sec * 1000));
+}
+
 void installWebHook() {
     GET_CONFIG(bool, hook_enable, Hook::kEnable);
 
@@ -362,12 +558,21 @@ void installWebHook() {
         body["id"] = sender.getIdentifier();
         body["originType"] = (int)type;
         body["originTypeStr"] = getOriginTypeString(type);
+        // 同一客户端重复推流时使用缓存的鉴权结果
+        // Use the cached authentication result when the same client publishes repeatedly
+        auto cache_key = makeAuthCacheKey(hook_publish, body);
+        Value cached;
+        if (getAuthCache(cache_key, cached)) {
+            invoker("", ProtocolOption(jsonToMini(cached)));
+            return;
+        }
         // 执行hook  [AUTO-TRANSLATED:1df68201]
         // Execute hook
-        do_http_hook(hook_publish, body, [invoker](const Value &obj, const string &err) mutable {
+        do_http_hook(hook_publish, body, [invoker, cache_key](const Value &obj, const string &err) mutable {
             if (err.empty()) {
                 // 推流鉴权成功  [AUTO-TRANSLATED:e4285dab]
                 // Push stream authentication succeeded
+                setAuthCache(cache_key, obj);
                 invoker(err, ProtocolOption(jsonToMini(obj)));
             } else {
                 // 推流鉴权失败  [AUTO-TRANSLATED:780430e0]
@@ -387,9 +592,22 @@ void installWebHook() {
         body["ip"] = sender.get_peer_ip();
         body["port"] = sender.get_peer_port();
         body["id"] = sender.getIdentifier();
+        // 同一客户端重复播放时跳过鉴权请求
+        // Skip the authentication request when the same client plays repeatedly
+        auto cache_key = makeAuthCacheKey(hook_play, body);
+        Value cached;
+        if (getAuthCache(cache_key, cached)) {
+            invoker("");
+            return;
+        }
         // 执行hook  [AUTO-TRANSLATED:1df68201]
         // Execute hook
-        do_http_hook(hook_play, body, [invoker](const Value &obj, const string &err) { invoker(err); });
+        do_http_hook(hook_play, body, [invoker, cache_key](const Value &obj, const string &err) {
+            if (err.empty()) {
+                setAuthCache(cache_key, obj);
+            }
+            invoker(err);
+        });
     });
 
     NoticeCenter::Instance().addListener(&web_hook_tag, Broadcast::kBroadcastFlowReport, [](BroadcastFlowReportArgs) {
@@ -406,7 +624,7 @@ void installWebHook() {
         body["id"] = sender.getIdentifier();
         // 执行hook  [AUTO-TRANSLATED:1df68201]
         // Execute hook
-        do_http_hook(hook_flowreport, body, nullptr);
+        do_http_hook_batch(hook_flowreport, body);
     });
 
     static const string unAuthedRealm = "unAuthedRealm";
@@ -503,7 +721,7 @@ void installWebHook() {
         }
         // 执行hook  [AUTO-TRANSLATED:1df68201]
         // Execute hook
-        do_http_hook(hook_stream_changed, body, nullptr);
+        do_http_hook_batch(hook_stream_changed, body);
     });
 
     GET_CONFIG_FUNC(vector<string>, origin_urls, Cluster::kOriginUrl, [](const string &str) {
@@ -582,7 +800,7 @@ void installWebHook() {
         }
         // 执行hook  [AUTO-TRANSLATED:1df68201]
         // Execute hook
-        do_http_hook(hook_record_mp4, getRecordInfo(info), nullptr);
+        do_http_hook_batch(hook_record_mp4, getRecordInfo(info));
     });
 #endif // ENABLE_MP4
 
@@ -593,7 +811,7 @@ void installWebHook() {
         }
         // 执行 hook  [AUTO-TRANSLATED:d9d66f75]
         // Execute hook
-        do_http_hook(hook_record_ts, getRecordInfo(info), nullptr);
+        do_http_hook_batch(hook_record_ts, getRecordInfo(info));
     });
 
     NoticeCenter::Instance().addListener(&web_hook_tag, Broadcast::kBroadcastShellLogin, [](BroadcastShellLoginArgs) {
@@ -660,7 +878,7 @@ void installWebHook() {
         body["err"] = ex.getErrCode();
         // 执行hook  [AUTO-TRANSLATED:1df68201]
         // Execute hook
-        do_http_hook(hook_send_rtp_stopped, body, nullptr);
+        do_http_hook_batch(hook_send_rtp_stopped, body);
     });
 
     /**
@@ -751,7 +969,7 @@ void installWebHook() {
         body["tcp_mode"] = tcp_mode;
         body["re_use_port"] = re_use_port;
         body["ssrc"] = ssrc;
-        do_http_hook(rtp_server_timeout, body);
+        do_http_hook_batch(rtp_server_timeout, body);
     });
 
     // 汇报服务器重新启动  [AUTO-TRANSLATED:bd7d83df]
@@ -766,6 +984,7 @@ void installWebHook() {
 void unInstallWebHook() {
     g_keepalive_timer.reset();
     NoticeCenter::Instance().delListener(&web_hook_tag);
+    flush_all_hook_batch();
 }
 
 void onProcessExited() {
@@ -19,6 +19,8 @@
 #include "Network/UdpServer.h"
 #include "Poller/EventPoller.h"
 #include "Common/config.h"
+#include "Common/PollerMonitor.h"
+#include "Common/AllocProfiler.h"
 #include "Rtsp/RtspSession.h"
 #include "Rtmp/RtmpSession.h"
 #include "Shell/ShellSession.h"
@@ -395,6 +397,8 @@ int start_main(int argc,char *argv[]) {
 
         installWebApi();
         InfoL << "已启动http api 接口";
+        PollerMonitor::Instance().start();
+        AllocProfiler::Instance().start();
         installWebHook();
         InfoL << "已启动http hook 接口";
 
@@ -0,0 +1,196 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "AllocProfiler.h"
+#include "MediaMetrics.h"
+#include "Common/config.h"
+#include "Thread/WorkThreadPool.h"
+
+using namespace std;
+using namespace toolkit;
+
+namespace mediakit {
+
+// 本线程距离下次采样还需跳过的次数
+// Times to skip before the next sampling in this thread
+static thread_local uint32_t s_countdown = 0;
+
+// 返回本次分配的采样权重，为0时不采样
+// Return the sampling weight of this allocation, 0 means not sampled
+static uint32_t sampleWeight() {
+    GET_CONFIG(uint32_t, interval, General::kAllocSampleInterval);
+    if (!interval) {
+        return 0;
+    }
+    if (s_countdown) {
+        --s_countdown;
+        return 0;
+    }
+    s_countdown = interval - 1;
+    return interval;
+}
+
+const char *AllocProfiler::getSubsystemName(Subsystem type) {
+    switch (type) {
+        case kFrame: return "frame";
+        case kRtpPacket: return "rtp_packet";
+        case kRtmpPacket: return "rtmp_packet";
+        case kSplitterCache: return "splitter_cache";
+        case kTs: return "ts";
+        case kWebRtc: return "webrtc";
+        default: return "invalid";
+    }
+}
+
+AllocProfiler::Tracker::Tracker(Subsystem type, const void *owner, GetSize get_size) {
+    _weight = sampleWeight();
+    if (!_weight) {
+        return;
+    }
+    _type = type;
+    _owner = owner;
+    _get_size = get_size;
+    AllocProfiler::Instance().addTracker(this);
+}
+
+AllocProfiler::Tracker::~Tracker() {
+    if (_weight) {
+        AllocProfiler::Instance().removeTracker(this);
+    }
+}
+
+AllocProfiler &AllocProfiler::Instance() {
+    static AllocProfiler s_instance;
+    return s_instance;
+}
+
+void AllocProfiler::record(Subsystem type, size_t bytes) {
+    auto weight = sampleWeight();
+    if (!weight) {
+        return;
+    }
+    auto &counter = Instance()._counters[type];
+    counter.allocs.fetch_add(weight, memory_order_relaxed);
+    counter.bytes.fetch_add(bytes * weight, memory_order_relaxed);
+}
+
+void AllocProfiler::addTracker(Tracker *tracker) {
+    auto &counter = _counters[tracker->_type];
+    counter.allocs.fetch_add(tracker->_weight, memory_order_relaxed);
+    lock_guard<mutex> lck(counter.mtx);
+    counter.trackers.emplace(tracker);
+}
+
+void AllocProfiler::removeTracker(Tracker *tracker) {
+    auto &counter = _counters[tracker->_type];
+    // 对象已不再被修改，以最终大小作为其分配的字节数
+    // The object is no longer modified, its final size is taken as its allocated bytes
+    counter.bytes.fetch_add(tracker->_get_size(tracker->_owner) * tracker->_weight, memory_order_relaxed);
+    unique_lock<mutex> lck(counter.mtx);
+    counter.measured.wait(lck, [&]() { return counter.measuring != tracker; });
+    counter.trackers.erase(tracker);
+}
+
+vector<AllocProfiler::Stats> AllocProfiler::getStats() {
+    vector<Stats> ret(kSubsystemMax);
+    lock_guard<mutex> measure_lck(_measure_mtx);
+    for (int i = 0; i < kSubsystemMax; ++i) {
+        auto &counter = _counters[i];
+        auto &stats = ret[i];
+        vector<Tracker *> trackers;
+        {
+            lock_guard<mutex> lck(counter.mtx);
+            trackers.assign(counter.trackers.begin(), counter.trackers.end());
+        }
+        // 逐个在锁外测量，不阻塞对象的构造；对象析构时会等待其测量完成
+        // Measure one by one outside the lock without blocking the construction of objects;
+        // the destruction of an object waits for its measurement to complete
+        for (auto tracker : trackers) {
+            uint32_t weight;
+            {
+                lock_guard<mutex> lck(counter.mtx);
+                if (!counter.trackers.count(tracker)) {
+                    // 快照后已析构
+                    // Destructed after the snapshot
+                    continue;
+                }
+                counter.measuring = tracker;
+                weight = tracker->_weight;
+            }
+            // 存活对象可能正被其他线程修改，读取到的大小只是近似值
+            // Live objects may be being modified by other threads, the size read is only an approximation
+            auto size = tracker->_get_size(tracker->_owner);
+            {
+                lock_guard<mutex> lck(counter.mtx);
+                counter.measuring = nullptr;
+            }
+            counter.measured.notify_all();
+            stats.live_objects += weight;
+            stats.live_bytes += size * weight;
+        }
+        stats.allocs = counter.allocs.load(memory_order_relaxed);
+        stats.bytes = counter.bytes.load(memory_order_relaxed) + stats.live_bytes;
+    }
+    lock_guard<mutex> lck(_rate_mtx);
+    for (int i = 0; i < kSubsystemMax; ++i) {
+        ret[i].allocs_per_sec = _counters[i].allocs_per_sec;
+        ret[i].bytes_per_sec = _counters[i].bytes_per_sec;
+    }
+    return ret;
+}
+
+void AllocProfiler::updateRate() {
+    auto stats = getStats();
+    lock_guard<mutex> lck(_rate_mtx);
+    for (int i = 0; i < kSubsystemMax; ++i) {
+        auto &counter = _counters[i];
+        // 存活对象的大小可能缩小，累计字节数不保证单调
+        // The size of live objects may shrink, the accumulated bytes are not guaranteed to be monotonic
+        counter.allocs_per_sec = stats[i].allocs - counter.last_allocs;
+        counter.bytes_per_sec = stats[i].bytes > counter.last_bytes ? stats[i].bytes - counter.last_bytes : 0;
+        counter.last_allocs = stats[i].allocs;
+        counter.last_bytes = stats[i].bytes;
+    }
+}
+
+void AllocProfiler::start() {
+    GET_CONFIG(uint32_t, interval, General::kAllocSampleInterval);
+    if (!interval) {
+        return;
+    }
+    WorkThreadPool::Instance().getPoller()->doDelayTask(1000, [this]() {
+        updateRate();
+        return 1000;
+    });
+}
+
+void AllocProfiler::dump(string &out) {
+    GET_CONFIG(uint32_t, interval, General::kAllocSampleInterval);
+    if (!interval) {
+        return;
+    }
+    auto all = getStats();
+    auto label = [](int i) { return string("subsystem=\"") + getSubsystemName((Subsystem)i) + "\""; };
+
+    MetricsRegistry::appendHeader(out, "zlm_alloc", "counter", "Estimated allocations of each subsystem, sampled.");
+    for (int i = 0; i < kSubsystemMax; ++i) {
+        out.append("zlm_alloc_total{").append(label(i)).append("} ").append(to_string(all[i].allocs)).append("\n");
+    }
+    MetricsRegistry::appendHeader(out, "zlm_alloc_bytes", "counter", "Estimated allocated bytes of each subsystem, sampled.");
+    for (int i = 0; i < kSubsystemMax; ++i) {
+        out.append("zlm_alloc_bytes_total{").append(label(i)).append("} ").append(to_string(all[i].bytes)).append("\n");
+    }
+    MetricsRegistry::appendHeader(out, "zlm_alloc_live_bytes", "gauge", "Estimated live bytes of the tracked objects of each subsystem, sampled.");
+    for (int i = 0; i < kSubsystemMax; ++i) {
+        out.append("zlm_alloc_live_bytes{").append(label(i)).append("} ").append(to_string(all[i].live_bytes)).append("\n");
+    }
+}
+
+} // namespace mediakit
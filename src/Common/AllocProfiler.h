@@ -0,0 +1,144 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_ALLOCPROFILER_H
+#define ZLMEDIAKIT_ALLOCPROFILER_H
+
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_set>
+
+namespace mediakit {
+
+/**
+ * 采样式内存分配统计，按子系统统计分配字节数、存活字节数与分配速率
+ * 每隔N个对象(或N次分配)采样一个，结果乘以N作为估算值，未开启时每次分配只多一次配置读取
+ * Sampled allocation profiler, counts allocated bytes, live bytes and allocation rate of each subsystem
+ * One object (or allocation) is sampled every N, the result is multiplied by N as the estimation,
+ * when disabled each allocation only costs one more configuration read
+ */
+class AllocProfiler {
+public:
+    enum Subsystem {
+        kFrame = 0,
+        kRtpPacket,
+        kRtmpPacket,
+        // http等协议分包器的粘包缓存(未消费完的接收数据)，并非BufferRaw
+        // Reassembly cache (received data not yet consumed) of the splitter of http and other protocols, not BufferRaw
+        kSplitterCache,
+        // ts/ps复用输出缓存，包括hls
+        // Output buffers of the ts/ps muxer, including hls
+        kTs,
+        // webrtc发送包缓存池
+        // Packet pool of webrtc sending
+        kWebRtc,
+        kSubsystemMax
+    };
+
+    static const char *getSubsystemName(Subsystem type);
+
+    /**
+     * 对象内存追踪，作为被追踪类的最后一个成员，构造时决定是否采样，析构时统计其最终大小
+     * Object memory tracker, as the last member of the tracked class, decides whether to sample when constructed,
+     * and counts its final size when destructed
+     */
+    class Tracker {
+    public:
+        using GetSize = size_t (*)(const void *owner);
+
+        Tracker(Subsystem type, const void *owner, GetSize get_size);
+        // 拷贝的对象不采样
+        // Copied objects are not sampled
+        Tracker(const Tracker &that) {}
+        Tracker &operator=(const Tracker &that) { return *this; }
+        ~Tracker();
+
+    private:
+        friend class AllocProfiler;
+        Subsystem _type = kFrame;
+        const void *_owner = nullptr;
+        GetSize _get_size = nullptr;
+        uint32_t _weight = 0;
+    };
+
+    struct Stats {
+        // 估算的累计分配次数与字节数
+        // Estimated accumulated allocation count and bytes
+        uint64_t allocs = 0;
+        uint64_t bytes = 0;
+        // 估算的存活对象数与字节数，只对对象追踪有效
+        // Estimated live objects and bytes, only valid for object tracking
+        uint64_t live_objects = 0;
+        uint64_t live_bytes = 0;
+        // 最近一秒的分配速率
+        // Allocation rate of the last second
+        uint64_t allocs_per_sec = 0;
+        uint64_t bytes_per_sec = 0;
+    };
+
+    static AllocProfiler &Instance();
+
+    /**
+     * 统计一次缓存分配，用于无法追踪对象的池化缓存
+     * Count one buffer allocation, used for pooled buffers whose objects can not be tracked
+     */
+    static void record(Subsystem type, size_t bytes);
+
+    /**
+     * 按配置开始统计分配速率，只能调用一次
+     * Start counting the allocation rate according to the configuration, it can only be called once
+     */
+    void start();
+
+    std::vector<Stats> getStats();
+
+    /**
+     * 输出OpenMetrics格式的统计数据
+     * Output the statistic data in OpenMetrics format
+     */
+    void dump(std::string &out);
+
+private:
+    AllocProfiler() = default;
+    void addTracker(Tracker *tracker);
+    void removeTracker(Tracker *tracker);
+    void updateRate();
+
+private:
+    struct Counter {
+        std::atomic<uint64_t> allocs { 0 };
+        // 已释放的采样对象与record统计的字节数
+        // Bytes of freed sampled objects and the ones counted by record
+        std::atomic<uint64_t> bytes { 0 };
+        std::mutex mtx;
+        std::unordered_set<Tracker *> trackers;
+        // getStats在锁外测量的对象，其析构需等待测量完成
+        // Object being measured by getStats outside the lock, its destruction must wait for the measurement
+        Tracker *measuring = nullptr;
+        std::condition_variable measured;
+        uint64_t last_allocs = 0;
+        uint64_t last_bytes = 0;
+        uint64_t allocs_per_sec = 0;
+        uint64_t bytes_per_sec = 0;
+    };
+
+    std::mutex _rate_mtx;
+    // 串行化getStats的测量过程
+    // Serialize the measurement of getStats
+    std::mutex _measure_mtx;
+    Counter _counters[kSubsystemMax];
+};
+
+} // namespace mediakit
+#endif // ZLMEDIAKIT_ALLOCPROFILER_H
@@ -0,0 +1,139 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "FrameGopCache.h"
+
+using namespace std;
+using namespace toolkit;
+
+namespace mediakit {
+
+// gop最大缓存帧数，超过后清空并等待下一个关键帧，防止无关键帧的流占用过多内存
+// Max cached frames of a gop, the cache is cleared and waits for the next key frame after exceeded,
+// which prevents streams without key frames from taking too much memory
+static constexpr size_t kMaxGopFrames = 1024;
+
+void FrameGopCache::setTracks(std::vector<Track::Ptr> tracks) {
+    lock_guard<mutex> lck(_mtx);
+    _have_video = false;
+    for (auto &track : tracks) {
+        if (track->getTrackType() == TrackVideo) {
+            _have_video = true;
+        }
+    }
+    _tracks = std::move(tracks);
+}
+
+std::vector<Track::Ptr> FrameGopCache::getTracks() const {
+    lock_guard<mutex> lck(_mtx);
+    return _tracks;
+}
+
+void FrameGopCache::inputFrame(const Frame::Ptr &frame) {
+    bool new_gop = false;
+    {
+        lock_guard<mutex> lck(_mtx);
+        if (!_have_video) {
+            // 没有视频时不缓存gop，与各协议环形缓冲行为一致
+            // Do not cache the gop when there is no video, consistent with the ring buffer of each protocol
+            return;
+        }
+        if (frame->getTrackType() == TrackVideo) {
+            // 遇到第一帧配置帧或关键帧则标记为gop开始处
+            // The first config frame or key frame is marked as the start of the gop
+            auto video_key_pos = frame->keyFrame() || frame->configFrame();
+            if (video_key_pos && !_video_key_pos) {
+                clearFrames_l();
+                _started = true;
+                new_gop = true;
+            }
+            if (!frame->dropAble()) {
+                _video_key_pos = video_key_pos;
+            }
+        }
+        if (_started) {
+            _frames.emplace_back(frame);
+            _bytes += frame->size();
+            if (_metrics) {
+                _metrics->add(StreamMetrics::kGopCacheBytes, (int64_t)frame->size());
+            }
+            // 帧数过多或超出内存预算时丢弃gop缓存，等待下个关键帧
+            // Drop the gop cache and wait for the next key frame when there are too many frames or the memory budget is exceeded
+            if (_frames.size() > kMaxGopFrames || (_metrics && _metrics->overMemoryBudget())) {
+                if (_metrics && _frames.size() <= kMaxGopFrames) {
+                    _metrics->add(StreamMetrics::kGopCacheDrops);
+                }
+                clearFrames_l();
+                _started = false;
+                new_gop = true;
+            }
+        }
+    }
+    if (new_gop) {
+        clearMemo();
+    }
+}
+
+void FrameGopCache::clear() {
+    {
+        lock_guard<mutex> lck(_mtx);
+        _have_video = false;
+        _video_key_pos = false;
+        _started = false;
+        _tracks.clear();
+        clearFrames_l();
+    }
+    clearMemo();
+}
+
+void FrameGopCache::clearFrames_l() {
+    _frames.clear();
+    if (_metrics && _bytes) {
+        _metrics->add(StreamMetrics::kGopCacheBytes, -(int64_t)_bytes);
+    }
+    _bytes = 0;
+}
+
+std::vector<Frame::Ptr> FrameGopCache::getGop(uint64_t stamp) const {
+    std::vector<Frame::Ptr> ret;
+    lock_guard<mutex> lck(_mtx);
+    ret.reserve(_frames.size());
+    for (auto &frame : _frames) {
+        if (frame->dts() >= stamp) {
+            // 音视频交织，各track间dts并不单调，跳过该帧而不是截断后续帧
+            // Audio and video are interleaved and dts is not monotonic across tracks, skip this frame instead of cutting off the rest
+            continue;
+        }
+        ret.emplace_back(frame);
+    }
+    return ret;
+}
+
+void FrameGopCache::addPacketizer(const std::weak_ptr<GopPacketizerInterface> &packetizer) {
+    lock_guard<mutex> lck(_mtx);
+    _packetizers.emplace_back(packetizer);
+}
+
+void FrameGopCache::clearMemo() {
+    decltype(_packetizers) packetizers;
+    {
+        lock_guard<mutex> lck(_mtx);
+        packetizers = _packetizers;
+    }
+    // 不持锁调用，防止与makeGop死锁
+    // Call without holding the lock to prevent deadlock with makeGop
+    for (auto &weak_packetizer : packetizers) {
+        if (auto packetizer = weak_packetizer.lock()) {
+            packetizer->clearMemo();
+        }
+    }
+}
+
+} // namespace mediakit
@@ -0,0 +1,277 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_FRAMEGOPCACHE_H
+#define ZLMEDIAKIT_FRAMEGOPCACHE_H
+
+#include <mutex>
+#include <algorithm>
+#include <vector>
+#include <functional>
+#include "Util/List.h"
+#include "Common/MediaSink.h"
+#include "Common/MediaMetrics.h"
+
+namespace mediakit {
+
+class GopPacketizerInterface {
+public:
+    virtual ~GopPacketizerInterface() = default;
+
+    /**
+     * gop切换时释放之前按需打包的结果
+     * Release the previously packetized result when the gop changes
+     */
+    virtual void clearMemo() = 0;
+};
+
+/**
+ * 帧级别gop缓存，线程安全
+ * 统一gop缓存模式下，只有该对象缓存当前gop，各协议环形缓冲只保留最新数据，新播放器的gop由各协议按需打包
+ * Frame level gop cache, thread safe
+ * In unified gop cache mode, only this object caches the current gop, the ring buffer of each protocol only keeps the latest data,
+ * and the gop of a new player is packetized on demand by each protocol
+ */
+class FrameGopCache {
+public:
+    using Ptr = std::shared_ptr<FrameGopCache>;
+
+    /**
+     * @param metrics 统计gop缓存字节数并检查内存预算，超出后丢弃gop缓存直到下个关键帧
+     * @param metrics Count the bytes of the gop cache and check the memory budget,
+     * the gop cache is dropped until the next key frame after exceeded
+     */
+    FrameGopCache(StreamMetrics::Ptr metrics = nullptr) : _metrics(std::move(metrics)) {}
+
+    /**
+     * 设置track，生成按需打包的封装器时使用
+     * Set tracks, used when creating the muxer for on-demand packetization
+     */
+    void setTracks(std::vector<Track::Ptr> tracks);
+    std::vector<Track::Ptr> getTracks() const;
+
+    /**
+     * 输入帧，必须是可缓存的帧
+     * Input frame, it must be a cacheable frame
+     */
+    void inputFrame(const Frame::Ptr &frame);
+
+    /**
+     * 清空track与gop缓存
+     * Clear tracks and gop cache
+     */
+    void clear();
+
+    /**
+     * 获取当前gop中dts小于stamp的帧
+     * Get frames of the current gop whose dts is less than stamp
+     */
+    std::vector<Frame::Ptr> getGop(uint64_t stamp) const;
+
+    void addPacketizer(const std::weak_ptr<GopPacketizerInterface> &packetizer);
+
+private:
+    void clearMemo();
+    void clearFrames_l();
+
+private:
+    bool _have_video = false;
+    bool _video_key_pos = false;
+    bool _started = false;
+    size_t _bytes = 0;
+    mutable std::mutex _mtx;
+    StreamMetrics::Ptr _metrics;
+    std::vector<Track::Ptr> _tracks;
+    std::vector<Frame::Ptr> _frames;
+    std::vector<std::weak_ptr<GopPacketizerInterface> > _packetizers;
+};
+
+/**
+ * 按需把帧级别gop打包为某协议的数据包，同一gop的打包结果会被缓存复用
+ * Packetize the frame level gop into packets of a protocol on demand, the result of the same gop is cached for reuse
+ */
+template <typename Packet>
+class GopPacketizer : public GopPacketizerInterface {
+public:
+    using Ptr = std::shared_ptr<GopPacketizer>;
+    using PacketPtr = std::shared_ptr<Packet>;
+    using RingDataType = std::shared_ptr<toolkit::List<PacketPtr> >;
+    using onPacket = std::function<void(PacketPtr packet)>;
+    using onCreateMuxer = std::function<MediaSinkInterface::Ptr(onPacket cb)>;
+
+    static Ptr create(const FrameGopCache::Ptr &cache, onCreateMuxer cb) {
+        auto ret = std::make_shared<GopPacketizer>(cache, std::move(cb));
+        cache->addPacketizer(ret);
+        return ret;
+    }
+
+    GopPacketizer(FrameGopCache::Ptr cache, onCreateMuxer cb) {
+        _cache = std::move(cache);
+        _create_muxer = std::move(cb);
+    }
+
+    /**
+     * 打包当前gop中时间戳小于stamp的部分
+     * @param stamp 播放器收到的第一个直播数据包的时间戳
+     * Packetize the part of the current gop whose timestamp is less than stamp
+     * @param stamp Timestamp of the first live packet received by the player
+     */
+    RingDataType makeGop(uint64_t stamp) {
+        auto frames = _cache->getGop(stamp);
+        if (frames.empty()) {
+            return nullptr;
+        }
+        Memo memo;
+        uint64_t version;
+        {
+            std::lock_guard<std::mutex> lck(_mtx);
+            version = _version;
+            // 跳过的帧可能在更晚的stamp下重新出现，只有本次的帧以上次打包的帧为前缀时才能复用
+            // Skipped frames may show up again with a later stamp, the memo is reused only if this frame set starts with the memo's frames
+            if (_memo.muxer && isPrefix(_memo.frames, frames)) {
+                if (_memo.frames.size() == frames.size()) {
+                    return filterPackets(*_memo.packets, stamp);
+                }
+                // 取走封装器在锁外增量打包，期间其他调用者会重新打包
+                // Take the muxer out and packetize incrementally outside the lock, other callers packetize again meanwhile
+                memo = std::move(_memo);
+                _memo = Memo();
+            }
+        }
+        if (!memo.muxer) {
+            // gop已经切换或帧集合不再衔接，重新打包
+            // The gop has changed or the frame set no longer extends the memo, packetize again
+            auto packets = std::make_shared<std::vector<PacketPtr> >();
+            memo.packets = packets;
+            memo.muxer = _create_muxer([packets](PacketPtr packet) { packets->emplace_back(std::move(packet)); });
+            for (auto &track : _cache->getTracks()) {
+                memo.muxer->addTrack(track->clone());
+            }
+            memo.muxer->addTrackCompleted();
+        }
+        // 只打包上次之后新增的帧
+        // Only packetize frames added since last time
+        for (auto i = memo.frames.size(); i < frames.size(); ++i) {
+            memo.muxer->inputFrame(frames[i]);
+        }
+        memo.frames = std::move(frames);
+        memo.muxer->flush();
+        auto ret = filterPackets(*memo.packets, stamp);
+        {
+            std::lock_guard<std::mutex> lck(_mtx);
+            // 打包期间gop未切换，且没有其他调用者存入更完整的结果时才保存
+            // Save only if the gop did not change meanwhile and no other caller saved a more complete result
+            if (version == _version && (!_memo.muxer || !isPrefix(memo.frames, _memo.frames))) {
+                _memo = std::move(memo);
+            }
+        }
+        return ret;
+    }
+
+    void clearMemo() override {
+        Memo memo;
+        {
+            std::lock_guard<std::mutex> lck(_mtx);
+            ++_version;
+            memo = std::move(_memo);
+            _memo = Memo();
+        }
+        // 打包结果在锁外释放
+        // The packetized result is released outside the lock
+    }
+
+private:
+    struct Memo {
+        std::vector<Frame::Ptr> frames;
+        MediaSinkInterface::Ptr muxer;
+        std::shared_ptr<std::vector<PacketPtr> > packets;
+    };
+
+    static bool isPrefix(const std::vector<Frame::Ptr> &prefix, const std::vector<Frame::Ptr> &frames) {
+        return prefix.size() <= frames.size() && std::equal(prefix.begin(), prefix.end(), frames.begin());
+    }
+
+    static RingDataType filterPackets(const std::vector<PacketPtr> &packets, uint64_t stamp) {
+        auto ret = std::make_shared<toolkit::List<PacketPtr> >();
+        for (auto &packet : packets) {
+            if (packet->time_stamp < stamp) {
+                ret->emplace_back(packet);
+            }
+        }
+        return ret->empty() ? nullptr : ret;
+    }
+
+private:
+    uint64_t _version = 0;
+    std::mutex _mtx;
+    Memo _memo;
+    FrameGopCache::Ptr _cache;
+    onCreateMuxer _create_muxer;
+};
+
+/**
+ * 支持按需生成gop的协议媒体源
+ * Protocol media source that supports generating the gop on demand
+ */
+template <typename Packet>
+class LazyGopSource {
+public:
+    using RingDataType = std::shared_ptr<toolkit::List<std::shared_ptr<Packet> > >;
+    using onMakeGop = std::function<RingDataType(uint64_t stamp)>;
+    using onReadCB = std::function<void(const RingDataType &data)>;
+    using onJoinLive = std::function<onReadCB(const RingDataType &gop, onReadCB cb)>;
+
+    /**
+     * 设置按需生成gop的回调，设置后环形缓冲不再缓存gop，请在媒体源注册前调用
+     * @param join 可选，输出gop后用于包装后续直播数据的读取回调，用于衔接gop与直播数据
+     * Set the callback to generate the gop on demand, the ring buffer no longer caches the gop after it is set,
+     * please call it before the media source is registered
+     * @param join Optional, wraps the read callback of the live data after the gop is output, used to join the gop with the live data
+     */
+    void setGopMaker(onMakeGop cb, onJoinLive join = nullptr) {
+        _gop_maker = std::move(cb);
+        _gop_joiner = std::move(join);
+    }
+
+    bool isLazyGop() const { return (bool)_gop_maker; }
+
+    /**
+     * 包装播放器的环形缓冲读取回调，收到第一个直播数据包前先输出按需打包的gop
+     * Wrap the ring buffer read callback of the player, the gop packetized on demand is output before the first live packet
+     */
+    onReadCB wrapReadCB(onReadCB cb) const {
+        if (!_gop_maker) {
+            return cb;
+        }
+        auto maker = _gop_maker;
+        auto joiner = _gop_joiner;
+        auto live = cb;
+        bool first = true;
+        return [maker, joiner, cb, live, first](const RingDataType &data) mutable {
+            if (first && !data->empty()) {
+                first = false;
+                if (auto gop = maker(data->front()->time_stamp)) {
+                    cb(gop);
+                    if (joiner) {
+                        live = joiner(gop, cb);
+                    }
+                }
+            }
+            live(data);
+        };
+    }
+
+private:
+    onMakeGop _gop_maker;
+    onJoinLive _gop_joiner;
+};
+
+} // namespace mediakit
+#endif // ZLMEDIAKIT_FRAMEGOPCACHE_H
@@ -0,0 +1,430 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include "MediaMetrics.h"
+#include "PollerMonitor.h"
+#include "AllocProfiler.h"
+#include "Common/config.h"
+
+using namespace std;
+
+namespace mediakit {
+
+LatencyHistogram::LatencyHistogram() {
+    _sum.store(0, memory_order_relaxed);
+    for (auto &value : _buckets) {
+        value.store(0, memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::add(uint64_t us) {
+    size_t index = 0;
+    if (us >= 64) {
+        // 最高位所在数量级，再按次高位一分为二
+        // Order of magnitude of the highest bit, then split into two by the next bit
+        size_t msb = 0;
+        for (auto value = us; value >>= 1;) {
+            ++msb;
+        }
+        index = std::min<size_t>((msb - 6) * 2 + ((us >> (msb - 1)) & 1) + 1, kBuckets - 1);
+    }
+    _buckets[index].fetch_add(1, memory_order_relaxed);
+    _sum.fetch_add(us, memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::snapshot(uint64_t (&buckets)[kBuckets]) const {
+    for (size_t i = 0; i < kBuckets; ++i) {
+        buckets[i] = _buckets[i].load(memory_order_relaxed);
+    }
+    return _sum.load(memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::upperBound(size_t index) {
+    if (index == 0) {
+        return 64;
+    }
+    auto msb = (index - 1) / 2 + 6;
+    return (index - 1) % 2 ? (2ULL << msb) : (3ULL << (msb - 1));
+}
+
+uint64_t LatencyHistogram::quantile(const uint64_t (&buckets)[kBuckets], double q) {
+    uint64_t total = 0;
+    for (auto count : buckets) {
+        total += count;
+    }
+    if (!total) {
+        return 0;
+    }
+    uint64_t target = (uint64_t)(total * q);
+    uint64_t count = 0;
+    for (size_t i = 0; i < kBuckets - 1; ++i) {
+        count += buckets[i];
+        if (count > target) {
+            return upperBound(i);
+        }
+    }
+    // 最后一个桶没有上界，取其下界
+    // The last bucket has no upper bound, take its lower bound
+    return upperBound(kBuckets - 2);
+}
+
+uint64_t LatencyTracer::now() {
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static thread_local uint64_t s_ingest_stamp = 0;
+
+uint64_t LatencyTracer::current() {
+    return s_ingest_stamp;
+}
+
+LatencyTracer::Scope::Scope(uint64_t stamp) {
+    _last = s_ingest_stamp;
+    s_ingest_stamp = stamp;
+}
+
+LatencyTracer::Scope::~Scope() {
+    s_ingest_stamp = _last;
+}
+
+const char *StreamMetrics::getLatencyName(Latency latency) {
+    switch (latency) {
+        case kLatencyMerge: return "merge";
+        case kLatencyRtsp: return "rtsp";
+        case kLatencyRtmp: return "rtmp";
+        case kLatencyWebRtc: return "webrtc";
+        case kLatencyFlv: return "http-flv";
+        default: return "invalid";
+    }
+}
+
+StreamMetrics::StreamMetrics(string schema, string vhost, string app, string stream) {
+    for (auto &value : _counters.value) {
+        value.store(0, memory_order_relaxed);
+    }
+    for (auto &value : _gauges.value) {
+        value.store(0, memory_order_relaxed);
+    }
+    for (auto &histogram : _latency) {
+        histogram.store(nullptr, memory_order_relaxed);
+    }
+    _stream_memory = MetricsRegistry::Instance().getStreamMemory(vhost, app, stream);
+    _schema = std::move(schema);
+    _vhost = std::move(vhost);
+    _app = std::move(app);
+    _stream = std::move(stream);
+}
+
+StreamMetrics::~StreamMetrics() {
+    for (auto &histogram : _latency) {
+        delete histogram.load(memory_order_relaxed);
+    }
+    // 归还未释放的缓存字节统计
+    // Give back the cached bytes not released
+    for (int i = kGopCacheBytes; i < kGaugeMax; ++i) {
+        onGaugeChanged((Gauge)i, -_gauges.value[i].load(memory_order_relaxed));
+    }
+}
+
+void StreamMetrics::onGaugeChanged(Gauge gauge, int64_t delta) {
+    if (gauge == kReaders || !delta) {
+        return;
+    }
+    _stream_memory->fetch_add(delta, memory_order_relaxed);
+    MetricsRegistry::Instance()._memory.fetch_add(delta, memory_order_relaxed);
+}
+
+bool StreamMetrics::overMemoryBudget() const {
+    GET_CONFIG(uint64_t, stream_budget_mb, General::kStreamMemoryBudgetMB);
+    GET_CONFIG(uint64_t, global_budget_mb, General::kMemoryBudgetMB);
+    if (stream_budget_mb && getStreamMemory() > (int64_t)(stream_budget_mb << 20)) {
+        return true;
+    }
+    return global_budget_mb && MetricsRegistry::Instance().getMemory() > (int64_t)(global_budget_mb << 20);
+}
+
+void StreamMetrics::addLatency(Latency latency, uint64_t ingest_stamp) {
+    auto now = LatencyTracer::now();
+    auto us = now > ingest_stamp ? now - ingest_stamp : 0;
+    auto histogram = _latency[latency].load(memory_order_acquire);
+    if (!histogram) {
+        // 出口可能在多个线程，创建时需防止竞争
+        // Egress may be in multiple threads, prevent races when creating
+        auto created = new LatencyHistogram;
+        if (_latency[latency].compare_exchange_strong(histogram, created, memory_order_acq_rel)) {
+            histogram = created;
+        } else {
+            delete created;
+        }
+    }
+    histogram->add(us);
+    MetricsRegistry::Instance().getLatency(latency).add(us);
+}
+
+MetricsRegistry &MetricsRegistry::Instance() {
+    static MetricsRegistry s_instance;
+    return s_instance;
+}
+
+void MetricsRegistry::add(const StreamMetrics::Ptr &metrics) {
+    if (metrics->_registered.test_and_set()) {
+        return;
+    }
+    lock_guard<mutex> lck(_mtx);
+    _metrics.emplace_back(metrics);
+}
+
+shared_ptr<atomic<int64_t> > MetricsRegistry::getStreamMemory(const string &vhost, const string &app, const string &stream) {
+    auto key = vhost + "/" + app + "/" + stream;
+    lock_guard<mutex> lck(_memory_mtx);
+    auto &weak_memory = _stream_memory[key];
+    auto ret = weak_memory.lock();
+    if (!ret) {
+        // 计数器释放时按key移除，无需遍历整个表清理已销毁的流
+        // Removed by key when the counter is released, no need to traverse the whole table to clean up destroyed streams
+        ret.reset(new atomic<int64_t>(0), [key](atomic<int64_t> *ptr) {
+            delete ptr;
+            MetricsRegistry::Instance().removeStreamMemory(key);
+        });
+        weak_memory = ret;
+    }
+    return ret;
+}
+
+void MetricsRegistry::removeStreamMemory(const string &key) {
+    lock_guard<mutex> lck(_memory_mtx);
+    auto it = _stream_memory.find(key);
+    // 期间可能已为同一个流重新创建了计数器
+    // A new counter may have been created for the same stream in the meantime
+    if (it != _stream_memory.end() && it->second.expired()) {
+        _stream_memory.erase(it);
+    }
+}
+
+vector<StreamMetrics::Ptr> MetricsRegistry::snapshot() {
+    vector<StreamMetrics::Ptr> ret;
+    lock_guard<mutex> lck(_mtx);
+    // 顺便移除已销毁的对象
+    // Remove destroyed objects by the way
+    _metrics.erase(remove_if(_metrics.begin(), _metrics.end(), [](const weak_ptr<StreamMetrics> &weak_metrics) { return weak_metrics.expired(); }),
+                   _metrics.end());
+    ret.reserve(_metrics.size());
+    for (auto &weak_metrics : _metrics) {
+        if (auto metrics = weak_metrics.lock()) {
+            ret.emplace_back(std::move(metrics));
+        }
+    }
+    return ret;
+}
+
+static void appendLabelValue(string &out, const string &value) {
+    for (auto ch : value) {
+        switch (ch) {
+            case '\\': out.append("\\\\"); break;
+            case '"': out.append("\\\""); break;
+            case '\n': out.append("\\n"); break;
+            default: out.push_back(ch); break;
+        }
+    }
+}
+
+// extra为额外的标签，例如track="video"
+// extra is the additional label, for example track="video"
+static void appendSample(string &out, const char *name, const StreamMetrics &metrics, const char *extra, int64_t value) {
+    out.append(name);
+    out.push_back('{');
+    if (!metrics.getSchema().empty()) {
+        out.append("schema=\"");
+        appendLabelValue(out, metrics.getSchema());
+        out.append("\",");
+    }
+    out.append("vhost=\"");
+    appendLabelValue(out, metrics.getVhost());
+    out.append("\",app=\"");
+    appendLabelValue(out, metrics.getApp());
+    out.append("\",stream=\"");
+    appendLabelValue(out, metrics.getStream());
+    out.push_back('"');
+    if (extra) {
+        out.push_back(',');
+        out.append(extra);
+    }
+    out.append("} ");
+    out.append(to_string(value));
+    out.push_back('\n');
+}
+
+void MetricsRegistry::appendHeader(string &out, const char *family, const char *type, const char *help) {
+    out.append("# TYPE ").append(family).append(" ").append(type).append("\n");
+    out.append("# HELP ").append(family).append(" ").append(help).append("\n");
+}
+
+static string toSeconds(uint64_t us) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.6f", us / 1000000.0);
+    return buf;
+}
+
+static void appendLatencySummary(string &out, const StreamMetrics &metrics, StreamMetrics::Latency latency, const LatencyHistogram &histogram) {
+    static const pair<const char *, double> s_quantiles[] = { { "0.5", 0.5 }, { "0.99", 0.99 }, { "0.999", 0.999 } };
+
+    uint64_t buckets[LatencyHistogram::kBuckets];
+    auto sum = histogram.snapshot(buckets);
+    uint64_t count = 0;
+    for (auto value : buckets) {
+        count += value;
+    }
+
+    string labels = "{";
+    labels.append("schema=\"");
+    appendLabelValue(labels, metrics.getSchema());
+    labels.append("\",vhost=\"");
+    appendLabelValue(labels, metrics.getVhost());
+    labels.append("\",app=\"");
+    appendLabelValue(labels, metrics.getApp());
+    labels.append("\",stream=\"");
+    appendLabelValue(labels, metrics.getStream());
+    labels.append("\",stage=\"");
+    labels.append(StreamMetrics::getLatencyName(latency));
+    labels.push_back('"');
+
+    for (auto &quantile : s_quantiles) {
+        out.append("zlm_stream_latency_seconds").append(labels).append(",quantile=\"").append(quantile.first).append("\"} ");
+        out.append(toSeconds(LatencyHistogram::quantile(buckets, quantile.second))).append("\n");
+    }
+    out.append("zlm_stream_latency_seconds_sum").append(labels).append("} ").append(toSeconds(sum)).append("\n");
+    out.append("zlm_stream_latency_seconds_count").append(labels).append("} ").append(to_string(count)).append("\n");
+}
+
+void MetricsRegistry::appendHistogram(string &out, const string &family, const string &labels, const LatencyHistogram &histogram) {
+    uint64_t buckets[LatencyHistogram::kBuckets];
+    auto sum = histogram.snapshot(buckets);
+    auto prefix = "{" + labels + ",le=\"";
+    uint64_t count = 0;
+    for (size_t i = 0; i < LatencyHistogram::kBuckets - 1; ++i) {
+        count += buckets[i];
+        out.append(family).append("_bucket").append(prefix).append(toSeconds(LatencyHistogram::upperBound(i)));
+        out.append("\"} ").append(to_string(count)).append("\n");
+    }
+    count += buckets[LatencyHistogram::kBuckets - 1];
+    out.append(family).append("_bucket").append(prefix).append("+Inf\"} ").append(to_string(count)).append("\n");
+    out.append(family).append("_sum{").append(labels).append("} ").append(toSeconds(sum)).append("\n");
+    out.append(family).append("_count{").append(labels).append("} ").append(to_string(count)).append("\n");
+}
+
+string MetricsRegistry::dump() {
+    struct CounterFamily {
+        const char *family;
+        const char *help;
+        StreamMetrics::Counter counter;
+    };
+
+    struct GaugeFamily {
+        const char *family;
+        const char *help;
+        StreamMetrics::Gauge gauge;
+    };
+
+    static const CounterFamily s_source_counters[] = {
+        { "zlm_stream_bytes_in", "Bytes written into the media source.", StreamMetrics::kBytesIn },
+        { "zlm_stream_packets_in", "Packets written into the media source.", StreamMetrics::kPacketsIn },
+        { "zlm_stream_bytes_out", "Bytes dispatched to the readers of the media source.", StreamMetrics::kBytesOut },
+        { "zlm_stream_packets_out", "Packets dispatched to the readers of the media source.", StreamMetrics::kPacketsOut },
+        { "zlm_stream_nacks", "RTCP NACK messages received from players or sent to pushers.", StreamMetrics::kNacks },
+        { "zlm_stream_gop_cache_drops", "Gop caches of the media source dropped for exceeding the memory budget.", StreamMetrics::kGopCacheDrops },
+    };
+
+    static const GaugeFamily s_source_gauges[] = {
+        { "zlm_stream_readers", "Readers of the media source.", StreamMetrics::kReaders },
+        { "zlm_stream_gop_cache_bytes", "Bytes cached by the gop cache of the media source.", StreamMetrics::kGopCacheBytes },
+    };
+
+    auto all = snapshot();
+    string out;
+    // 每个流每种协议约有10行数据，每行约120字节
+    // About 10 lines per protocol of each stream, about 120 bytes per line
+    out.reserve(all.size() * 1200 + 4096);
+
+    for (auto &family : s_source_counters) {
+        appendHeader(out, family.family, "counter", family.help);
+        string name = string(family.family) + "_total";
+        for (auto &metrics : all) {
+            if (!metrics->getSchema().empty()) {
+                appendSample(out, name.data(), *metrics, nullptr, metrics->get(family.counter));
+            }
+        }
+    }
+
+    for (auto &family : s_source_gauges) {
+        appendHeader(out, family.family, "gauge", family.help);
+        for (auto &metrics : all) {
+            if (!metrics->getSchema().empty()) {
+                appendSample(out, family.family, *metrics, nullptr, metrics->get(family.gauge));
+            }
+        }
+    }
+
+    appendHeader(out, "zlm_stream_frames", "counter", "Frames input into the stream muxer.");
+    for (auto &metrics : all) {
+        if (metrics->getSchema().empty()) {
+            appendSample(out, "zlm_stream_frames_total", *metrics, "track=\"video\"", metrics->get(StreamMetrics::kVideoFrames));
+            appendSample(out, "zlm_stream_frames_total", *metrics, "track=\"audio\"", metrics->get(StreamMetrics::kAudioFrames));
+        }
+    }
+
+    appendHeader(out, "zlm_stream_muxer_cache_bytes", "gauge", "Bytes cached by the stream muxer.");
+    for (auto &metrics : all) {
+        if (metrics->getSchema().empty()) {
+            appendSample(out, "zlm_stream_muxer_cache_bytes", *metrics, "cache=\"gop\"", metrics->get(StreamMetrics::kGopCacheBytes));
+            appendSample(out, "zlm_stream_muxer_cache_bytes", *metrics, "cache=\"unready\"", metrics->get(StreamMetrics::kUnreadyBytes));
+            appendSample(out, "zlm_stream_muxer_cache_bytes", *metrics, "cache=\"paced\"", metrics->get(StreamMetrics::kPacedBytes));
+        }
+    }
+
+    appendHeader(out, "zlm_cache_bytes", "gauge", "Bytes cached by all streams.");
+    out.append("zlm_cache_bytes ").append(to_string(getMemory())).append("\n");
+
+    appendHeader(out, "zlm_stream_drops", "counter", "Frames dropped by the stream muxer.");
+    for (auto &metrics : all) {
+        if (metrics->getSchema().empty()) {
+            appendSample(out, "zlm_stream_drops_total", *metrics, nullptr, metrics->get(StreamMetrics::kDrops));
+        }
+    }
+
+    // 单个流只输出分位数，避免大量流时输出过多的直方图桶
+    // Only quantiles are output for a single stream, to avoid too many histogram buckets when there are many streams
+    appendHeader(out, "zlm_stream_latency_seconds", "summary", "Sampled latency from entering the muxer to each stage.");
+    for (auto &metrics : all) {
+        for (int i = 0; i < StreamMetrics::kLatencyMax; ++i) {
+            auto latency = (StreamMetrics::Latency)i;
+            auto histogram = metrics->getLatency(latency);
+            if (histogram) {
+                appendLatencySummary(out, *metrics, latency, *histogram);
+            }
+        }
+    }
+
+    appendHeader(out, "zlm_latency_seconds", "histogram", "Sampled latency of all streams from entering the muxer to each stage.");
+    for (int i = 0; i < StreamMetrics::kLatencyMax; ++i) {
+        auto latency = (StreamMetrics::Latency)i;
+        appendHistogram(out, "zlm_latency_seconds", string("stage=\"") + StreamMetrics::getLatencyName(latency) + "\"", getLatency(latency));
+    }
+
+    PollerMonitor::Instance().dump(out);
+    AllocProfiler::Instance().dump(out);
+
+    out.append("# EOF\n");
+    return out;
+}
+
+} // namespace mediakit
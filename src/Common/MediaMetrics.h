@@ -0,0 +1,341 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_MEDIAMETRICS_H
+#define ZLMEDIAKIT_MEDIAMETRICS_H
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+namespace mediakit {
+
+/**
+ * 时延直方图，按半个二进制数量级分桶，单位微秒
+ * Latency histogram, bucketed by half binary order of magnitude, in microseconds
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t kBuckets = 48;
+
+    LatencyHistogram();
+
+    void add(uint64_t us);
+
+    /**
+     * 获取各桶计数与总和
+     * Get the count of each bucket and the sum
+     */
+    uint64_t snapshot(uint64_t (&buckets)[kBuckets]) const;
+
+    /**
+     * 桶的上界，单位微秒
+     * Upper bound of the bucket, in microseconds
+     */
+    static uint64_t upperBound(size_t index);
+
+    /**
+     * 根据各桶计数计算分位数，返回所在桶的上界，单位微秒
+     * Calculate the quantile from the bucket counts, return the upper bound of the bucket, in microseconds
+     */
+    static uint64_t quantile(const uint64_t (&buckets)[kBuckets], double q);
+
+private:
+    std::atomic<uint64_t> _sum;
+    std::atomic<uint64_t> _buckets[kBuckets];
+};
+
+/**
+ * 帧时延追踪，采样帧进入MultiMediaSourceMuxer时打上单调时间戳，由此生成的rtp/rtmp包携带该时间戳直到发送
+ * Frame latency tracing, the sampled frame is stamped with a monotonic timestamp when entering MultiMediaSourceMuxer,
+ * the rtp/rtmp packets generated from it carry the timestamp until they are sent
+ */
+class LatencyTracer {
+public:
+    /**
+     * 单调时钟，单位微秒
+     * Monotonic clock, in microseconds
+     */
+    static uint64_t now();
+
+    /**
+     * 本线程正在封装的帧的采样时间戳，为0时代表未采样
+     * Sampled timestamp of the frame being muxed in this thread, 0 means not sampled
+     */
+    static uint64_t current();
+
+    /**
+     * 在作用域内设置本线程正在封装的帧的采样时间戳
+     * Set the sampled timestamp of the frame being muxed in this thread within the scope
+     */
+    class Scope {
+    public:
+        Scope(uint64_t stamp);
+        ~Scope();
+
+    private:
+        uint64_t _last;
+    };
+};
+
+/**
+ * 单个流的统计计数器
+ * 计数器可能被多个线程写入(例如webrtc传输线程累加nack与重传计数)，因此统一使用relaxed的fetch_add，
+ * 计数器与计量值各自独占缓存行，避免不同流间的伪共享
+ * Statistic counters of one stream
+ * Counters may be written by several threads (e.g. the webrtc transport threads bump the nack and retransmission counters),
+ * so relaxed fetch_add is always used, counters and gauges occupy their own cache lines to avoid false sharing between streams
+ */
+class StreamMetrics {
+public:
+    using Ptr = std::shared_ptr<StreamMetrics>;
+
+    enum Counter {
+        kBytesIn = 0,
+        kPacketsIn,
+        kBytesOut,
+        kPacketsOut,
+        kVideoFrames,
+        kAudioFrames,
+        kDrops,
+        kNacks,
+        // 超出内存预算后丢弃gop缓存的次数
+        // Times of dropping the gop cache after exceeding the memory budget
+        kGopCacheDrops,
+        kCounterMax
+    };
+
+    enum Gauge {
+        kReaders = 0,
+        // 以下为缓存字节数，计入本流与全局内存统计
+        // The followings are cached bytes, counted into the memory statistics of this stream and the global one
+        kGopCacheBytes,
+        // MediaSink中track未就绪时缓存的帧
+        // Frames cached by MediaSink while tracks are not ready
+        kUnreadyBytes,
+        // FramePacedSender中待发送的帧
+        // Frames waiting to be sent in FramePacedSender
+        kPacedBytes,
+        kGaugeMax
+    };
+
+    enum Latency {
+        // 从进入MultiMediaSourceMuxer到合并写入环形缓冲
+        // From entering MultiMediaSourceMuxer to merged writing into the ring buffer
+        kLatencyMerge = 0,
+        // 从进入MultiMediaSourceMuxer到各协议写入socket
+        // From entering MultiMediaSourceMuxer to writing into the socket of each protocol
+        kLatencyRtsp,
+        kLatencyRtmp,
+        kLatencyWebRtc,
+        kLatencyFlv,
+        kLatencyMax
+    };
+
+    static const char *getLatencyName(Latency latency);
+
+    /**
+     * @param schema 协议类型，为空时代表该统计对象属于MultiMediaSourceMuxer
+     * @param schema Protocol type, empty means the statistic object belongs to MultiMediaSourceMuxer
+     */
+    StreamMetrics(std::string schema, std::string vhost, std::string app, std::string stream);
+    ~StreamMetrics();
+
+    void add(Counter counter, uint64_t value = 1) { _counters.value[counter].fetch_add(value, std::memory_order_relaxed); }
+    void set(Gauge gauge, int64_t value) { onGaugeChanged(gauge, value - _gauges.value[gauge].exchange(value, std::memory_order_relaxed)); }
+    void add(Gauge gauge, int64_t value) {
+        _gauges.value[gauge].fetch_add(value, std::memory_order_relaxed);
+        onGaugeChanged(gauge, value);
+    }
+
+    uint64_t get(Counter counter) const { return _counters.value[counter].load(std::memory_order_relaxed); }
+    int64_t get(Gauge gauge) const { return _gauges.value[gauge].load(std::memory_order_relaxed); }
+
+    /**
+     * 统计采样帧的时延，同时计入本流与全局直方图
+     * @param ingest_stamp 采样帧进入MultiMediaSourceMuxer时的LatencyTracer::now()
+     * Count the latency of the sampled frame, into both the histogram of this stream and the global one
+     * @param ingest_stamp LatencyTracer::now() when the sampled frame entered MultiMediaSourceMuxer
+     */
+    void addLatency(Latency latency, uint64_t ingest_stamp);
+
+    /**
+     * 获取本流的时延直方图，未采样过时返回nullptr
+     * Get the latency histogram of this stream, nullptr if never sampled
+     */
+    const LatencyHistogram *getLatency(Latency latency) const { return _latency[latency].load(std::memory_order_acquire); }
+
+    /**
+     * 本流(相同vhost/app/stream的所有统计对象)缓存的总字节数
+     * Total cached bytes of this stream (all statistic objects of the same vhost/app/stream)
+     */
+    int64_t getStreamMemory() const { return _stream_memory->load(std::memory_order_relaxed); }
+
+    /**
+     * 本流或全局缓存字节数是否超出配置的内存预算
+     * Whether the cached bytes of this stream or the global one exceed the configured memory budget
+     */
+    bool overMemoryBudget() const;
+
+    const std::string &getSchema() const { return _schema; }
+    const std::string &getVhost() const { return _vhost; }
+    const std::string &getApp() const { return _app; }
+    const std::string &getStream() const { return _stream; }
+
+private:
+    friend class MetricsRegistry;
+
+    void onGaugeChanged(Gauge gauge, int64_t delta);
+
+    // 64字节为常见cpu缓存行大小，c++11下make_shared无法保证alignas，所以使用填充
+    // 64 bytes is the common cpu cache line size, make_shared can not guarantee alignas under c++11, so padding is used
+    struct Counters {
+        char pad[64];
+        std::atomic<uint64_t> value[kCounterMax];
+    };
+
+    struct Gauges {
+        char pad[64];
+        std::atomic<int64_t> value[kGaugeMax];
+        char pad_tail[64];
+    };
+
+    Counters _counters;
+    Gauges _gauges;
+    // 只有被采样的流才创建直方图
+    // Histograms are only created for sampled streams
+    std::atomic<LatencyHistogram *> _latency[kLatencyMax];
+    std::atomic_flag _registered = ATOMIC_FLAG_INIT;
+    // 相同vhost/app/stream的统计对象共享
+    // Shared by the statistic objects of the same vhost/app/stream
+    std::shared_ptr<std::atomic<int64_t> > _stream_memory;
+    std::string _schema;
+    std::string _vhost;
+    std::string _app;
+    std::string _stream;
+};
+
+/**
+ * 全局统计对象注册表，只在抓取时汇总，抓取时仅在复制列表期间持锁
+ * Global registry of statistic objects, aggregated only when scraping, the lock is only held while copying the list
+ */
+class MetricsRegistry {
+public:
+    static MetricsRegistry &Instance();
+
+    /**
+     * 注册统计对象，重复注册无效，对象销毁后自动移除
+     * Register a statistic object, repeated registration is ignored, it is removed automatically after destroyed
+     */
+    void add(const StreamMetrics::Ptr &metrics);
+
+    /**
+     * 生成OpenMetrics文本格式的统计数据
+     * Generate statistic data in OpenMetrics text format
+     */
+    std::string dump();
+
+    /**
+     * 获取所有统计对象
+     * Get all statistic objects
+     */
+    std::vector<StreamMetrics::Ptr> snapshot();
+
+    /**
+     * 全局时延直方图
+     * Global latency histogram
+     */
+    LatencyHistogram &getLatency(StreamMetrics::Latency latency) { return _latency[latency]; }
+
+    /**
+     * 所有流缓存的总字节数
+     * Total cached bytes of all streams
+     */
+    int64_t getMemory() const { return _memory.load(std::memory_order_relaxed); }
+
+    /**
+     * 输出OpenMetrics指标族的TYPE与HELP行
+     * Output the TYPE and HELP lines of an OpenMetrics family
+     */
+    static void appendHeader(std::string &out, const char *family, const char *type, const char *help);
+
+    /**
+     * 以OpenMetrics直方图格式输出时延直方图，单位秒
+     * @param labels 标签，不含花括号，例如stage="merge"
+     * Output the latency histogram in OpenMetrics histogram format, in seconds
+     * @param labels Labels without braces, for example stage="merge"
+     */
+    static void appendHistogram(std::string &out, const std::string &family, const std::string &labels, const LatencyHistogram &histogram);
+
+private:
+    friend class StreamMetrics;
+
+    MetricsRegistry() = default;
+
+    /**
+     * 获取相同vhost/app/stream共享的缓存字节计数
+     * Get the cached bytes counter shared by the same vhost/app/stream
+     */
+    std::shared_ptr<std::atomic<int64_t> > getStreamMemory(const std::string &vhost, const std::string &app, const std::string &stream);
+
+    /**
+     * 流的最后一个统计对象销毁时按key移除共享的缓存字节计数
+     * Remove the shared cached bytes counter by key when the last statistic object of the stream is destroyed
+     */
+    void removeStreamMemory(const std::string &key);
+
+private:
+    std::mutex _mtx;
+    std::mutex _memory_mtx;
+    std::atomic<int64_t> _memory { 0 };
+    std::vector<std::weak_ptr<StreamMetrics> > _metrics;
+    std::unordered_map<std::string, std::weak_ptr<std::atomic<int64_t> > > _stream_memory;
+    LatencyHistogram _latency[StreamMetrics::kLatencyMax];
+};
+
+/**
+ * 播放器出口时延采样
+ * 播放器加入时回放的gop缓存不是实时数据，不计入统计
+ * Egress latency sampling of the player
+ * The gop cache replayed when the player joins is not live data, so it is not counted
+ */
+class EgressTracer {
+public:
+    EgressTracer() = default;
+    EgressTracer(StreamMetrics::Ptr metrics, StreamMetrics::Latency latency) {
+        _metrics = std::move(metrics);
+        _latency = latency;
+    }
+
+    /**
+     * 环形缓冲读取回调设置完毕后调用，gop缓存已在设置回调时同步回放，之后收到的都是实时数据
+     * Call it after the ring buffer read callback is set, the gop cache is replayed synchronously when the callback is set,
+     * the data received afterwards is live
+     */
+    void setLive() { _live = true; }
+
+    void trace(uint64_t ingest_stamp) {
+        if (ingest_stamp && _live && _metrics) {
+            _metrics->addLatency(_latency, ingest_stamp);
+        }
+    }
+
+private:
+    bool _live = false;
+    StreamMetrics::Latency _latency = StreamMetrics::kLatencyMerge;
+    StreamMetrics::Ptr _metrics;
+};
+
+} // namespace mediakit
+#endif // ZLMEDIAKIT_MEDIAMETRICS_H
@@ -64,12 +64,17 @@ bool MediaSink::addTrack(const Track::Ptr &track_in) {
         if (frame_unread.size() > kMaxUnreadyFrame) {
             // 未就绪的的track，不能缓存太多的帧，否则可能内存溢出  [AUTO-TRANSLATED:23958376]
             // Unready tracks cannot cache too many frames, otherwise memory may overflow
+            onDropFrames(frame_unread.size());
+            size_t bytes = 0;
+            frame_unread.for_each([&](const Frame::Ptr &frame) { bytes += frame->size(); });
             frame_unread.clear();
+            setUnreadyBytes(_frame_unread_bytes - bytes);
             WarnL << "Cached frame of unready track(" << frame->getCodecName() << ") is too much, now cleared";
         }
         // 还有Track未就绪，先缓存之  [AUTO-TRANSLATED:f96eadfa]
         // There are still unready tracks, cache them first
         frame_unread.emplace_back(Frame::getCacheAbleFrame(frame));
+        setUnreadyBytes(_frame_unread_bytes + frame->size());
         return true;
     });
     return true;
@@ -83,9 +88,17 @@ void MediaSink::resetTracks() {
     _ticker.resetTime();
     _track_map.clear();
     _frame_unread.clear();
+    setUnreadyBytes(0);
     _track_ready_callback.clear();
 }
 
+void MediaSink::setUnreadyBytes(size_t bytes) {
+    if (_frame_unread_bytes != bytes) {
+        _frame_unread_bytes = bytes;
+        onUnreadyCacheChanged(bytes);
+    }
+}
+
 bool MediaSink::inputFrame(const Frame::Ptr &frame) {
     auto it = _track_map.find(frame->getIndex());
     if (it == _track_map.end()) {
@@ -226,6 +239,7 @@ void MediaSink::emitAllTrackReady() {
             pr.second.for_each([&](const Frame::Ptr &frame) { MediaSink::inputFrame(frame); });
         }
         _frame_unread.clear();
+        setUnreadyBytes(0);
     } else {
         throw toolkit::SockException(toolkit::Err_shutdown, "no vaild track data");
     }
@@ -217,6 +217,25 @@ protected:
      */
     virtual bool onTrackFrame(const Frame::Ptr &frame) { return false; };
 
+    /**
+     * 未就绪track缓存的帧过多被丢弃
+     * @param count 丢弃的帧数
+     * Frames cached by unready tracks are dropped because there are too many
+     * @param count Number of dropped frames
+     */
+    virtual void onDropFrames(size_t count) {};
+
+    /**
+     * 未就绪track缓存的帧字节数变化
+     * @param bytes 当前缓存的总字节数
+     * The bytes of frames cached by unready tracks changed
+     * @param bytes Total bytes currently cached
+     */
+    virtual void onUnreadyCacheChanged(size_t bytes) {};
+
+private:
+    void setUnreadyBytes(size_t bytes);
+
 private:
     /**
      * 触发onAllTrackReady事件
@@ -250,6 +269,7 @@ private:
     bool _add_mute_audio = true;
     bool _all_track_ready = false;
     size_t _max_track_size = 2;
+    size_t _frame_unread_bytes = 0;
 
     toolkit::Ticker _ticker;
     MuteAudioMaker::Ptr _mute_audio_maker;
@@ -83,6 +83,7 @@ MediaSource::MediaSource(const string &schema, const MediaTuple& tuple): _tuple(
     }
     _schema = schema;
     _create_stamp = time(NULL);
+    _metrics = std::make_shared<StreamMetrics>(_schema, _tuple.vhost, _tuple.app, _tuple.stream);
 }
 
 MediaSource::~MediaSource() {
@@ -240,6 +241,7 @@ std::shared_ptr<RtpProcess> MediaSource::getRtpProcess() const {
 }
 
 void MediaSource::onReaderChanged(int size) {
+    _metrics->set(StreamMetrics::kReaders, size);
     try {
         weak_ptr<MediaSource> weak_self = shared_from_this();
         getOwnerPoller()->async([weak_self, size]() {
@@ -251,6 +253,7 @@ void MediaSource::onReaderChanged(int size) {
             if (listener) {
                 listener->onReaderChanged(*strong_self, size);
             }
+            NOTICE_EMIT(BroadcastReaderChangedArgs, Broadcast::kBroadcastReaderChanged, *strong_self, size);
         });
     } catch (MediaSourceEvent::NotImplemented &ex) {
         // 未实现接口，应该打印异常  [AUTO-TRANSLATED:84f28c9d]
@@ -515,9 +518,42 @@ void MediaSource::regist() {
         }
         ref = shared_from_this();
     }
+    MetricsRegistry::Instance().add(_metrics);
     emitEvent(true);
 }
 
+bool MediaSource::onPacketFlush(bool gop_reset, size_t readers) {
+    auto bytes = _flush_bytes;
+    auto packets = _flush_packets;
+    _flush_bytes = 0;
+    _flush_packets = 0;
+    _metrics->add(StreamMetrics::kBytesIn, bytes);
+    _metrics->add(StreamMetrics::kPacketsIn, packets);
+    // 环形缓冲中的数据被所有读取者共享，输出量按读取者个数计算
+    // The data in the ring buffer is shared by all readers, the output is calculated by the number of readers
+    _metrics->add(StreamMetrics::kBytesOut, bytes * readers);
+    _metrics->add(StreamMetrics::kPacketsOut, packets * readers);
+    if (_flush_ingest_stamp) {
+        _metrics->addLatency(StreamMetrics::kLatencyMerge, _flush_ingest_stamp);
+        _flush_ingest_stamp = 0;
+    }
+    if (gop_reset) {
+        _gop_cache_dropped = false;
+        _metrics->set(StreamMetrics::kGopCacheBytes, bytes);
+    } else if (!_gop_cache_dropped) {
+        _metrics->add(StreamMetrics::kGopCacheBytes, (int64_t)bytes);
+    }
+    if (_gop_cache_dropped || !_metrics->overMemoryBudget()) {
+        return false;
+    }
+    // 超出内存预算，丢弃gop缓存，环形缓冲在下个关键帧前不再缓存
+    // Exceeding the memory budget, drop the gop cache, the ring buffer will not cache until the next key frame
+    _gop_cache_dropped = true;
+    _metrics->set(StreamMetrics::kGopCacheBytes, 0);
+    _metrics->add(StreamMetrics::kGopCacheDrops);
+    return true;
+}
+
 template<typename MAP, typename First, typename ...KeyTypes>
 static bool erase_media_source(bool &hit, const MediaSource *thiz, MAP &map, const First &first, const KeyTypes &...keys) {
     auto it = map.find(first);
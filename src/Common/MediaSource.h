@@ -19,6 +19,7 @@
 #include "Network/Socket.h"
 #include "Extension/Track.h"
 #include "Record/Recorder.h"
+#include "Common/MediaMetrics.h"
 
 namespace toolkit {
 class Session;
@@ -524,6 +525,9 @@ public:
     // 获取RtpProcess对象  [AUTO-TRANSLATED:c6b7da43]
     // Get the RtpProcess object
     std::shared_ptr<RtpProcess> getRtpProcess() const;
+    // 获取流统计计数器
+    // Get the statistic counters of the stream
+    const StreamMetrics::Ptr &getMetrics() const { return _metrics; }
 
     // //////////////static方法，查找或生成MediaSource////////////////  [AUTO-TRANSLATED:c3950036]
     // //////////////static methods, find or generate MediaSource////////////////
@@ -553,6 +557,26 @@ protected:
     // 媒体注册  [AUTO-TRANSLATED:dbf5c730]
     // Media registration
     void regist();
+    // 统计写入的数据包，只能在所属线程调用
+    // @param ingest_stamp 数据包的时延采样时间戳
+    // Count the written packet, it can only be called in the owner thread
+    // @param ingest_stamp Latency sampling timestamp of the packet
+    void onPacketWrite(size_t bytes, uint64_t ingest_stamp = 0) {
+        _flush_bytes += bytes;
+        ++_flush_packets;
+        if (ingest_stamp && !_flush_ingest_stamp) {
+            _flush_ingest_stamp = ingest_stamp;
+        }
+    }
+    // 统计刷新进环形缓冲的数据包，只能在所属线程调用
+    // @param gop_reset 环形缓冲是否清空了gop缓存
+    // @param readers 环形缓冲读取者个数
+    // Count the packets flushed into the ring buffer, it can only be called in the owner thread
+    // @param gop_reset Whether the ring buffer cleared the gop cache
+    // @param readers Number of readers of the ring buffer
+    // @return 超出内存预算，调用者需清空环形缓冲的gop缓存
+    // @return Exceeding the memory budget, the caller needs to clear the gop cache of the ring buffer
+    bool onPacketFlush(bool gop_reset, size_t readers);
 
 private:
     // 媒体注销  [AUTO-TRANSLATED:06a0630a]
@@ -567,6 +591,13 @@ protected:
     MediaTuple _tuple;
 
 private:
+    size_t _flush_bytes = 0;
+    size_t _flush_packets = 0;
+    uint64_t _flush_ingest_stamp = 0;
+    // 当前gop缓存是否因超出内存预算被丢弃
+    // Whether the current gop cache is dropped for exceeding the memory budget
+    bool _gop_cache_dropped = false;
+    StreamMetrics::Ptr _metrics;
     std::atomic_flag _owned = ATOMIC_FLAG_INIT;
     time_t _create_stamp;
     toolkit::Ticker _ticker;
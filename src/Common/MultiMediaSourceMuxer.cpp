@@ -11,6 +11,7 @@
 #include <math.h>
 #include "Common/config.h"
 #include "MultiMediaSourceMuxer.h"
+#include "PollerMonitor.h"
 
 using namespace std;
 using namespace toolkit;
@@ -39,8 +40,9 @@ public:
     // Minimum cache 100ms data
     static constexpr auto kMinCacheMS = 100;
 
-    FramePacedSender(uint32_t paced_sender_ms, OnFrame cb) {
+    FramePacedSender(uint32_t paced_sender_ms, StreamMetrics::Ptr metrics, OnFrame cb) {
         _paced_sender_ms = paced_sender_ms;
+        _metrics = std::move(metrics);
         _cb = std::move(cb);
     }
 
@@ -64,6 +66,7 @@ public:
         }
 
         _cache.emplace_back(frame->dts() + _cache_ms, Frame::getCacheAbleFrame(frame));
+        _metrics->add(StreamMetrics::kPacedBytes, (int64_t)frame->size());
         return true;
     }
 
@@ -80,6 +83,7 @@ private:
             }
             // 时间到了，该消费frame了  [AUTO-TRANSLATED:2f007931]
             // Time is up, it's time to consume the frame
+            _metrics->add(StreamMetrics::kPacedBytes, -(int64_t)front.second->size());
             _cb(front.second);
             _cache.pop_front();
         }
@@ -97,6 +101,7 @@ private:
             WarnL << "Flush frame paced sender cache: " << _cache.size();
             while (!_cache.empty()) {
                 auto &front = _cache.front();
+                _metrics->add(StreamMetrics::kPacedBytes, -(int64_t)front.second->size());
                 _cb(front.second);
                 _cache.pop_front();
             }
@@ -116,6 +121,7 @@ private:
     uint32_t _cache_ms = kMinCacheMS;
     uint64_t _stamp_offset = 0;
     OnFrame _cb;
+    StreamMetrics::Ptr _metrics;
     Ticker _ticker;
     Timer::Ptr _timer;
     std::recursive_mutex _mtx;
@@ -195,6 +201,8 @@ MultiMediaSourceMuxer::MultiMediaSourceMuxer(const MediaTuple& tuple, float dur_
         // Support replacing stream_id in on_publish hook
         _tuple.stream = option.stream_replace;
     }
+    _metrics = std::make_shared<StreamMetrics>("", _tuple.vhost, _tuple.app, _tuple.stream);
+    MetricsRegistry::Instance().add(_metrics);
     _poller = EventPollerPool::Instance().getPoller();
     _create_in_poller = _poller->isCurrentThread();
     _option = option;
@@ -222,6 +230,40 @@ MultiMediaSourceMuxer::MultiMediaSourceMuxer(const MediaTuple& tuple, float dur_
     if (option.enable_fmp4) {
         _fmp4 = dynamic_pointer_cast<FMP4MediaSourceMuxer>(Recorder::createRecorder(Recorder::type_fmp4, _tuple, option));
     }
+    GET_CONFIG(bool, unified_gop_cache, General::kUnifiedGopCache);
+    if (unified_gop_cache && (_rtmp || _ts)) {
+        // 只保留一份帧级别gop，rtmp/ts新播放器的gop按需打包；
+        // fmp4重新打包的切片tfdt与序号会从头开始，与直播切片时间线不连续，因此仍保留自身gop缓存
+        // Only keep one frame level gop, the gop of new rtmp/ts players is packetized on demand;
+        // fmp4 keeps its own gop cache because re-packetized fragments restart tfdt and sequence numbers,
+        // which breaks the timeline with the live fragments
+        _gop_cache = std::make_shared<FrameGopCache>(_metrics);
+        if (_rtmp) {
+            _rtmp->setGopCache(_gop_cache);
+        }
+        if (_ts) {
+            _ts->setGopCache(_gop_cache);
+        }
+    }
+    if (_ts && _hls) {
+        // http-ts与hls同时开启时，只做一次ts封装，生成的ts数据按引用分发
+        // When http-ts and hls are both enabled, mux ts only once and distribute the generated ts data by reference
+        _ts_share_ts = true;
+        _hls_share_ts = true;
+        // 共享时两者不再各自创建封装上下文
+        // While sharing, neither creates its own mux context
+        _ts->disableMux();
+        _hls->disableMux();
+        _ts_shared = std::make_shared<SharedMpegMuxer>();
+        _ts_shared->setOnOutput([this](const std::shared_ptr<Buffer> &buffer, uint64_t timestamp, bool key_pos) {
+            if (_ts && _ts_share_ts) {
+                _ts->inputMpegData(buffer, timestamp, key_pos);
+            }
+            if (_hls && _hls_share_ts) {
+                _hls->inputMpegData(buffer, timestamp, key_pos);
+            }
+        });
+    }
 
     // 音频相关设置  [AUTO-TRANSLATED:6ee58d57]
     // Audio related settings
@@ -321,6 +363,7 @@ bool MultiMediaSourceMuxer::setupRecord(MediaSource &sender, Recorder::type type
                 // 停止录制  [AUTO-TRANSLATED:3dee9292]
                 // Stop recording
                 _hls = nullptr;
+                _hls_share_ts = false;
             }
             return true;
         }
@@ -378,6 +421,7 @@ bool MultiMediaSourceMuxer::setupRecord(MediaSource &sender, Recorder::type type
                 _ts = ts;
             } else if (!start && _ts) {
                 _ts = nullptr;
+                _ts_share_ts = false;
             }
             return true;
         }
@@ -519,6 +563,9 @@ bool MultiMediaSourceMuxer::onTrackReady(const Track::Ptr &track) {
     if (_ts) {
         ret = _ts->addTrack(track) ? true : ret;
     }
+    if (_ts_shared) {
+        _ts_shared->addTrack(track);
+    }
     if (_fmp4) {
         ret = _fmp4->addTrack(track) ? true : ret;
     }
@@ -539,7 +586,7 @@ void MultiMediaSourceMuxer::onAllTrackReady() {
 
     if (_option.paced_sender_ms) {
         std::weak_ptr<MultiMediaSourceMuxer> weak_self = shared_from_this();
-        _paced_sender = std::make_shared<FramePacedSender>(_option.paced_sender_ms, [weak_self](const Frame::Ptr &frame) {
+        _paced_sender = std::make_shared<FramePacedSender>(_option.paced_sender_ms, _metrics, [weak_self](const Frame::Ptr &frame) {
             if (auto strong_self = weak_self.lock()) {
                 strong_self->onTrackFrame_l(frame);
             }
@@ -557,6 +604,9 @@ void MultiMediaSourceMuxer::onAllTrackReady() {
     if (_ts) {
         _ts->addTrackCompleted();
     }
+    if (_ts_shared) {
+        _ts_shared->addTrackCompleted();
+    }
     if (_mp4) {
         _mp4->addTrackCompleted();
     }
@@ -569,6 +619,9 @@ void MultiMediaSourceMuxer::onAllTrackReady() {
     if (_hls_fmp4) {
         _hls_fmp4->addTrackCompleted();
     }
+    if (_gop_cache) {
+        _gop_cache->setTracks(getTracks());
+    }
 
     auto listener = _track_listener.lock();
     if (listener) {
@@ -622,6 +675,9 @@ void MultiMediaSourceMuxer::resetTracks() {
     if (_ts) {
         _ts->resetTracks();
     }
+    if (_ts_shared) {
+        _ts_shared->resetTracks();
+    }
     if (_fmp4) {
         _fmp4->resetTracks();
     }
@@ -634,6 +690,9 @@ void MultiMediaSourceMuxer::resetTracks() {
     if (_mp4) {
         _mp4->resetTracks();
     }
+    if (_gop_cache) {
+        _gop_cache->clear();
+    }
 }
 
 bool MultiMediaSourceMuxer::onTrackFrame(const Frame::Ptr &frame_in) {
@@ -643,26 +702,55 @@ bool MultiMediaSourceMuxer::onTrackFrame(const Frame::Ptr &frame_in) {
         // Timestamp does not use the original absolute timestamp
         frame = std::make_shared<FrameStamp>(frame, _stamps[frame->getIndex()], _option.modify_stamp);
     }
+    GET_CONFIG(uint32_t, latency_sample_interval, General::kLatencySampleInterval);
+    if (latency_sample_interval && ++_latency_sample_count % latency_sample_interval == 0) {
+        // 采样该帧的时延，时间戳随帧进入平滑发送缓存
+        // Sample the latency of this frame, the timestamp goes into the paced sender cache with the frame
+        frame->setIngestStamp(LatencyTracer::now());
+    }
     return _paced_sender ? _paced_sender->inputFrame(frame) : onTrackFrame_l(frame);
 }
 
+void MultiMediaSourceMuxer::onDropFrames(size_t count) {
+    _metrics->add(StreamMetrics::kDrops, count);
+}
+
+void MultiMediaSourceMuxer::onUnreadyCacheChanged(size_t bytes) {
+    _metrics->set(StreamMetrics::kUnreadyBytes, bytes);
+}
+
 bool MultiMediaSourceMuxer::onTrackFrame_l(const Frame::Ptr &frame_in) {
     auto frame = frame_in;
     bool ret = false;
+    // 封装期间生成的rtp/rtmp包携带该帧的采样时间戳
+    // The rtp/rtmp packets generated during muxing carry the sampled timestamp of this frame
+    LatencyTracer::Scope latency_scope(frame->ingestStamp());
+    PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginMux, _tuple);
+    switch (frame->getTrackType()) {
+        case TrackVideo: _metrics->add(StreamMetrics::kVideoFrames); break;
+        case TrackAudio: _metrics->add(StreamMetrics::kAudioFrames); break;
+        default: break;
+    }
     if (_rtmp) {
         ret = _rtmp->inputFrame(frame) ? true : ret;
     }
     if (_rtsp) {
         ret = _rtsp->inputFrame(frame) ? true : ret;
     }
-    if (_ts) {
+    if (_ts && !_ts_share_ts) {
         ret = _ts->inputFrame(frame) ? true : ret;
     }
 
-    if (_hls) {
+    if (_hls && !_hls_share_ts) {
         ret = _hls->inputFrame(frame) ? true : ret;
     }
 
+    if (_ts_shared && ((_ts && _ts_share_ts && _ts->isEnabled()) || (_hls && _hls_share_ts && _hls->isEnabled()))) {
+        // 有消费者需要时才封装共享ts
+        // Mux the shared ts only when some consumer needs it
+        ret = _ts_shared->inputFrame(frame) ? true : ret;
+    }
+
     if (_hls_fmp4) {
         ret = _hls_fmp4->inputFrame(frame) ? true : ret;
     }
@@ -673,6 +761,12 @@ bool MultiMediaSourceMuxer::onTrackFrame_l(const Frame::Ptr &frame_in) {
     if (_fmp4) {
         ret = _fmp4->inputFrame(frame) ? true : ret;
     }
+    if (_gop_cache) {
+        // 与_ring共用同一个可缓存帧
+        // Share the same cacheable frame with _ring
+        frame = Frame::getCacheAbleFrame(frame);
+        _gop_cache->inputFrame(frame);
+    }
     if (_ring) {
         // 此场景由于直接转发，可能存在切换线程引起的数据被缓存在管道，所以需要CacheAbleFrame  [AUTO-TRANSLATED:528afbb7]
         // In this scenario, due to direct forwarding, there may be data cached in the pipeline due to thread switching, so CacheAbleFrame is needed
@@ -22,6 +22,7 @@
 #include "Rtmp/RtmpMediaSourceMuxer.h"
 #include "TS/TSMediaSourceMuxer.h"
 #include "FMP4/FMP4MediaSourceMuxer.h"
+#include "Common/FrameGopCache.h"
 
 namespace mediakit {
 
@@ -191,6 +192,12 @@ public:
     std::shared_ptr<MultiMediaSourceMuxer> getMuxer(MediaSource &sender) const override;
 
     const ProtocolOption &getOption() const;
+
+    /**
+     * 帧数、丢帧与缓存字节数统计
+     * Statistics of frames, dropped frames and cached bytes
+     */
+    const StreamMetrics::Ptr &getMetrics() const { return _metrics; }
     const MediaTuple &getMediaTuple() const;
     std::string shortUrl() const;
 
@@ -229,6 +236,8 @@ protected:
      */
     bool onTrackFrame(const Frame::Ptr &frame) override;
     bool onTrackFrame_l(const Frame::Ptr &frame);
+    void onDropFrames(size_t count) override;
+    void onUnreadyCacheChanged(size_t bytes) override;
 
 private:
     void createGopCacheIfNeed();
@@ -250,9 +259,21 @@ private:
     RtmpMediaSourceMuxer::Ptr _rtmp;
     RtspMediaSourceMuxer::Ptr _rtsp;
     TSMediaSourceMuxer::Ptr _ts;
+    // http-ts与hls共享同一个ts封装，避免重复封装
+    // http-ts and hls share the same ts muxer to avoid muxing twice
+    SharedMpegMuxer::Ptr _ts_shared;
+    bool _ts_share_ts = false;
+    bool _hls_share_ts = false;
     MediaSinkInterface::Ptr _mp4;
     HlsRecorder::Ptr _hls;
     HlsFMP4Recorder::Ptr _hls_fmp4;
+    // 统一gop缓存，为空时各协议自行缓存gop
+    // Unified gop cache, each protocol caches its own gop when it is null
+    FrameGopCache::Ptr _gop_cache;
+    // 帧数、丢帧与缓存字节数统计
+    // Statistics of frames, dropped frames and cached bytes
+    StreamMetrics::Ptr _metrics;
+    size_t _latency_sample_count = 0;
     toolkit::EventPoller::Ptr _poller;
     RingType::Ptr _ring;
 
@@ -0,0 +1,233 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include "PollerMonitor.h"
+#include "Common/config.h"
+#include "Util/util.h"
+#include "Thread/WorkThreadPool.h"
+
+using namespace std;
+using namespace toolkit;
+
+namespace mediakit {
+
+// 每个线程保留的最慢任务个数
+// Number of the slowest tasks kept for each thread
+static constexpr size_t kMaxSlowTasks = 10;
+// 最慢任务的统计窗口，单位秒
+// Statistic window of the slowest tasks, in seconds
+static constexpr time_t kSlowTaskWindowSec = 60;
+
+// 当前线程的监控数据，未被监控的线程为nullptr；强引用保证线程存活期间TaskTracer使用的指针有效
+// Monitoring data of the current thread, nullptr for threads not monitored;
+// the strong reference keeps the pointer used by TaskTracer valid while the thread is alive
+static thread_local PollerMonitor::Stats::Ptr s_stats;
+static thread_local int s_task_depth = 0;
+
+const char *PollerMonitor::getOriginName(Origin origin) {
+    switch (origin) {
+        case kOriginHook: return "hook";
+        case kOriginApi: return "api";
+        case kOriginDemux: return "demux";
+        case kOriginMux: return "mux";
+        case kOriginSend: return "send";
+        default: return "invalid";
+    }
+}
+
+void PollerMonitor::Stats::addSlowTask(Origin origin, const function<string()> &get_label, uint64_t cost_us) {
+    auto now = time(nullptr);
+    lock_guard<mutex> lck(_mtx);
+    _slow_tasks.erase(remove_if(_slow_tasks.begin(), _slow_tasks.end(), [&](const SlowTask &task) { return now - task.stamp > kSlowTaskWindowSec; }),
+                      _slow_tasks.end());
+    _slow_tasks.emplace_back(SlowTask { origin, get_label(), cost_us, now });
+    sort(_slow_tasks.begin(), _slow_tasks.end(), [](const SlowTask &a, const SlowTask &b) { return a.cost_us > b.cost_us; });
+    if (_slow_tasks.size() > kMaxSlowTasks) {
+        _slow_tasks.resize(kMaxSlowTasks);
+    }
+    // 列表满后只有更慢的任务才需要加锁
+    // After the list is full, only slower tasks need to lock
+    _min_slow_cost = _slow_tasks.size() < kMaxSlowTasks ? 0 : _slow_tasks.back().cost_us;
+}
+
+vector<PollerMonitor::SlowTask> PollerMonitor::Stats::getSlowTasks() {
+    auto now = time(nullptr);
+    lock_guard<mutex> lck(_mtx);
+    _slow_tasks.erase(remove_if(_slow_tasks.begin(), _slow_tasks.end(), [&](const SlowTask &task) { return now - task.stamp > kSlowTaskWindowSec; }),
+                      _slow_tasks.end());
+    _min_slow_cost = _slow_tasks.size() < kMaxSlowTasks ? 0 : _slow_tasks.back().cost_us;
+    return _slow_tasks;
+}
+
+PollerMonitor::TaskTracer::TaskTracer(Origin origin, const string &label) {
+    _label = &label;
+    start(origin);
+}
+
+PollerMonitor::TaskTracer::TaskTracer(Origin origin, const MediaTuple &tuple) {
+    _tuple = &tuple;
+    start(origin);
+}
+
+void PollerMonitor::TaskTracer::start(Origin origin) {
+    _origin = origin;
+    if (!s_stats) {
+        return;
+    }
+    if (s_task_depth++ == 0) {
+        _stats = s_stats.get();
+        _start = LatencyTracer::now();
+    }
+}
+
+PollerMonitor::TaskTracer::~TaskTracer() {
+    if (!s_stats) {
+        return;
+    }
+    --s_task_depth;
+    if (!_stats) {
+        return;
+    }
+    auto cost = LatencyTracer::now() - _start;
+    _stats->task_cost[_origin].add(cost);
+    if (_stats->isSlowTask(cost)) {
+        // 只有进入最慢任务列表时才生成标签
+        // The label is only generated when entering the slowest task list
+        _stats->addSlowTask(_origin, [this]() { return _tuple ? _tuple->shortUrl() : *_label; }, cost);
+    }
+}
+
+PollerMonitor &PollerMonitor::Instance() {
+    static PollerMonitor s_instance;
+    return s_instance;
+}
+
+void PollerMonitor::start() {
+    GET_CONFIG(uint32_t, interval_ms, General::kPollerMonitorMS);
+    if (!interval_ms) {
+        return;
+    }
+    {
+        lock_guard<mutex> lck(_mtx);
+        _interval_ms = interval_ms;
+    }
+    auto on_executor = [&](const TaskExecutor::Ptr &executor) {
+        if (auto poller = dynamic_pointer_cast<EventPoller>(executor)) {
+            startPoller(poller);
+        }
+    };
+    EventPollerPool::Instance().for_each(on_executor);
+    WorkThreadPool::Instance().for_each(on_executor);
+}
+
+void PollerMonitor::addPoller(const EventPoller::Ptr &poller) {
+    if (poller) {
+        startPoller(poller);
+    }
+}
+
+void PollerMonitor::startPoller(const EventPoller::Ptr &poller) {
+    uint64_t interval_ms;
+    {
+        lock_guard<mutex> lck(_mtx);
+        interval_ms = _interval_ms;
+        if (!interval_ms) {
+            return;
+        }
+        for (auto &item : _items) {
+            if (item.poller.lock() == poller) {
+                return;
+            }
+        }
+        // 先占位防止重复注册，监控数据在该线程内创建后补上
+        // Take the place first to prevent duplicate registration, the monitoring data is filled in after being created in the thread
+        _items.emplace_back(Item { poller, nullptr });
+    }
+    std::weak_ptr<EventPoller> weak_poller = poller;
+    poller->async([this, weak_poller, interval_ms]() {
+        auto stats = std::make_shared<Stats>(getThreadName());
+        s_stats = stats;
+        {
+            lock_guard<mutex> lck(_mtx);
+            auto poller = weak_poller.lock();
+            for (auto &item : _items) {
+                if (!item.stats && item.poller.lock() == poller) {
+                    item.stats = stats;
+                    break;
+                }
+            }
+        }
+        auto expected = std::make_shared<uint64_t>(LatencyTracer::now() + interval_ms * 1000);
+        EventPoller::getCurrentPoller()->doDelayTask(interval_ms, [stats, expected, interval_ms]() {
+            auto now = LatencyTracer::now();
+            stats->timer_lateness.add(now > *expected ? now - *expected : 0);
+            *expected = now + interval_ms * 1000;
+            // 顺便清理过期的慢任务，使阈值及时降低
+            // Clean up expired slow tasks by the way, so that the threshold decreases in time
+            stats->getSlowTasks();
+            // 投递任务检测任务队列等待时间
+            // Post a task to detect the waiting time of the task queue
+            EventPoller::getCurrentPoller()->async([stats, now]() { stats->queue_delay.add(LatencyTracer::now() - now); }, false);
+            return interval_ms;
+        });
+    }, false);
+}
+
+vector<PollerMonitor::Stats::Ptr> PollerMonitor::getStats() {
+    vector<Stats::Ptr> ret;
+    lock_guard<mutex> lck(_mtx);
+    _items.erase(remove_if(_items.begin(), _items.end(), [](const Item &item) { return item.poller.expired(); }), _items.end());
+    ret.reserve(_items.size());
+    for (auto &item : _items) {
+        if (item.stats) {
+            ret.emplace_back(item.stats);
+        }
+    }
+    return ret;
+}
+
+void PollerMonitor::dump(string &out) {
+    auto all = getStats();
+    if (all.empty()) {
+        return;
+    }
+    auto poller_label = [](const Stats &stats) {
+        string ret = "poller=\"";
+        for (auto ch : stats.name) {
+            if (ch == '"' || ch == '\\') {
+                ret.push_back('\\');
+            }
+            ret.push_back(ch);
+        }
+        ret.push_back('"');
+        return ret;
+    };
+
+    MetricsRegistry::appendHeader(out, "zlm_poller_queue_delay_seconds", "histogram", "Waiting time of posted tasks in the task queue of each poller.");
+    for (auto &stats : all) {
+        MetricsRegistry::appendHistogram(out, "zlm_poller_queue_delay_seconds", poller_label(*stats), stats->queue_delay);
+    }
+
+    MetricsRegistry::appendHeader(out, "zlm_poller_timer_lateness_seconds", "histogram", "Lateness of timers of each poller.");
+    for (auto &stats : all) {
+        MetricsRegistry::appendHistogram(out, "zlm_poller_timer_lateness_seconds", poller_label(*stats), stats->timer_lateness);
+    }
+
+    MetricsRegistry::appendHeader(out, "zlm_poller_task_seconds", "histogram", "Execution time of tasks of each poller by origin.");
+    for (auto &stats : all) {
+        for (int i = 0; i < kOriginMax; ++i) {
+            auto labels = poller_label(*stats) + ",origin=\"" + getOriginName((Origin)i) + "\"";
+            MetricsRegistry::appendHistogram(out, "zlm_poller_task_seconds", labels, stats->task_cost[i]);
+        }
+    }
+}
+
+} // namespace mediakit
@@ -0,0 +1,149 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_POLLERMONITOR_H
+#define ZLMEDIAKIT_POLLERMONITOR_H
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Common/MediaSource.h"
+
+namespace mediakit {
+
+/**
+ * 事件循环线程监控
+ * 定时器检测各线程的定时器延迟与任务队列等待时间，并统计各类任务的执行耗时与最慢的任务
+ * Event loop thread monitor
+ * Timers detect the timer lateness and task queue waiting time of each thread,
+ * and count the execution time of each kind of task and the slowest tasks
+ */
+class PollerMonitor {
+public:
+    enum Origin {
+        kOriginHook = 0,
+        kOriginApi,
+        kOriginDemux,
+        kOriginMux,
+        kOriginSend,
+        kOriginMax
+    };
+
+    static const char *getOriginName(Origin origin);
+
+    struct SlowTask {
+        Origin origin;
+        std::string label;
+        uint64_t cost_us;
+        time_t stamp;
+    };
+
+    class Stats {
+    public:
+        using Ptr = std::shared_ptr<Stats>;
+
+        Stats(std::string name) : name(std::move(name)) {}
+
+        // 是否可能进入最慢任务列表，无需加锁
+        // Whether it may enter the slowest task list, no lock required
+        bool isSlowTask(uint64_t cost_us) const { return cost_us >= _min_slow_cost.load(std::memory_order_relaxed); }
+        void addSlowTask(Origin origin, const std::function<std::string()> &get_label, uint64_t cost_us);
+        std::vector<SlowTask> getSlowTasks();
+
+    public:
+        std::string name;
+        // 投递的任务从入队到执行的等待时间
+        // Waiting time of the posted task from enqueue to execution
+        LatencyHistogram queue_delay;
+        // 定时器实际触发时间与预期时间的差值
+        // Difference between the actual trigger time and the expected time of the timer
+        LatencyHistogram timer_lateness;
+        LatencyHistogram task_cost[kOriginMax];
+
+    private:
+        std::mutex _mtx;
+        std::atomic<uint64_t> _min_slow_cost { 0 };
+        std::vector<SlowTask> _slow_tasks;
+    };
+
+    /**
+     * 统计作用域内任务的执行耗时，嵌套时只统计最外层，未开启监控或不在被监控线程时无开销
+     * Count the execution time of the task in the scope, only the outermost one is counted when nested,
+     * no overhead when the monitor is disabled or not in a monitored thread
+     */
+    class TaskTracer {
+    public:
+        TaskTracer(Origin origin, const std::string &label);
+        TaskTracer(Origin origin, const MediaTuple &tuple);
+        ~TaskTracer();
+
+    private:
+        void start(Origin origin);
+
+    private:
+        Origin _origin;
+        uint64_t _start = 0;
+        const std::string *_label = nullptr;
+        const MediaTuple *_tuple = nullptr;
+        // 由线程局部的强引用保活，作用域内有效
+        // Kept alive by the thread local strong reference, valid within the scope
+        Stats *_stats = nullptr;
+    };
+
+    static PollerMonitor &Instance();
+
+    /**
+     * 按配置开始监控所有网络线程与后台工作线程，只能调用一次
+     * 两个线程池在创建后线程数固定；之后自行创建的EventPoller不会被自动覆盖，需调用addPoller注册
+     * Start monitoring all network threads and background work threads according to the configuration, it can only be called once
+     * The thread count of both pools is fixed after creation; EventPollers created by yourself afterwards are not covered
+     * automatically and must be registered by addPoller
+     */
+    void start();
+
+    /**
+     * 注册监控一个事件循环线程，重复注册将被忽略，未开启监控时无效
+     * Register an event loop thread to be monitored, duplicate registration is ignored, no effect when the monitor is disabled
+     */
+    void addPoller(const toolkit::EventPoller::Ptr &poller);
+
+    /**
+     * 获取仍存活线程的监控数据，已销毁线程的数据在此时被移除
+     * Get the monitoring data of threads still alive, the data of destroyed threads is removed at this time
+     */
+    std::vector<Stats::Ptr> getStats();
+
+    /**
+     * 输出OpenMetrics格式的监控数据
+     * Output the monitoring data in OpenMetrics format
+     */
+    void dump(std::string &out);
+
+private:
+    struct Item {
+        // 不延长线程生命周期，线程销毁后其监控数据随之移除
+        // Does not extend the lifetime of the thread, its monitoring data is removed after the thread is destroyed
+        std::weak_ptr<toolkit::EventPoller> poller;
+        Stats::Ptr stats;
+    };
+
+    PollerMonitor() = default;
+    void startPoller(const toolkit::EventPoller::Ptr &poller);
+
+private:
+    uint64_t _interval_ms = 0;
+    std::mutex _mtx;
+    std::vector<Item> _items;
+};
+
+} // namespace mediakit
+#endif // ZLMEDIAKIT_POLLERMONITOR_H
@@ -0,0 +1,56 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "SlowReaderGuard.h"
+#include "Common/config.h"
+#include "Util/logger.h"
+
+using namespace toolkit;
+
+namespace mediakit {
+
+bool SlowReaderGuard::checkSlowReader(bool gop_start, bool socket_busy, size_t packets) {
+    GET_CONFIG(uint32_t, slow_reader_ms, General::kSlowReaderMS);
+    if (!slow_reader_ms) {
+        return true;
+    }
+    if (!socket_busy) {
+        _busy = false;
+    } else if (!_busy) {
+        // 开始计算不可写时长
+        // Start counting the unwritable duration
+        _busy = true;
+        _busy_ticker.resetTime();
+    }
+
+    if (_skipping) {
+        if (gop_start && !socket_busy) {
+            // socket已经可写，从关键帧恢复发送
+            // The socket is writable again, resume sending from the key frame
+            _skipping = false;
+            return true;
+        }
+        _drop_count += packets;
+        return false;
+    }
+
+    if (_busy && _busy_ticker.elapsedTime() > slow_reader_ms) {
+        // 播放器落后太多，丢弃数据直到下个关键帧
+        // The player falls too far behind, drop data until the next key frame
+        _skipping = true;
+        ++_skip_count;
+        _drop_count += packets;
+        WarnL << "Slow reader detected, skip to next key frame, skips: " << _skip_count << ", drops: " << _drop_count;
+        return false;
+    }
+    return true;
+}
+
+} // namespace mediakit
@@ -0,0 +1,68 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_SLOWREADERGUARD_H
+#define ZLMEDIAKIT_SLOWREADERGUARD_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Util/TimeTicker.h"
+
+namespace mediakit {
+
+/**
+ * 慢速播放器检测
+ * socket持续不可写超过general.slow_reader_ms时，丢弃环形缓冲后续数据直到下个可以开始播放的位置(关键帧)，
+ * 防止数据在会话发送缓存中无限堆积；播放会话继承本类，丢弃统计可通过getMediaPlayerList接口获取
+ * Slow reader detection
+ * When the socket keeps unwritable for more than general.slow_reader_ms, the subsequent data of the ring buffer is dropped
+ * until the next position that playback can start from (key frame), preventing data from piling up in the send buffer of the session;
+ * player sessions inherit this class, the drop statistics can be got by the getMediaPlayerList api
+ */
+class SlowReaderGuard {
+public:
+    virtual ~SlowReaderGuard() = default;
+
+    /**
+     * 收到环形缓冲的一批数据时调用
+     * @param gop_start 该批数据是否从可以开始播放的位置开始
+     * @param socket_busy socket是否不可写
+     * @param packets 该批数据包个数
+     * @return 是否发送该批数据
+     * Called when a batch of data of the ring buffer is received
+     * @param gop_start Whether the batch starts from a position that playback can start from
+     * @param socket_busy Whether the socket is unwritable
+     * @param packets Number of packets of the batch
+     * @return Whether to send the batch
+     */
+    bool checkSlowReader(bool gop_start, bool socket_busy, size_t packets);
+
+    /**
+     * 跳到关键帧的次数
+     * Times of skipping to the key frame
+     */
+    uint64_t getSkipCount() const { return _skip_count; }
+
+    /**
+     * 丢弃的数据包个数
+     * Number of dropped packets
+     */
+    uint64_t getDropCount() const { return _drop_count; }
+
+private:
+    bool _busy = false;
+    bool _skipping = false;
+    uint64_t _skip_count = 0;
+    uint64_t _drop_count = 0;
+    toolkit::Ticker _busy_ticker;
+};
+
+} // namespace mediakit
+#endif // ZLMEDIAKIT_SLOWREADERGUARD_H
@@ -67,6 +67,7 @@ ZLMEDIAKIT_API const string kBroadcastRtcSctpClosed = "kBroadcastRtcSctpClosed";
 ZLMEDIAKIT_API const string kBroadcastRtcSctpSend = "kBroadcastRtcSctpSend";
 ZLMEDIAKIT_API const string kBroadcastRtcSctpReceived = "kBroadcastRtcSctpReceived";
 ZLMEDIAKIT_API const string kBroadcastPlayerCountChanged = "kBroadcastPlayerCountChanged";
+ZLMEDIAKIT_API const string kBroadcastReaderChanged = "kBroadcastReaderChanged";
 
 } // namespace Broadcast
 
@@ -89,6 +90,14 @@ ZLMEDIAKIT_API const string kWaitAddTrackMS = GENERAL_FIELD "wait_add_track_ms";
 ZLMEDIAKIT_API const string kUnreadyFrameCache = GENERAL_FIELD "unready_frame_cache";
 ZLMEDIAKIT_API const string kBroadcastPlayerCountChanged = GENERAL_FIELD "broadcast_player_count_changed";
 ZLMEDIAKIT_API const string kListenIP = GENERAL_FIELD "listen_ip";
+ZLMEDIAKIT_API const string kFastTsMuxer = GENERAL_FIELD "fast_ts_muxer";
+ZLMEDIAKIT_API const string kUnifiedGopCache = GENERAL_FIELD "unified_gop_cache";
+ZLMEDIAKIT_API const string kLatencySampleInterval = GENERAL_FIELD "latency_sample_interval";
+ZLMEDIAKIT_API const string kPollerMonitorMS = GENERAL_FIELD "poller_monitor_ms";
+ZLMEDIAKIT_API const string kStreamMemoryBudgetMB = GENERAL_FIELD "stream_memory_budget_mb";
+ZLMEDIAKIT_API const string kMemoryBudgetMB = GENERAL_FIELD "memory_budget_mb";
+ZLMEDIAKIT_API const string kSlowReaderMS = GENERAL_FIELD "slow_reader_ms";
+ZLMEDIAKIT_API const string kAllocSampleInterval = GENERAL_FIELD "alloc_sample_interval";
 
 static onceToken token([]() {
     mINI::Instance()[kFlowThreshold] = 1024;
@@ -106,6 +115,14 @@ static onceToken token([]() {
     mINI::Instance()[kUnreadyFrameCache] = 100;
     mINI::Instance()[kBroadcastPlayerCountChanged] = 0;
     mINI::Instance()[kListenIP] = "::";
+    mINI::Instance()[kFastTsMuxer] = 0;
+    mINI::Instance()[kUnifiedGopCache] = 0;
+    mINI::Instance()[kLatencySampleInterval] = 0;
+    mINI::Instance()[kPollerMonitorMS] = 0;
+    mINI::Instance()[kStreamMemoryBudgetMB] = 0;
+    mINI::Instance()[kMemoryBudgetMB] = 0;
+    mINI::Instance()[kSlowReaderMS] = 0;
+    mINI::Instance()[kAllocSampleInterval] = 0;
 });
 
 } // namespace General
@@ -305,6 +322,8 @@ ZLMEDIAKIT_API const string kFileBufSize = RECORD_FIELD "fileBufSize";
 ZLMEDIAKIT_API const string kFastStart = RECORD_FIELD "fastStart";
 ZLMEDIAKIT_API const string kFileRepeat = RECORD_FIELD "fileRepeat";
 ZLMEDIAKIT_API const string kEnableFmp4 = RECORD_FIELD "enableFmp4";
+ZLMEDIAKIT_API const string kFmp4FragmentMS = RECORD_FIELD "fmp4FragmentMS";
+ZLMEDIAKIT_API const string kEnableMp4Index = RECORD_FIELD "enableMp4Index";
 
 static onceToken token([]() {
     mINI::Instance()[kAppName] = "record";
@@ -313,6 +332,8 @@ static onceToken token([]() {
     mINI::Instance()[kFastStart] = false;
     mINI::Instance()[kFileRepeat] = false;
     mINI::Instance()[kEnableFmp4] = false;
+    mINI::Instance()[kFmp4FragmentMS] = 2000;
+    mINI::Instance()[kEnableMp4Index] = false;
 });
 } // namespace Record
 
@@ -357,6 +378,7 @@ ZLMEDIAKIT_API const string kOpusPT = RTP_PROXY_FIELD "opus_pt";
 ZLMEDIAKIT_API const string kGopCache = RTP_PROXY_FIELD "gop_cache";
 ZLMEDIAKIT_API const string kRtpG711DurMs = RTP_PROXY_FIELD "rtp_g711_dur_ms";
 ZLMEDIAKIT_API const string kUdpRecvSocketBuffer = RTP_PROXY_FIELD "udp_recv_socket_buffer";
+ZLMEDIAKIT_API const string kDemuxInWorker = RTP_PROXY_FIELD "demux_in_worker";
 
 static onceToken token([]() {
     mINI::Instance()[kDumpDir] = "";
@@ -369,6 +391,7 @@ static onceToken token([]() {
     mINI::Instance()[kGopCache] = 1;
     mINI::Instance()[kRtpG711DurMs] = 100;
     mINI::Instance()[kUdpRecvSocketBuffer] = 4 * 1024 * 1024;
+    mINI::Instance()[kDemuxInWorker] = 0;
 });
 } // namespace RtpProxy
 
@@ -166,6 +166,11 @@ extern ZLMEDIAKIT_API const std::string kBroadcastRtcSctpReceived;
 extern ZLMEDIAKIT_API const std::string kBroadcastPlayerCountChanged;
 #define BroadcastPlayerCountChangedArgs const MediaTuple& args, const int& count
 
+// 流的观看者个数变化，在流所在的线程触发，不受general.broadcast_player_count_changed控制
+// The reader count of the stream changed, triggered in the thread of the stream, not controlled by general.broadcast_player_count_changed
+extern ZLMEDIAKIT_API const std::string kBroadcastReaderChanged;
+#define BroadcastReaderChangedArgs MediaSource &sender, const int &size
+
 #define ReloadConfigTag ((void *)(0xFF))
 #define RELOAD_KEY(arg, key)                                                                                           \
     do {                                                                                                               \
@@ -267,6 +272,40 @@ ZLMEDIAKIT_API extern const std::string kBroadcastPlayerCountChanged;
 // 绑定的本地网卡ip  [AUTO-TRANSLATED:daa90832]
 // Bound local network card ip
 ZLMEDIAKIT_API extern const std::string kListenIP;
+// mpeg-ts封装是否采用内置的零拷贝打包器(直接写入188字节对齐的池化内存块)，仅支持H264/H265/AAC，其他编码自动回退
+// Whether mpeg-ts muxing uses the built-in zero-copy packetizer (writing directly into pooled 188-byte aligned blocks),
+// only H264/H265/AAC are supported, other codecs fall back automatically
+ZLMEDIAKIT_API extern const std::string kFastTsMuxer;
+// 是否开启统一gop缓存，开启后只有帧级别缓存保留gop，rtmp/http-ts的环形缓冲只保留最新数据，
+// 新播放器的gop从帧缓存按需打包，可大幅降低多协议时每路流的内存占用；rtsp与http-fmp4仍保留自身gop缓存
+// Whether to enable unified gop cache, after enabled only the frame level cache keeps the gop, the ring buffer of rtmp/http-ts only keeps the latest data,
+// the gop of new players is packetized on demand from the frame cache, which greatly reduces the memory usage per stream with multiple protocols;
+// rtsp and http-fmp4 still keep their own gop cache
+ZLMEDIAKIT_API extern const std::string kUnifiedGopCache;
+// 帧时延采样间隔，每个流每隔多少帧采样一帧，统计其从进入MultiMediaSourceMuxer到各协议发送的时延，0为关闭
+// Frame latency sampling interval, sample one frame every how many frames of each stream,
+// count its latency from entering MultiMediaSourceMuxer to being sent by each protocol, 0 means disabled
+ZLMEDIAKIT_API extern const std::string kLatencySampleInterval;
+// 线程监控检测间隔，单位毫秒，检测定时器延迟与任务队列等待时间，并统计各类任务耗时与最慢的任务，0为关闭
+// Thread monitor detection interval, in milliseconds, detects the timer lateness and the task queue waiting time,
+// and counts the execution time of each kind of task and the slowest tasks, 0 means disabled
+ZLMEDIAKIT_API extern const std::string kPollerMonitorMS;
+// 单个流的缓存(gop缓存、未就绪帧缓存、平滑发送缓存)内存预算，单位MB，超出后丢弃gop缓存直到下个关键帧，0为不限制
+// Memory budget of the caches (gop cache, unready frame cache, paced sender cache) of a single stream, in MB,
+// the gop cache is dropped until the next key frame after exceeded, 0 means unlimited
+ZLMEDIAKIT_API extern const std::string kStreamMemoryBudgetMB;
+// 所有流的缓存内存预算，单位MB，超出后各流丢弃gop缓存直到下个关键帧，0为不限制
+// Memory budget of the caches of all streams, in MB, each stream drops the gop cache until the next key frame after exceeded,
+// 0 means unlimited
+ZLMEDIAKIT_API extern const std::string kMemoryBudgetMB;
+// 播放器socket持续不可写超过该时长(毫秒)后，丢弃数据直到下个关键帧，0为关闭
+// After the socket of the player keeps unwritable for longer than this duration (milliseconds), data is dropped until the next key frame,
+// 0 means disabled
+ZLMEDIAKIT_API extern const std::string kSlowReaderMS;
+// 内存分配采样间隔，每隔多少个帧/包等对象或缓存分配采样一个，按子系统统计分配字节数、存活字节数与分配速率，0为关闭
+// Memory allocation sampling interval, sample one every how many objects (frames, packets, etc.) or buffer allocations,
+// count the allocated bytes, live bytes and allocation rate of each subsystem, 0 means disabled
+ZLMEDIAKIT_API extern const std::string kAllocSampleInterval;
 } // namespace General
 
 namespace Protocol {
@@ -490,6 +529,12 @@ ZLMEDIAKIT_API extern const std::string kFileRepeat;
 // mp4录制文件是否采用fmp4格式  [AUTO-TRANSLATED:12559ae0]
 // Whether to use fmp4 format for MP4 recording files
 ZLMEDIAKIT_API extern const std::string kEnableFmp4;
+// fmp4录制时单个fragment最大时长，单位毫秒，0表示仅在关键帧处切分
+// Max duration of a single fragment when recording fmp4, in milliseconds, 0 means split only at keyframes
+ZLMEDIAKIT_API extern const std::string kFmp4FragmentMS;
+// mp4录制完成或首次点播时是否生成关键帧旁路索引文件(xxx.mp4.idx)，用于快速打开与seek
+// Whether to generate a keyframe sidecar index file (xxx.mp4.idx) when mp4 recording finishes or on first playback, for fast open and seek
+ZLMEDIAKIT_API extern const std::string kEnableMp4Index;
 } // namespace Record
 
 // //////////HLS相关配置///////////  [AUTO-TRANSLATED:873cc84c]
@@ -560,6 +605,9 @@ ZLMEDIAKIT_API extern const std::string kGopCache;
 ZLMEDIAKIT_API extern const std::string kRtpG711DurMs;
 // udp recv socket buffer size
 ZLMEDIAKIT_API extern const std::string kUdpRecvSocketBuffer;
+// 是否在后台线程池中解复用ps/ts，同一路流保持顺序，用于大量国标设备接入时分摊解复用开销
+// Whether to demux ps/ts in the background thread pool, the order of one stream is kept, used to spread the demux cost when a large number of GB28181 devices are connected
+ZLMEDIAKIT_API extern const std::string kDemuxInWorker;
 } // namespace RtpProxy
 
 /**
@@ -40,6 +40,7 @@ Frame::Ptr Frame::getCacheAbleFrame(const Frame::Ptr &frame){
 
 FrameStamp::FrameStamp(Frame::Ptr frame) {
     setIndex(frame->getIndex());
+    setIngestStamp(frame->ingestStamp());
     _frame = std::move(frame);
 }
 
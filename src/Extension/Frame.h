@@ -17,6 +17,7 @@
 #include "Util/List.h"
 #include "Util/TimeTicker.h"
 #include "Common/Stamp.h"
+#include "Common/AllocProfiler.h"
 #include "Network/Buffer.h"
 
 namespace mediakit {
@@ -303,7 +304,15 @@ public:
      */
     static Ptr getCacheAbleFrame(const Ptr &frame);
 
+    /**
+     * 时延采样时间戳，为0时代表未采样，参考LatencyTracer
+     * Latency sampling timestamp, 0 means not sampled, refer to LatencyTracer
+     */
+    uint64_t ingestStamp() const { return _ingest_stamp; }
+    void setIngestStamp(uint64_t stamp) { _ingest_stamp = stamp; }
+
 private:
+    uint64_t _ingest_stamp = 0;
     // 对象个数统计  [AUTO-TRANSLATED:3b43e8c2]
     // Object count statistics
     toolkit::ObjectStatistic<Frame> _statistic;
@@ -351,6 +360,9 @@ private:
     // 对象个数统计  [AUTO-TRANSLATED:3b43e8c2]
     // Object count statistics
     toolkit::ObjectStatistic<FrameImp> _statistic;
+    // 内存分配采样统计
+    // Sampled memory allocation statistics
+    AllocProfiler::Tracker _alloc_tracker { AllocProfiler::kFrame, this, [](const void *owner) { return ((const FrameImp *)owner)->_buffer.size(); } };
 
 protected:
     friend class toolkit::ResourcePool_l<FrameImp>;
@@ -508,6 +520,7 @@ public:
         _config = frame->configFrame();
         _drop_able = frame->dropAble();
         _decode_able = frame->decodeAble();
+        setIngestStamp(frame->ingestStamp());
     }
 
     /**
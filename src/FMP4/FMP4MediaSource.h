@@ -30,6 +30,9 @@ public:
 
 public:
     uint64_t time_stamp = 0;
+    // 是否为一批数据中可以开始播放的位置(视频关键帧或纯音频)，慢速播放器跳帧时使用
+    // Whether it is the position in a batch that playback can start from (video key frame or audio only), used when a slow reader skips
+    bool gop_start = false;
 };
 
 // FMP4直播源  [AUTO-TRANSLATED:15c43604]
@@ -117,6 +120,7 @@ public:
             _have_video = true;
         }
         _speed[TrackVideo] += packet->size();
+        onPacketWrite(packet->size());
         auto stamp = packet->time_stamp;
         PacketCache<FMP4Packet>::inputPacket(stamp, true, std::move(packet), key);
     }
@@ -160,7 +164,13 @@ private:
     void onFlush(std::shared_ptr<toolkit::List<FMP4Packet::Ptr> > packet_list, bool key_pos) override {
         // 如果不存在视频，那么就没有存在GOP缓存的意义，所以确保一直清空GOP缓存  [AUTO-TRANSLATED:66208f94]
         // If there is no video, then there is no meaning to the existence of GOP cache, so make sure to clear the GOP cache all the time
-        _ring->write(std::move(packet_list), _have_video ? key_pos : true);
+        auto gop_reset = _have_video ? key_pos : true;
+        packet_list->front()->gop_start = _have_video ? key_pos : true;
+        auto drop_gop = onPacketFlush(gop_reset, _ring->readerCount());
+        _ring->write(std::move(packet_list), gop_reset);
+        if (drop_gop) {
+            _ring->clearCache();
+        }
     }
 
 private:
@@ -13,6 +13,7 @@
 
 #include <string>
 #include "Network/Buffer.h"
+#include "Common/AllocProfiler.h"
 
 namespace mediakit {
 
@@ -132,6 +133,9 @@ private:
     size_t _max_cache_size = 0;
     size_t _remain_data_size = 0;
     toolkit::BufferLikeString _remain_data;
+    // 粘包缓存的内存分配采样统计
+    // Sampled memory allocation statistics of the reassembly cache
+    AllocProfiler::Tracker _alloc_tracker { AllocProfiler::kSplitterCache, this, [](const void *owner) { return ((const HttpRequestSplitter *)owner)->_remain_data.size(); } };
 };
 
 } /* namespace mediakit */
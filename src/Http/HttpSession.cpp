@@ -411,6 +411,9 @@ bool HttpSession::checkLiveStreamFMP4(const function<void()> &cb) {
                 // This object has been destroyed
                 return;
             }
+            if (!strong_self->checkSlowReader(fmp4_list->front()->gop_start, strong_self->isSocketBusy(), fmp4_list->size())) {
+                return;
+            }
             size_t i = 0;
             auto size = fmp4_list->size();
             fmp4_list->for_each([&](const FMP4Packet::Ptr &ts) { strong_self->onWrite(ts, ++i == size); });
@@ -454,17 +457,20 @@ bool HttpSession::checkLiveStreamTS(const function<void()> &cb) {
             }
             strong_self->shutdown(SockException(Err_shutdown, "ts ring buffer detached"));
         });
-        _ts_reader->setReadCB([weak_self](const TSMediaSource::RingDataType &ts_list) {
+        _ts_reader->setReadCB(ts_src->wrapReadCB([weak_self](const TSMediaSource::RingDataType &ts_list) {
             auto strong_self = weak_self.lock();
             if (!strong_self) {
                 // 本对象已经销毁  [AUTO-TRANSLATED:713e0f23]
                 // This object has been destroyed
                 return;
             }
+            if (!strong_self->checkSlowReader(ts_list->front()->gop_start, strong_self->isSocketBusy(), ts_list->size())) {
+                return;
+            }
             size_t i = 0;
             auto size = ts_list->size();
             ts_list->for_each([&](const TSPacket::Ptr &ts) { strong_self->onWrite(ts, ++i == size); });
-        });
+        }));
     });
 }
 
@@ -891,6 +897,10 @@ void HttpSession::onDetach() {
     shutdown(SockException(Err_shutdown, "rtmp ring buffer detached"));
 }
 
+bool HttpSession::onCheckSlowReader(bool gop_start, size_t packets) {
+    return checkSlowReader(gop_start, isSocketBusy(), packets);
+}
+
 std::shared_ptr<FlvMuxer> HttpSession::getSharedPtr() {
     return dynamic_pointer_cast<FlvMuxer>(shared_from_this());
 }
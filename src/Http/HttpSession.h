@@ -20,13 +20,15 @@
 #include "HttpFileManager.h"
 #include "TS/TSMediaSource.h"
 #include "FMP4/FMP4MediaSource.h"
+#include "Common/SlowReaderGuard.h"
 
 namespace mediakit {
 
 class HttpSession: public toolkit::Session,
                    public FlvMuxer,
                    public HttpRequestSplitter,
-                   public WebSocketSplitter {
+                   public WebSocketSplitter,
+                   public SlowReaderGuard {
 public:
     using Ptr = std::shared_ptr<HttpSession>;
     using KeyValue = StrCaseMap;
@@ -57,6 +59,7 @@ protected:
     void onWrite(const toolkit::Buffer::Ptr &data, bool flush) override ;
     void onDetach() override;
     std::shared_ptr<FlvMuxer> getSharedPtr() override;
+    bool onCheckSlowReader(bool gop_start, size_t packets) override;
 
     //HttpRequestSplitter override
     ssize_t onRecvHeader(const char *data,size_t len) override;
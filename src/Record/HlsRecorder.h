@@ -58,14 +58,7 @@ public:
     }
 
     bool inputFrame(const Frame::Ptr &frame) override {
-        if (_clear_cache && _option.hls_demand) {
-            _clear_cache = false;
-            // 清空旧的m3u8索引文件于ts切片  [AUTO-TRANSLATED:a4ce0664]
-            // Clear the old m3u8 index file and ts slices
-            _hls->clearCache();
-            _hls->getMediaSource()->setIndexFile("");
-        }
-        if (_enabled || !_option.hls_demand) {
+        if (checkEnabled()) {
             return Muxer::inputFrame(frame);
         }
         return false;
@@ -77,6 +70,18 @@ public:
         return _option.hls_demand ? (_clear_cache ? true : _enabled) : true;
     }
 
+protected:
+    bool checkEnabled() {
+        if (_clear_cache && _option.hls_demand) {
+            _clear_cache = false;
+            // 清空旧的m3u8索引文件于ts切片  [AUTO-TRANSLATED:a4ce0664]
+            // Clear the old m3u8 index file and ts slices
+            _hls->clearCache();
+            _hls->getMediaSource()->setIndexFile("");
+        }
+        return _enabled || !_option.hls_demand;
+    }
+
 protected:
     bool _enabled = true;
     bool _clear_cache = false;
@@ -97,6 +102,16 @@ public:
         }
     }
 
+    /**
+     * 输入共享ts封装(SharedMpegMuxer)产生的ts数据，按引用切片
+     * Input ts data generated by the shared ts muxer (SharedMpegMuxer), segmented by reference
+     */
+    void inputMpegData(const std::shared_ptr<toolkit::Buffer> &buffer, uint64_t timestamp, bool key_pos) {
+        if (!buffer || checkEnabled()) {
+            onWrite(buffer, timestamp, key_pos);
+        }
+    }
+
 private:
     void onWrite(std::shared_ptr<toolkit::Buffer> buffer, uint64_t timestamp, bool key_pos) override {
         if (!buffer) {
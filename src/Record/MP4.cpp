@@ -117,6 +117,12 @@ void MP4FileDisk::closeFile() {
     _file = nullptr;
 }
 
+void MP4FileDisk::flushFile() {
+    if (_file) {
+        fflush(_file.get());
+    }
+}
+
 int MP4FileDisk::onRead(void *data, size_t bytes) {
     if (bytes == fread(data, 1, bytes, _file.get())){
         return 0;
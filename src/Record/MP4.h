@@ -135,6 +135,12 @@ public:
      */
     void closeFile();
 
+    /**
+     * 将文件io缓存刷入磁盘文件
+     * Flush the file io cache to the disk file
+     */
+    void flushFile();
+
 protected:
     uint64_t onTell() override;
     int onSeek(uint64_t offset) override;
@@ -15,6 +15,7 @@
 #include "Util/File.h"
 #include "Util/logger.h"
 #include "Extension/Factory.h"
+#include "Common/config.h"
 
 using namespace std;
 using namespace toolkit;
@@ -30,12 +31,36 @@ void MP4Demuxer::openMP4(const string &file) {
 
     _mp4_file = std::make_shared<MP4FileDisk>();
     _mp4_file->openFile(file.data(), "rb+");
+
+    GET_CONFIG(bool, enable_index, Record::kEnableMp4Index);
+    if (enable_index) {
+        _index = MP4Index::load(file);
+        if (!_index) {
+            // 索引不存在或已失效，扫描生成之，下次打开时无需再解析moov
+            // The index does not exist or is invalid, scan to generate it, so there is no need to parse moov next time
+            _index = MP4Index::build(file);
+        }
+    }
+    if (_index) {
+        for (auto &info : _index->getTracks()) {
+            if (info.is_video) {
+                onVideoTrack(info.track_id, info.object, info.width_or_channels, info.height_or_bit_per_sample, info.extra.data(), info.extra.size());
+            } else {
+                onAudioTrack(info.track_id, info.object, info.width_or_channels, info.height_or_bit_per_sample, info.sample_rate, info.extra.data(), info.extra.size());
+            }
+        }
+        _duration_ms = _index->getDurationMS();
+        return;
+    }
+
     _mov_reader = _mp4_file->createReader();
     getAllTracks();
     _duration_ms = mov_reader_getduration(_mov_reader.get());
 }
 
 void MP4Demuxer::closeMP4() {
+    _index.reset();
+    _sample_index = 0;
     _mov_reader.reset();
     _mp4_file.reset();
 }
@@ -88,6 +113,12 @@ void MP4Demuxer::onAudioTrack(uint32_t track, uint8_t object, int channel_count,
 }
 
 int64_t MP4Demuxer::seekTo(int64_t stamp_ms) {
+    if (_index) {
+        // 关键帧表上二分查找
+        // Binary search on the keyframe table
+        _sample_index = _index->seekKeyFrame(stamp_ms);
+        return stamp_ms;
+    }
     if(0 != mov_reader_seek(_mov_reader.get(),&stamp_ms)){
         return -1;
     }
@@ -107,6 +138,9 @@ struct Context {
 Frame::Ptr MP4Demuxer::readFrame(bool &keyFrame, bool &eof) {
     keyFrame = false;
     eof = false;
+    if (_index) {
+        return readFrameByIndex(keyFrame, eof);
+    }
     if (!_mov_reader) {
         eof = true;
         return nullptr;
@@ -145,6 +179,27 @@ Frame::Ptr MP4Demuxer::readFrame(bool &keyFrame, bool &eof) {
     }
 }
 
+Frame::Ptr MP4Demuxer::readFrameByIndex(bool &keyFrame, bool &eof) {
+    MP4Index::Sample sample;
+    if (!_index->getSample(_sample_index, sample)) {
+        eof = true;
+        return nullptr;
+    }
+    ++_sample_index;
+
+    auto buffer = _buffer_pool.obtain2();
+    buffer->setCapacity(sample.bytes + 1);
+    buffer->setSize(sample.bytes);
+    MP4FileIO &io = *_mp4_file;
+    if (0 != io.onSeek(sample.offset) || 0 != io.onRead(buffer->data(), sample.bytes)) {
+        eof = true;
+        WarnL << "读取mp4文件数据失败, offset:" << sample.offset << ", bytes:" << sample.bytes;
+        return nullptr;
+    }
+    keyFrame = sample.flags & MOV_AV_FLAG_KEYFREAME;
+    return makeFrame(sample.track_id, buffer, sample.pts, sample.dts);
+}
+
 Frame::Ptr MP4Demuxer::makeFrame(uint32_t track_id, const Buffer::Ptr &buf, int64_t pts, int64_t dts) {
     auto it = _tracks.find(track_id);
     if (it == _tracks.end()) {
@@ -205,7 +260,7 @@ void MultiMP4Demuxer::openMP4(const string &files_string) {
     std::vector<std::string> files;
     if (File::is_dir(files_string)) {
         File::scanDir(files_string, [&](const string &path, bool is_dir) {
-            if (!is_dir) {
+            if (!is_dir && !MP4Index::isIndexFile(path)) {
                 files.emplace_back(path);
             }
             return true;
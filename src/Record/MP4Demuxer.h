@@ -14,6 +14,7 @@
 
 #include <map>
 #include "MP4.h"
+#include "MP4Index.h"
 #include "Extension/Track.h"
 #include "Util/ResourcePool.h"
 
@@ -99,10 +100,15 @@ private:
     void onVideoTrack(uint32_t track_id, uint8_t object, int width, int height, const void *extra, size_t bytes);
     void onAudioTrack(uint32_t track_id, uint8_t object, int channel_count, int bit_per_sample, int sample_rate, const void *extra, size_t bytes);
     Frame::Ptr makeFrame(uint32_t track_id, const toolkit::Buffer::Ptr &buf, int64_t pts, int64_t dts);
+    Frame::Ptr readFrameByIndex(bool &keyFrame, bool &eof);
 
 private:
     MP4FileDisk::Ptr _mp4_file;
     MP4FileDisk::Reader _mov_reader;
+    // 旁路索引，存在时不再创建mov_reader
+    // Sidecar index, mov_reader is not created when it exists
+    MP4Index::Ptr _index;
+    uint64_t _sample_index = 0;
     uint64_t _duration_ms = 0;
     std::unordered_map<int, Track::Ptr> _tracks;
     toolkit::ResourcePool<toolkit::BufferRaw> _buffer_pool;
@@ -0,0 +1,404 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifdef ENABLE_MP4
+
+#include <algorithm>
+#include <cstring>
+#include <sys/stat.h>
+#include "MP4.h"
+#include "MP4Index.h"
+#include "Util/File.h"
+#include "Util/util.h"
+#include "Util/logger.h"
+
+using namespace std;
+using namespace toolkit;
+
+namespace mediakit {
+
+// 索引文件格式(本机字节序，字节序或版本不一致时视为无效并重新生成)
+// Index file format (native byte order, treated as invalid and regenerated if byte order or version mismatch)
+//
+// header: magic(4) version(4) mp4_size(8) mp4_mtime(8) duration_ms(8) track_count(4) key_frame_count(4)
+//         sample_count(8) sample_table_offset(8) key_frame_table_offset(8)
+// tracks: track_id(4) is_video(1) object(1) width_or_channels(4) height_or_bit_per_sample(4) sample_rate(4) extra_size(4) extra
+// samples: offset(8) bytes(4) track_id(2) flags(2) dts(4) pts(4)
+// key frames: dts(8) sample_index(8)
+static constexpr char kIndexMagic[4] = {'Z', 'L', 'M', 'I'};
+static constexpr uint32_t kIndexVersion = 1;
+static constexpr size_t kIndexHeaderSize = 64;
+static constexpr size_t kSampleRecordSize = 24;
+static constexpr size_t kKeyFrameRecordSize = 16;
+// 每次从样本表读取的样本个数
+// Number of samples read from the sample table each time
+static constexpr size_t kSampleBlockSize = 1024;
+// 纯音频文件seek点间隔
+// Seek point interval for audio only files
+static constexpr int64_t kAudioSeekIntervalMS = 500;
+
+template <typename T>
+static void putValue(string &buf, T value) {
+    buf.append((char *)&value, sizeof(value));
+}
+
+template <typename T>
+static T getValue(const char *&ptr) {
+    T value;
+    memcpy(&value, ptr, sizeof(value));
+    ptr += sizeof(value);
+    return value;
+}
+
+static bool getFileStat(const string &file, uint64_t &size, uint64_t &mtime) {
+    struct stat st;
+    if (0 != stat(file.data(), &st)) {
+        return false;
+    }
+    size = st.st_size;
+    mtime = st.st_mtime;
+    return true;
+}
+
+static bool readAll(FILE *fp, void *data, size_t bytes) {
+    return bytes == fread(data, 1, bytes, fp);
+}
+
+// 生成索引时使用的mp4文件io，样本数据不真正读取，仅记录其文件偏移并跳过
+// mp4 file io used when building the index, sample data is not actually read, only its file offset is recorded and skipped
+class MP4FileIndexProbe : public MP4FileDisk {
+public:
+    using Ptr = std::shared_ptr<MP4FileIndexProbe>;
+
+    void *marker() { return &_marker; }
+
+    uint64_t takeOffset() {
+        auto ret = _last_offset;
+        _last_offset = 0;
+        return ret;
+    }
+
+protected:
+    int onRead(void *data, size_t bytes) override {
+        if (data != &_marker) {
+            return MP4FileDisk::onRead(data, bytes);
+        }
+        _last_offset = MP4FileDisk::onTell();
+        return MP4FileDisk::onSeek(_last_offset + bytes);
+    }
+
+private:
+    uint8_t _marker = 0;
+    uint64_t _last_offset = 0;
+};
+
+string MP4Index::getIndexPath(const string &mp4_file) {
+    return mp4_file + ".idx";
+}
+
+bool MP4Index::isIndexFile(const string &path) {
+    // 临时文件为 xxx.idx.tmp.<随机串>，见build()
+    // Temporary files are named xxx.idx.tmp.<random>, see build()
+    return end_with(path, ".idx") || path.find(".idx.tmp.") != string::npos;
+}
+
+MP4Index::Ptr MP4Index::build(const string &mp4_file) {
+    uint64_t mp4_size, mp4_mtime;
+    if (!getFileStat(mp4_file, mp4_size, mp4_mtime)) {
+        return nullptr;
+    }
+
+    auto index_path = getIndexPath(mp4_file);
+    // 同一文件可能被并发懒构建，每个构建者写各自的临时文件，rename保证最终索引完整
+    // The same file may be built lazily by several callers at once, each builder writes its own temporary file
+    // and rename keeps the final index intact
+    auto index_path_tmp = index_path + ".tmp." + makeRandStr(8, false);
+    try {
+        auto probe = std::make_shared<MP4FileIndexProbe>();
+        probe->openFile(mp4_file.data(), "rb");
+        auto reader = probe->createReader();
+
+        vector<TrackInfo> tracks;
+        static mov_reader_trackinfo_t s_on_track = {
+            [](void *param, uint32_t track, uint8_t object, int width, int height, const void *extra, size_t bytes) {
+                TrackInfo info;
+                info.track_id = track;
+                info.is_video = true;
+                info.object = object;
+                info.width_or_channels = width;
+                info.height_or_bit_per_sample = height;
+                if (extra && bytes) {
+                    info.extra.assign((char *)extra, bytes);
+                }
+                ((vector<TrackInfo> *)param)->emplace_back(std::move(info));
+            },
+            [](void *param, uint32_t track, uint8_t object, int channel_count, int bit_per_sample, int sample_rate, const void *extra, size_t bytes) {
+                TrackInfo info;
+                info.track_id = track;
+                info.object = object;
+                info.width_or_channels = channel_count;
+                info.height_or_bit_per_sample = bit_per_sample;
+                info.sample_rate = sample_rate;
+                if (extra && bytes) {
+                    info.extra.assign((char *)extra, bytes);
+                }
+                ((vector<TrackInfo> *)param)->emplace_back(std::move(info));
+            },
+            [](void *param, uint32_t track, uint8_t object, const void *extra, size_t bytes) {
+                //onsubtitle, do nothing
+            }
+        };
+        mov_reader_getinfo(reader.get(), &s_on_track, &tracks);
+        uint64_t duration_ms = mov_reader_getduration(reader.get());
+
+        auto fp = File::create_file(index_path_tmp, "wb");
+        if (!fp) {
+            WarnL << "创建mp4索引文件失败:" << index_path_tmp;
+            return nullptr;
+        }
+        std::shared_ptr<FILE> file(fp, [](FILE *fp) { fclose(fp); });
+
+        uint64_t file_offset = 0;
+        string buf;
+        auto flush = [&]() {
+            if (buf.size() != fwrite(buf.data(), 1, buf.size(), file.get())) {
+                throw std::runtime_error("写入mp4索引文件失败");
+            }
+            file_offset += buf.size();
+            buf.clear();
+        };
+
+        // 文件头最后回填，先写track信息
+        // The header is filled in at last, write the track info first
+        buf.assign(kIndexHeaderSize, '\0');
+        for (auto &info : tracks) {
+            putValue<uint32_t>(buf, info.track_id);
+            putValue<uint8_t>(buf, info.is_video);
+            putValue<uint8_t>(buf, info.object);
+            putValue<int32_t>(buf, info.width_or_channels);
+            putValue<int32_t>(buf, info.height_or_bit_per_sample);
+            putValue<int32_t>(buf, info.sample_rate);
+            putValue<uint32_t>(buf, info.extra.size());
+            buf.append(info.extra);
+        }
+        flush();
+
+        struct Context {
+            MP4FileIndexProbe *probe;
+            Sample sample;
+        } ctx { probe.get() };
+
+        static mov_reader_onread2 s_on_alloc = [](void *param, uint32_t track_id, size_t bytes, int64_t pts, int64_t dts, int flags) -> void * {
+            auto ctx = (Context *)param;
+            ctx->sample.bytes = bytes;
+            ctx->sample.track_id = track_id;
+            ctx->sample.flags = flags;
+            ctx->sample.pts = pts;
+            ctx->sample.dts = dts;
+            return ctx->probe->marker();
+        };
+
+        bool have_video = std::any_of(tracks.begin(), tracks.end(), [](const TrackInfo &info) { return info.is_video; });
+        auto is_video_track = [&](uint32_t track_id) {
+            return std::any_of(tracks.begin(), tracks.end(), [&](const TrackInfo &info) { return info.is_video && info.track_id == track_id; });
+        };
+
+        // 按mov_reader的读取顺序(各track按dts交织)写入样本表，同时收集关键帧
+        // Write the sample table in the read order of mov_reader (tracks interleaved by dts) and collect keyframes at the same time
+        uint64_t sample_table_offset = file_offset;
+        uint64_t sample_count = 0;
+        int64_t last_seek_dts = INT64_MIN / 2;
+        vector<KeyFrame> key_frames;
+        for (;;) {
+            auto ret = mov_reader_read2(reader.get(), s_on_alloc, &ctx);
+            if (ret == 0) {
+                break;
+            }
+            if (ret < 0) {
+                throw std::runtime_error("读取mp4样本失败:" + to_string(ret));
+            }
+            auto &sample = ctx.sample;
+            sample.offset = probe->takeOffset();
+            bool seek_point = have_video ? (is_video_track(sample.track_id) && (sample.flags & MOV_AV_FLAG_KEYFREAME))
+                                         : (sample.dts >= last_seek_dts + kAudioSeekIntervalMS);
+            if (seek_point) {
+                key_frames.emplace_back(KeyFrame { sample.dts, sample_count });
+                last_seek_dts = sample.dts;
+            }
+            putValue<uint64_t>(buf, sample.offset);
+            putValue<uint32_t>(buf, sample.bytes);
+            putValue<uint16_t>(buf, sample.track_id);
+            putValue<uint16_t>(buf, sample.flags);
+            putValue<int32_t>(buf, sample.dts);
+            putValue<int32_t>(buf, sample.pts);
+            ++sample_count;
+            if (buf.size() >= kSampleBlockSize * kSampleRecordSize) {
+                flush();
+            }
+        }
+        flush();
+
+        uint64_t key_frame_table_offset = file_offset;
+        for (auto &key_frame : key_frames) {
+            putValue<int64_t>(buf, key_frame.dts);
+            putValue<uint64_t>(buf, key_frame.sample_index);
+        }
+        flush();
+
+        buf.append(kIndexMagic, sizeof(kIndexMagic));
+        putValue<uint32_t>(buf, kIndexVersion);
+        putValue<uint64_t>(buf, mp4_size);
+        putValue<uint64_t>(buf, mp4_mtime);
+        putValue<uint64_t>(buf, duration_ms);
+        putValue<uint32_t>(buf, tracks.size());
+        putValue<uint32_t>(buf, key_frames.size());
+        putValue<uint64_t>(buf, sample_count);
+        putValue<uint64_t>(buf, sample_table_offset);
+        putValue<uint64_t>(buf, key_frame_table_offset);
+        buf.resize(kIndexHeaderSize);
+        fseek(file.get(), 0, SEEK_SET);
+        flush();
+    } catch (std::exception &ex) {
+        WarnL << "生成mp4索引失败:" << ex.what() << ", " << mp4_file;
+        File::delete_file(index_path_tmp);
+        return nullptr;
+    }
+
+    // 写完再改名，防止读到不完整的索引
+    // Rename after writing to prevent reading an incomplete index
+    File::delete_file(index_path);
+    if (0 != rename(index_path_tmp.data(), index_path.data())) {
+        WarnL << "重命名mp4索引文件失败:" << index_path_tmp;
+        File::delete_file(index_path_tmp);
+        return nullptr;
+    }
+    return load(mp4_file);
+}
+
+MP4Index::Ptr MP4Index::load(const string &mp4_file) {
+    uint64_t mp4_size, mp4_mtime;
+    if (!getFileStat(mp4_file, mp4_size, mp4_mtime)) {
+        return nullptr;
+    }
+    auto index_path = getIndexPath(mp4_file);
+    auto fp = fopen(index_path.data(), "rb");
+    if (!fp) {
+        return nullptr;
+    }
+    std::shared_ptr<FILE> file(fp, [](FILE *fp) { fclose(fp); });
+
+    char header[kIndexHeaderSize];
+    if (!readAll(fp, header, sizeof(header)) || memcmp(header, kIndexMagic, sizeof(kIndexMagic))) {
+        return nullptr;
+    }
+    const char *ptr = header + sizeof(kIndexMagic);
+    auto version = getValue<uint32_t>(ptr);
+    auto index_mp4_size = getValue<uint64_t>(ptr);
+    auto index_mp4_mtime = getValue<uint64_t>(ptr);
+    if (version != kIndexVersion || index_mp4_size != mp4_size || index_mp4_mtime != mp4_mtime) {
+        // mp4文件已经被修改，索引失效
+        // The mp4 file has been modified, the index is invalid
+        return nullptr;
+    }
+
+    auto ret = std::make_shared<MP4Index>();
+    ret->_duration_ms = getValue<uint64_t>(ptr);
+    auto track_count = getValue<uint32_t>(ptr);
+    auto key_frame_count = getValue<uint32_t>(ptr);
+    ret->_sample_count = getValue<uint64_t>(ptr);
+    ret->_sample_table_offset = getValue<uint64_t>(ptr);
+    auto key_frame_table_offset = getValue<uint64_t>(ptr);
+
+    for (uint32_t i = 0; i < track_count; ++i) {
+        char buf[22];
+        if (!readAll(fp, buf, sizeof(buf))) {
+            return nullptr;
+        }
+        const char *ptr = buf;
+        TrackInfo info;
+        info.track_id = getValue<uint32_t>(ptr);
+        info.is_video = getValue<uint8_t>(ptr);
+        info.object = getValue<uint8_t>(ptr);
+        info.width_or_channels = getValue<int32_t>(ptr);
+        info.height_or_bit_per_sample = getValue<int32_t>(ptr);
+        info.sample_rate = getValue<int32_t>(ptr);
+        info.extra.resize(getValue<uint32_t>(ptr));
+        if (!info.extra.empty() && !readAll(fp, (char *)info.extra.data(), info.extra.size())) {
+            return nullptr;
+        }
+        ret->_tracks.emplace_back(std::move(info));
+    }
+
+    string key_frames(key_frame_count * kKeyFrameRecordSize, '\0');
+    if (fseek(fp, key_frame_table_offset, SEEK_SET) || !readAll(fp, (char *)key_frames.data(), key_frames.size())) {
+        return nullptr;
+    }
+    ptr = key_frames.data();
+    ret->_key_frames.reserve(key_frame_count);
+    for (uint32_t i = 0; i < key_frame_count; ++i) {
+        auto dts = getValue<int64_t>(ptr);
+        auto sample_index = getValue<uint64_t>(ptr);
+        ret->_key_frames.emplace_back(KeyFrame { dts, sample_index });
+    }
+    ret->_file = std::move(file);
+    return ret;
+}
+
+uint64_t MP4Index::seekKeyFrame(int64_t &stamp_ms) const {
+    auto it = std::upper_bound(_key_frames.begin(), _key_frames.end(), stamp_ms, [](int64_t stamp, const KeyFrame &key_frame) {
+        return stamp < key_frame.dts;
+    });
+    if (it == _key_frames.begin()) {
+        // 早于第一个关键帧，从头开始
+        // Earlier than the first keyframe, start from the beginning
+        stamp_ms = 0;
+        return 0;
+    }
+    --it;
+    stamp_ms = it->dts;
+    return it->sample_index;
+}
+
+bool MP4Index::getSample(uint64_t index, Sample &sample) {
+    if (index >= _sample_count) {
+        return false;
+    }
+    if ((index < _block_start || index >= _block_start + _block.size()) && !loadBlock(index)) {
+        return false;
+    }
+    sample = _block[index - _block_start];
+    return true;
+}
+
+bool MP4Index::loadBlock(uint64_t index) {
+    _block.clear();
+    _block_start = index;
+    auto count = MIN(kSampleBlockSize, _sample_count - index);
+    string buf(count * kSampleRecordSize, '\0');
+    if (fseek(_file.get(), _sample_table_offset + index * kSampleRecordSize, SEEK_SET)
+        || !readAll(_file.get(), (char *)buf.data(), buf.size())) {
+        WarnL << "读取mp4索引样本表失败";
+        return false;
+    }
+    const char *ptr = buf.data();
+    _block.resize(count);
+    for (auto &sample : _block) {
+        sample.offset = getValue<uint64_t>(ptr);
+        sample.bytes = getValue<uint32_t>(ptr);
+        sample.track_id = getValue<uint16_t>(ptr);
+        sample.flags = getValue<uint16_t>(ptr);
+        sample.dts = getValue<int32_t>(ptr);
+        sample.pts = getValue<int32_t>(ptr);
+    }
+    return true;
+}
+
+}//namespace mediakit
+#endif// ENABLE_MP4
@@ -0,0 +1,134 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_MP4INDEX_H
+#define ZLMEDIAKIT_MP4INDEX_H
+#ifdef ENABLE_MP4
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+namespace mediakit {
+
+/**
+ * mp4旁路索引文件(xxx.mp4.idx)
+ * 保存track信息、全部样本在mp4文件中的偏移/大小/时间戳以及关键帧表，
+ * 打开时只加载track信息与关键帧表，样本表按需分块读取，seek为关键帧表上的二分查找
+ * mp4 sidecar index file (xxx.mp4.idx)
+ * Stores track info, offset/size/timestamp of all samples in the mp4 file and a keyframe table.
+ * Only track info and the keyframe table are loaded on open, the sample table is read in blocks on demand,
+ * and seek is a binary search over the keyframe table
+ */
+class MP4Index {
+public:
+    using Ptr = std::shared_ptr<MP4Index>;
+
+    struct TrackInfo {
+        uint32_t track_id = 0;
+        bool is_video = false;
+        uint8_t object = 0;
+        // 视频为宽高，音频为通道数与采样位数
+        // Width and height for video, channel count and bits per sample for audio
+        int width_or_channels = 0;
+        int height_or_bit_per_sample = 0;
+        int sample_rate = 0;
+        std::string extra;
+    };
+
+    struct Sample {
+        uint64_t offset = 0;
+        uint32_t bytes = 0;
+        uint32_t track_id = 0;
+        int flags = 0;
+        int64_t pts = 0;
+        int64_t dts = 0;
+    };
+
+    /**
+     * 获取mp4文件对应的索引文件路径
+     * Get the index file path of the mp4 file
+     */
+    static std::string getIndexPath(const std::string &mp4_file);
+
+    /**
+     * 判断是否为索引文件
+     * Whether the path is an index file
+     */
+    static bool isIndexFile(const std::string &path);
+
+    /**
+     * 扫描mp4文件生成索引文件，仅解析一次moov，不读取样本数据
+     * @param mp4_file mp4文件路径
+     * @return 生成的索引，失败返回nullptr
+     * Scan the mp4 file and generate the index file, the moov is parsed only once and sample data is not read
+     * @param mp4_file mp4 file path
+     * @return The generated index, nullptr on failure
+     */
+    static Ptr build(const std::string &mp4_file);
+
+    /**
+     * 加载索引文件，索引不存在或与mp4文件大小/修改时间不匹配时返回nullptr
+     * @param mp4_file mp4文件路径
+     * Load the index file, return nullptr if it does not exist or does not match the mp4 file size/modification time
+     * @param mp4_file mp4 file path
+     */
+    static Ptr load(const std::string &mp4_file);
+
+    const std::vector<TrackInfo> &getTracks() const { return _tracks; }
+    uint64_t getDurationMS() const { return _duration_ms; }
+    uint64_t getSampleCount() const { return _sample_count; }
+
+    /**
+     * 二分查找不晚于stamp_ms的最近关键帧
+     * @param stamp_ms 预期时间戳，返回时修改为关键帧时间戳
+     * @return 关键帧的样本序号
+     * Binary search the nearest keyframe not later than stamp_ms
+     * @param stamp_ms Expected timestamp, modified to the keyframe timestamp on return
+     * @return Sample index of the keyframe
+     */
+    uint64_t seekKeyFrame(int64_t &stamp_ms) const;
+
+    /**
+     * 读取样本信息
+     * @param index 样本序号
+     * @return 是否成功
+     * Read sample info
+     * @param index Sample index
+     * @return Whether it is successful
+     */
+    bool getSample(uint64_t index, Sample &sample);
+
+private:
+    struct KeyFrame {
+        int64_t dts;
+        uint64_t sample_index;
+    };
+
+    bool loadBlock(uint64_t index);
+
+private:
+    uint64_t _duration_ms = 0;
+    uint64_t _sample_count = 0;
+    uint64_t _sample_table_offset = 0;
+    std::vector<TrackInfo> _tracks;
+    std::vector<KeyFrame> _key_frames;
+    // 样本表分块缓存
+    // Block cache of the sample table
+    uint64_t _block_start = 0;
+    std::vector<Sample> _block;
+    std::shared_ptr<FILE> _file;
+};
+
+}//namespace mediakit
+#endif//ENABLE_MP4
+#endif //ZLMEDIAKIT_MP4INDEX_H
@@ -32,7 +32,23 @@ void MP4Muxer::openMP4(const string &file) {
 MP4FileIO::Writer MP4Muxer::createWriter() {
     GET_CONFIG(bool, mp4FastStart, Record::kFastStart);
     GET_CONFIG(bool, recordEnableFmp4, Record::kEnableFmp4);
-    return _mp4_file->createWriter(mp4FastStart ? MOV_FLAG_FASTSTART : 0, recordEnableFmp4);
+    GET_CONFIG(uint32_t, fmp4FragmentMS, Record::kFmp4FragmentMS);
+    if (recordEnableFmp4) {
+        // fmp4边录边写fragment，文件头部即为moov，无需关闭时回写
+        // fmp4 writes fragments while recording, the moov is at the head of the file, no rewrite is needed on close
+        _max_fragment_ms = fmp4FragmentMS;
+        return _mp4_file->createWriter(0, true);
+    }
+    _max_fragment_ms = 0;
+    return _mp4_file->createWriter(mp4FastStart ? MOV_FLAG_FASTSTART : 0, false);
+}
+
+void MP4Muxer::onFragmentSaved() {
+    // 将fragment刷入内核，进程异常退出时已写入的fragment仍可播放
+    // Flush the fragment to the kernel, so written fragments remain playable if the process exits abnormally
+    if (_mp4_file) {
+        _mp4_file->flushFile();
+    }
 }
 
 void MP4Muxer::closeMP4() {
@@ -72,6 +88,7 @@ uint64_t MP4MuxerInterface::getDuration() const {
 void MP4MuxerInterface::resetTracks() {
     _started = false;
     _have_video = false;
+    _fragment_start_dts = -1;
     _mov_writter = nullptr;
     _tracks.clear();
 }
@@ -114,7 +131,9 @@ bool MP4MuxerInterface::inputFrame(const Frame::Ptr &frame) {
 
         if (_non_iframe_video_count > 200) {
             saveSegment();
+            onFragmentSaved();
             _non_iframe_video_count = 0;
+            _fragment_start_dts = -1;
         }
     }
 
@@ -127,6 +146,10 @@ bool MP4MuxerInterface::inputFrame(const Frame::Ptr &frame) {
             // 这里的代码逻辑是让SPS、PPS、IDR这些时间戳相同的帧打包到一起当做一个帧处理，  [AUTO-TRANSLATED:edf57c32]
             // The code logic here is to package frames with the same timestamp, such as SPS, PPS, and IDR, as one frame,
             track.merger.inputFrame(frame, [this, &track](uint64_t dts, uint64_t pts, const Buffer::Ptr &buffer, bool have_idr) {
+                // 合并帧输出时才切分，上个gop的最后一帧在此之前已写入旧fragment，新fragment总是以关键帧开始
+                // Cut when the merged frame is output, the last frame of the previous gop has been written to the old fragment
+                // by then, so the new fragment always starts with a key frame
+                checkFragment(have_idr, dts);
                 int64_t dts_out, pts_out;
                 track.stamp.revise(dts, pts, dts_out, pts_out);
                 mp4_writer_write(_mov_writter.get(), track.track_id, buffer->data(), buffer->size(), pts_out, dts_out, have_idr ? MOV_AV_FLAG_KEYFREAME : 0);
@@ -135,6 +158,9 @@ bool MP4MuxerInterface::inputFrame(const Frame::Ptr &frame) {
         }
 
         default: {
+            if (frame->getTrackType() == TrackVideo || !_have_video) {
+                checkFragment(frame->keyFrame(), frame->dts());
+            }
             int64_t dts_out, pts_out;
             track.stamp.revise(frame->dts(), frame->pts(), dts_out, pts_out);
             mp4_writer_write(_mov_writter.get(), track.track_id, frame->data() + frame->prefixSize(), frame->size() - frame->prefixSize(), pts_out, dts_out, frame->keyFrame() ? MOV_AV_FLAG_KEYFREAME : 0);
@@ -144,6 +170,22 @@ bool MP4MuxerInterface::inputFrame(const Frame::Ptr &frame) {
     return true;
 }
 
+void MP4MuxerInterface::checkFragment(bool key, uint64_t dts) {
+    // fmp4录制时，遇到关键帧或者fragment超过最大时长则立即写出，限制内存占用并让文件边写边可播放
+    // When recording fmp4, write out the fragment on keyframes or when it exceeds the max duration,
+    // which bounds memory usage and keeps the file playable while being written
+    if (!_max_fragment_ms || !_mov_writter->fmp4) {
+        return;
+    }
+    if (_fragment_start_dts < 0) {
+        _fragment_start_dts = dts;
+    } else if (key || dts >= _fragment_start_dts + _max_fragment_ms) {
+        saveSegment();
+        onFragmentSaved();
+        _fragment_start_dts = dts;
+    }
+}
+
 int MP4MuxerInterface::getTrackId(CodecId id) {
     auto it = _tracks.find(id);
     if (it == _tracks.end()) {
@@ -89,15 +89,33 @@ public:
 protected:
     virtual MP4FileIO::Writer createWriter() = 0;
 
+    /**
+     * fmp4 fragment已经写出
+     * The fmp4 fragment has been written
+     */
+    virtual void onFragmentSaved() {}
+
     int getTrackId(CodecId id);
 
 private:
     void stampSync();
 
+    /**
+     * 视频帧(合并后)或纯音频帧写入前检查是否切分fmp4 fragment
+     * Check whether to cut the fmp4 fragment before a (merged) video frame or an audio only frame is written
+     */
+    void checkFragment(bool key, uint64_t dts);
+
+protected:
+    // fmp4单个fragment最大时长(毫秒)，0表示由writer在关键帧处自行切分
+    // Max duration of a single fmp4 fragment (ms), 0 means the writer splits at keyframes by itself
+    uint32_t _max_fragment_ms = 0;
+
 private:
     bool _started = false;
     bool _have_video = false;
     int _non_iframe_video_count; // 非I帧个数
+    int64_t _fragment_start_dts = -1;
 
     class FrameMergerImp : public FrameMerger {
     public:
@@ -147,6 +165,7 @@ public:
 
 protected:
     MP4FileIO::Writer createWriter() override;
+    void onFragmentSaved() override;
 
 private:
     std::string _file_name;
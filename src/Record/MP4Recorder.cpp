@@ -16,6 +16,7 @@
 #include "MP4Recorder.h"
 #include "Thread/WorkThreadPool.h"
 #include "MP4Muxer.h"
+#include "MP4Index.h"
 
 using namespace std;
 using namespace toolkit;
@@ -98,6 +99,13 @@ void MP4Recorder::asyncClose() {
             // 临时文件名改成正式文件名，防止mp4未完成时被访问  [AUTO-TRANSLATED:541a6f00]
             // Change the temporary file name to the official file name to prevent access to the mp4 before it is completed
             rename(full_path_tmp.data(), full_path.data());
+
+            GET_CONFIG(bool, enable_index, Record::kEnableMp4Index);
+            if (enable_index) {
+                // 生成关键帧旁路索引，点播该文件时无需再解析moov
+                // Generate the keyframe sidecar index, so there is no need to parse moov when playing this file
+                MP4Index::build(full_path);
+            }
         }
         TraceL << "Emit mp4 record event: " << full_path;
         // 触发mp4录制切片生成事件  [AUTO-TRANSLATED:9959dcd4]
@@ -9,12 +9,15 @@
  */
 
 #include <assert.h>
+#include <algorithm>
 #include "MPEG.h"
 
 #if defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
 
 #include "mpeg-ts.h"
 #include "mpeg-muxer.h"
+#include "Common/config.h"
+#include "Common/AllocProfiler.h"
 
 using namespace toolkit;
 
@@ -40,7 +43,36 @@ bool MpegMuxer::addTrack(const Track::Ptr &track) {
     if (track->getTrackType() == TrackVideo) {
         _have_video = true;
     }
-    _tracks[track->getIndex()].track_id = mpeg_muxer_add_stream((::mpeg_muxer_t *)_context, mpeg_id, nullptr, 0);
+    if (_mux_disabled) {
+        return true;
+    }
+    auto &ref = _tracks[track->getIndex()];
+    ref.mpeg_id = mpeg_id;
+    if (_packetizer) {
+        ref.ts_stream = _packetizer->addStream(track->getCodecId());
+        if (ref.ts_stream >= 0) {
+            return true;
+        }
+        // 内置打包器不支持该编码，整体回退到mpeg_muxer，由于两者pid/cc不同，不能混用
+        // The built-in packetizer does not support this codec, fall back to mpeg_muxer as a whole,
+        // they cannot be mixed because their pid/cc are different
+        InfoL << "Fast ts muxer does not support " << track->getCodecName() << ", fallback to mpeg_muxer";
+        _packetizer = nullptr;
+        createMuxerContext();
+        // 按track序号补加此前已添加的track，保证pid分配稳定
+        // Re-add the previously added tracks in track index order so pid allocation stays stable
+        std::vector<int> indexes;
+        for (auto &pr : _tracks) {
+            indexes.emplace_back(pr.first);
+        }
+        std::sort(indexes.begin(), indexes.end());
+        for (auto index : indexes) {
+            auto &item = _tracks[index];
+            item.track_id = mpeg_muxer_add_stream((::mpeg_muxer_t *)_context, item.mpeg_id, nullptr, 0);
+        }
+        return true;
+    }
+    ref.track_id = mpeg_muxer_add_stream((::mpeg_muxer_t *)_context, mpeg_id, nullptr, 0);
     return true;
 }
 
@@ -61,9 +93,7 @@ bool MpegMuxer::inputFrame(const Frame::Ptr &frame) {
                 // 取视频时间戳为TS的时间戳  [AUTO-TRANSLATED:5ff7796d]
                 // Take the video timestamp as the TS timestamp.
                 _timestamp = dts;
-                _max_cache_size = 512 + 1.2 * buffer->size();
-                mpeg_muxer_input((::mpeg_muxer_t *)_context, track.track_id, have_idr ? 0x0001 : 0, pts * 90LL, dts * 90LL, buffer->data(), buffer->size());
-                flushCache();
+                inputToContext(track.track_id, track.ts_stream, have_idr, pts, dts, buffer->data(), buffer->size());
             });
         }
 
@@ -82,16 +112,37 @@ bool MpegMuxer::inputFrame(const Frame::Ptr &frame) {
                 _key_pos = frame->keyFrame();
                 _timestamp = frame->dts();
             }
-            _max_cache_size = 512 + 1.2 * frame->size();
-            mpeg_muxer_input((::mpeg_muxer_t *)_context, track.track_id, frame->keyFrame() ? 0x0001 : 0, frame->pts() * 90LL, frame->dts() * 90LL, frame->data(), frame->size());
-            flushCache();
+            inputToContext(track.track_id, track.ts_stream, frame->keyFrame(), frame->pts(), frame->dts(), frame->data(), frame->size());
             return true;
         }
     }
 }
 
+void MpegMuxer::inputToContext(int track_id, int ts_stream, bool key, uint64_t pts, uint64_t dts, const char *data, size_t bytes) {
+    if (_packetizer) {
+        // ts包直接写入池化内存块，每帧输出一个188字节对齐的内存块
+        // TS packets are written directly into a pooled memory block, one 188-byte aligned block is output per frame
+        auto buffer = _buffer_pool.obtain2();
+        buffer->setSize(0);
+        buffer->setCapacity(TsPacketizer::maxOutputSize(bytes));
+        AllocProfiler::record(AllocProfiler::kTs, buffer->getCapacity());
+        _packetizer->input(ts_stream, key, pts, dts, data, bytes, *buffer);
+        _current_buffer = std::move(buffer);
+        flushCache();
+        return;
+    }
+    _max_cache_size = 512 + 1.2 * bytes;
+    mpeg_muxer_input((::mpeg_muxer_t *)_context, track_id, key ? 0x0001 : 0, pts * 90LL, dts * 90LL, data, bytes);
+    flushCache();
+}
+
 void MpegMuxer::resetTracks() {
     _have_video = false;
+    if (_mux_disabled) {
+        // 片段中断由外部封装器通知
+        // Fragment interruption is notified by the external muxer
+        return;
+    }
     // 通知片段中断  [AUTO-TRANSLATED:ed3d87ba]
     // Notify fragment interruption.
     onWrite(nullptr, _timestamp, false);
@@ -100,6 +151,18 @@ void MpegMuxer::resetTracks() {
 }
 
 void MpegMuxer::createContext() {
+    GET_CONFIG(bool, fast_ts_muxer, General::kFastTsMuxer);
+    if (!_is_ps && fast_ts_muxer) {
+        // 内置打包器生效时不创建mpeg_muxer，仅在遇到其不支持的编码时再按需创建
+        // mpeg_muxer is not created while the built-in packetizer is active, it is created on demand
+        // only when a codec unsupported by the packetizer is added
+        _packetizer.reset(new TsPacketizer);
+        return;
+    }
+    createMuxerContext();
+}
+
+void MpegMuxer::createMuxerContext() {
     static mpeg_muxer_func_t func = {
             /*alloc*/
             [](void *param, size_t bytes) {
@@ -111,7 +174,14 @@ void MpegMuxer::createContext() {
                     }
                     thiz->_current_buffer = thiz->_buffer_pool.obtain2();
                     thiz->_current_buffer->setSize(0);
-                    thiz->_current_buffer->setCapacity(MAX(thiz->_max_cache_size, bytes));
+                    auto capacity = MAX(thiz->_max_cache_size, bytes);
+                    if (!thiz->_is_ps) {
+                        // 按ts包大小对齐，内存块总是容纳整数个ts包
+                        // Align to the ts packet size, so the memory block always holds a whole number of ts packets
+                        capacity = (capacity + TsPacketizer::kPacketSize - 1) / TsPacketizer::kPacketSize * TsPacketizer::kPacketSize;
+                    }
+                    thiz->_current_buffer->setCapacity(capacity);
+                    AllocProfiler::record(AllocProfiler::kTs, capacity);
                 }
                 return (void *)(thiz->_current_buffer->data() + thiz->_current_buffer->size());
             },
@@ -147,9 +217,15 @@ void MpegMuxer::releaseContext() {
         mpeg_muxer_destroy((::mpeg_muxer_t *)_context);
         _context = nullptr;
     }
+    _packetizer = nullptr;
     _tracks.clear();
 }
 
+void MpegMuxer::disableMux() {
+    _mux_disabled = true;
+    releaseContext();
+}
+
 void MpegMuxer::flush() {
     for (auto &pr : _tracks) {
         pr.second.merger.flush();
@@ -11,6 +11,8 @@
 #ifndef ZLMEDIAKIT_MPEG_H
 #define ZLMEDIAKIT_MPEG_H
 
+#include <functional>
+
 #if defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
 
 #include <cstdio>
@@ -20,6 +22,7 @@
 #include "Extension/Track.h"
 #include "Common/MediaSink.h"
 #include "Util/ResourcePool.h"
+#include "TsPacketizer.h"
 namespace mediakit {
 
 // 该类用于产生MPEG-TS/MPEG-PS  [AUTO-TRANSLATED:267efc85]
@@ -61,6 +64,12 @@ public:
      */
     void flush() override;
 
+    /**
+     * 关闭内部封装并释放封装上下文，之后只接收外部(SharedMpegMuxer)已封装好的数据
+     * Disable internal muxing and release the mux context, only data already muxed externally (SharedMpegMuxer) is received afterwards
+     */
+    void disableMux();
+
 protected:
     /**
      * 输出ts/ps数据回调
@@ -79,12 +88,15 @@ protected:
 
 private:
     void createContext();
+    void createMuxerContext();
     void releaseContext();
     void onWrite_l(const void *packet, size_t bytes);
     void flushCache();
+    void inputToContext(int track_id, int ts_stream, bool key, uint64_t pts, uint64_t dts, const char *data, size_t bytes);
 
 private:
     bool _is_ps = false;
+    bool _mux_disabled = false;
     bool _have_video = false;
     bool _key_pos = false;
     uint32_t _max_cache_size = 0;
@@ -97,10 +109,15 @@ private:
     };
 
     struct MP4Track {
+        int mpeg_id = 0;
         int track_id = -1;
+        int ts_stream = -1;
         FrameMergerImp merger;
     };
     std::unordered_map<int, MP4Track> _tracks;
+    // 内置零拷贝ts打包器，为空时使用media-server的mpeg_muxer
+    // Built-in zero-copy ts packetizer, media-server's mpeg_muxer is used when it is null
+    std::unique_ptr<TsPacketizer> _packetizer;
     toolkit::BufferRaw::Ptr _current_buffer;
     toolkit::ResourcePool<toolkit::BufferRaw> _buffer_pool;
 };
@@ -119,6 +136,7 @@ public:
     bool addTrack(const Track::Ptr &track) override { return false; }
     void resetTracks() override {}
     bool inputFrame(const Frame::Ptr &frame) override { return false; }
+    void disableMux() {}
 
 protected:
     virtual void onWrite(std::shared_ptr<toolkit::Buffer> buffer, uint64_t timestamp, bool key_pos) = 0;
@@ -128,4 +146,37 @@ protected:
 
 #endif
 
+namespace mediakit {
+
+/**
+ * 共享的mpeg-ts封装，同一路流只封装一次，输出的ts数据以引用方式分发给多个消费者(http-ts、hls等)
+ * Shared mpeg-ts muxer, a stream is muxed only once, and the output ts data is distributed by reference to multiple consumers (http-ts, hls, etc.)
+ */
+class SharedMpegMuxer : public MpegMuxer {
+public:
+    using Ptr = std::shared_ptr<SharedMpegMuxer>;
+    using onOutput = std::function<void(const std::shared_ptr<toolkit::Buffer> &buffer, uint64_t timestamp, bool key_pos)>;
+
+    SharedMpegMuxer() : MpegMuxer(false) {}
+    ~SharedMpegMuxer() override = default;
+
+    /**
+     * 设置ts数据输出回调，buffer为空时表示重置track
+     * Set the ts data output callback, a null buffer means tracks are reset
+     */
+    void setOnOutput(onOutput cb) { _on_output = std::move(cb); }
+
+protected:
+    void onWrite(std::shared_ptr<toolkit::Buffer> buffer, uint64_t timestamp, bool key_pos) override {
+        if (_on_output) {
+            _on_output(buffer, timestamp, key_pos);
+        }
+    }
+
+private:
+    onOutput _on_output;
+};
+
+}//namespace mediakit
+
 #endif //ZLMEDIAKIT_MPEG_H
@@ -0,0 +1,338 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "TsPacketizer.h"
+
+#if defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
+
+#include <cstring>
+#include <algorithm>
+#include "Util/util.h"
+
+using namespace toolkit;
+
+namespace mediakit {
+
+static constexpr size_t kHeaderSize = 4;
+static constexpr size_t kPayloadSize = TsPacketizer::kPacketSize - kHeaderSize;
+static constexpr uint16_t kPatPid = 0x0000;
+static constexpr uint16_t kPmtPid = 0x1000;
+static constexpr uint16_t kStreamPidBase = 0x0100;
+// pes头(9字节固定头 + pts/dts共10字节) + aud(最长7字节)
+// PES header (9 bytes fixed header + 10 bytes of pts/dts) + aud (7 bytes at most)
+static constexpr size_t kMaxPesHeaderSize = 9 + 10 + 7;
+// 首个ts包自适应区最大长度(含pcr)
+// Max adaptation field length of the first TS packet (including pcr)
+static constexpr size_t kMaxAdaptationSize = 8;
+// 纯音频时pat/pmt发送间隔
+// pat/pmt interval for audio only streams
+static constexpr int64_t kPsiIntervalMS = 400;
+
+static uint32_t crc32Mpeg(const uint8_t *data, size_t bytes) {
+    static uint32_t s_table[256];
+    static bool s_inited = [] {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i << 24;
+            for (int j = 0; j < 8; ++j) {
+                crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : (crc << 1);
+            }
+            s_table[i] = crc;
+        }
+        return true;
+    }();
+    (void)s_inited;
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < bytes; ++i) {
+        crc = (crc << 8) ^ s_table[((crc >> 24) ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+static void writeTimestamp(uint8_t *ptr, uint8_t flag, uint64_t stamp) {
+    stamp &= 0x1FFFFFFFFULL;
+    ptr[0] = (flag << 4) | ((stamp >> 29) & 0x0E) | 0x01;
+    ptr[1] = (stamp >> 22) & 0xFF;
+    ptr[2] = ((stamp >> 14) & 0xFE) | 0x01;
+    ptr[3] = (stamp >> 7) & 0xFF;
+    ptr[4] = ((stamp << 1) & 0xFE) | 0x01;
+}
+
+static void writePcr(uint8_t *ptr, uint64_t base) {
+    base &= 0x1FFFFFFFFULL;
+    ptr[0] = (base >> 25) & 0xFF;
+    ptr[1] = (base >> 17) & 0xFF;
+    ptr[2] = (base >> 9) & 0xFF;
+    ptr[3] = (base >> 1) & 0xFF;
+    ptr[4] = ((base & 0x01) << 7) | 0x7E;
+    ptr[5] = 0x00;
+}
+
+static void writePacketHeader(uint8_t *ptr, bool unit_start, uint16_t pid, bool have_adaptation, uint8_t &cc) {
+    ptr[0] = 0x47;
+    ptr[1] = (unit_start ? 0x40 : 0x00) | ((pid >> 8) & 0x1F);
+    ptr[2] = pid & 0xFF;
+    ptr[3] = (have_adaptation ? 0x30 : 0x10) | (cc & 0x0F);
+    cc = (cc + 1) & 0x0F;
+}
+
+// 判断帧是否以aud开头
+// Whether the frame starts with an aud
+static bool startWithAud(CodecId codec, const char *data, size_t bytes) {
+    size_t prefix = 0;
+    if (bytes >= 4 && !memcmp(data, "\x00\x00\x00\x01", 4)) {
+        prefix = 4;
+    } else if (bytes >= 3 && !memcmp(data, "\x00\x00\x01", 3)) {
+        prefix = 3;
+    }
+    if (bytes <= prefix) {
+        return false;
+    }
+    auto nal = (uint8_t)data[prefix];
+    return codec == CodecH264 ? (nal & 0x1F) == 9 : ((nal >> 1) & 0x3F) == 35;
+}
+
+bool TsPacketizer::isSupported(CodecId codec) {
+    switch (codec) {
+        case CodecH264:
+        case CodecH265:
+        case CodecAAC: return true;
+        default: return false;
+    }
+}
+
+size_t TsPacketizer::maxOutputSize(size_t bytes) {
+    // pat + pmt + pes
+    auto packets = 2 + (bytes + kMaxPesHeaderSize + kMaxAdaptationSize + kPayloadSize - 1) / kPayloadSize;
+    return packets * kPacketSize;
+}
+
+int TsPacketizer::addStream(CodecId codec) {
+    if (!isSupported(codec)) {
+        return -1;
+    }
+    bool is_video = getTrackType(codec) == TrackVideo;
+    // stream_id按类型各自编号，首个视频流为0xE0，首个音频流为0xC0
+    // stream_id is numbered per type, the first video stream is 0xE0 and the first audio stream is 0xC0
+    auto same_type = std::count_if(_streams.begin(), _streams.end(), [&](const Stream &item) {
+        return (item.stream_id >= 0xE0) == is_video;
+    });
+    Stream stream;
+    stream.codec = codec;
+    stream.stream_type = getMpegIdByCodec(codec);
+    stream.stream_id = (is_video ? 0xE0 : 0xC0) + same_type;
+    stream.pid = kStreamPidBase + _streams.size();
+    if (is_video && !_have_video) {
+        // pcr优先由视频流携带
+        // pcr is preferably carried by the video stream
+        _have_video = true;
+        _pcr_pid = stream.pid;
+    } else if (_streams.empty()) {
+        _pcr_pid = stream.pid;
+    }
+    _streams.emplace_back(stream);
+    // 流变化后需要重发pat/pmt
+    // pat/pmt needs to be resent after the streams change
+    _last_psi_dts = -1;
+    return _streams.size() - 1;
+}
+
+void TsPacketizer::reset() {
+    _have_video = false;
+    _pat_cc = 0;
+    _pmt_cc = 0;
+    _pcr_pid = 0;
+    _last_psi_dts = -1;
+    _streams.clear();
+}
+
+void TsPacketizer::writeSection(uint16_t pid, uint8_t &cc, const uint8_t *section, size_t bytes, BufferRaw &out) {
+    auto packet = (uint8_t *)out.data() + out.size();
+    writePacketHeader(packet, true, pid, false, cc);
+    // pointer_field
+    packet[kHeaderSize] = 0x00;
+    memcpy(packet + kHeaderSize + 1, section, bytes);
+    memset(packet + kHeaderSize + 1 + bytes, 0xFF, kPayloadSize - 1 - bytes);
+    out.setSize(out.size() + kPacketSize);
+}
+
+void TsPacketizer::writePsi(uint64_t dts, BufferRaw &out) {
+    _last_psi_dts = dts;
+
+    uint8_t pat[16];
+    pat[0] = 0x00; // table_id
+    pat[1] = 0xB0; // section_syntax_indicator + section_length(高4位)
+    pat[2] = sizeof(pat) - 3; // section_length
+    pat[3] = 0x00; // transport_stream_id
+    pat[4] = 0x01;
+    pat[5] = 0xC1; // version_number + current_next_indicator
+    pat[6] = 0x00; // section_number
+    pat[7] = 0x00; // last_section_number
+    pat[8] = 0x00; // program_number
+    pat[9] = 0x01;
+    pat[10] = 0xE0 | ((kPmtPid >> 8) & 0x1F);
+    pat[11] = kPmtPid & 0xFF;
+    auto crc = crc32Mpeg(pat, 12);
+    pat[12] = crc >> 24;
+    pat[13] = crc >> 16;
+    pat[14] = crc >> 8;
+    pat[15] = crc;
+    writeSection(kPatPid, _pat_cc, pat, sizeof(pat), out);
+
+    uint8_t pmt[kPayloadSize - 1];
+    size_t section_length = 9 + 5 * _streams.size() + 4;
+    pmt[0] = 0x02; // table_id
+    pmt[1] = 0xB0 | ((section_length >> 8) & 0x0F);
+    pmt[2] = section_length & 0xFF;
+    pmt[3] = 0x00; // program_number
+    pmt[4] = 0x01;
+    pmt[5] = 0xC1;
+    pmt[6] = 0x00;
+    pmt[7] = 0x00;
+    pmt[8] = 0xE0 | ((_pcr_pid >> 8) & 0x1F);
+    pmt[9] = _pcr_pid & 0xFF;
+    pmt[10] = 0xF0; // program_info_length
+    pmt[11] = 0x00;
+    auto ptr = pmt + 12;
+    for (auto &stream : _streams) {
+        ptr[0] = stream.stream_type;
+        ptr[1] = 0xE0 | ((stream.pid >> 8) & 0x1F);
+        ptr[2] = stream.pid & 0xFF;
+        ptr[3] = 0xF0; // ES_info_length
+        ptr[4] = 0x00;
+        ptr += 5;
+    }
+    crc = crc32Mpeg(pmt, ptr - pmt);
+    ptr[0] = crc >> 24;
+    ptr[1] = crc >> 16;
+    ptr[2] = crc >> 8;
+    ptr[3] = crc;
+    ptr += 4;
+    writeSection(kPmtPid, _pmt_cc, pmt, ptr - pmt, out);
+}
+
+size_t TsPacketizer::makePesHeader(Stream &stream, uint64_t pts, uint64_t dts, const char *data, size_t bytes, uint8_t *header) {
+    bool have_dts = pts != dts;
+    header[0] = 0x00;
+    header[1] = 0x00;
+    header[2] = 0x01;
+    header[3] = stream.stream_id;
+    header[6] = 0x80;
+    header[7] = have_dts ? 0xC0 : 0x80;
+    header[8] = have_dts ? 10 : 5;
+    writeTimestamp(header + 9, have_dts ? 0x03 : 0x02, pts * 90);
+    if (have_dts) {
+        writeTimestamp(header + 14, 0x01, dts * 90);
+    }
+    size_t size = 9 + header[8];
+
+    switch (stream.codec) {
+        case CodecH264: {
+            if (!startWithAud(CodecH264, data, bytes)) {
+                memcpy(header + size, "\x00\x00\x00\x01\x09\xF0", 6);
+                size += 6;
+            }
+            break;
+        }
+        case CodecH265: {
+            if (!startWithAud(CodecH265, data, bytes)) {
+                memcpy(header + size, "\x00\x00\x00\x01\x46\x01\x50", 7);
+                size += 7;
+            }
+            break;
+        }
+        default: break;
+    }
+
+    // 视频pes长度置0(不限长度)，音频超过65535时同样置0
+    // The video PES length is set to 0 (unbounded), and so is audio longer than 65535
+    size_t pes_length = stream.stream_id >= 0xE0 ? 0 : size - 6 + bytes;
+    if (pes_length > 0xFFFF) {
+        pes_length = 0;
+    }
+    header[4] = (pes_length >> 8) & 0xFF;
+    header[5] = pes_length & 0xFF;
+    return size;
+}
+
+void TsPacketizer::input(int index, bool key, uint64_t pts, uint64_t dts, const char *data, size_t bytes, BufferRaw &out) {
+    auto &stream = _streams[index];
+    bool is_video = stream.stream_id >= 0xE0;
+    if (_last_psi_dts < 0 || (is_video && key) || (!_have_video && (int64_t)dts >= _last_psi_dts + kPsiIntervalMS)) {
+        // 关键帧前插入pat/pmt，确保从关键帧开始的切片可以独立解码
+        // Insert pat/pmt before key frames to ensure that segments starting from a key frame can be decoded independently
+        writePsi(dts, out);
+    }
+
+    uint8_t header[kMaxPesHeaderSize];
+    size_t header_size = makePesHeader(stream, pts, dts, data, bytes, header);
+    size_t header_offset = 0;
+    size_t remain = header_size + bytes;
+    bool pcr = stream.pid == _pcr_pid;
+    bool first = true;
+
+    while (remain) {
+        auto packet = (uint8_t *)out.data() + out.size();
+        // 首包自适应区：随机访问标记、pcr
+        // Adaptation field of the first packet: random access indicator, pcr
+        size_t adaptation_need = 0;
+        if (first && (pcr || (is_video && key))) {
+            adaptation_need = pcr ? 8 : 2;
+        }
+        size_t room = kPayloadSize - adaptation_need;
+        size_t take = MIN(remain, room);
+        // 末包负载不足时用自适应区填充
+        // Pad with adaptation field when the last packet is not full
+        size_t adaptation_size = adaptation_need + room - take;
+
+        writePacketHeader(packet, first, stream.pid, adaptation_size, stream.cc);
+        auto ptr = packet + kHeaderSize;
+        if (adaptation_size) {
+            ptr[0] = adaptation_size - 1;
+            if (adaptation_size > 1) {
+                size_t pos = 2;
+                ptr[1] = 0x00;
+                if (adaptation_need) {
+                    if (is_video && key) {
+                        ptr[1] |= 0x40;
+                    }
+                    if (pcr) {
+                        ptr[1] |= 0x10;
+                        writePcr(ptr + 2, dts * 90);
+                        pos += 6;
+                    }
+                }
+                memset(ptr + pos, 0xFF, adaptation_size - pos);
+            }
+            ptr += adaptation_size;
+        }
+
+        size_t left = take;
+        if (header_offset < header_size) {
+            auto copy = MIN(left, header_size - header_offset);
+            memcpy(ptr, header + header_offset, copy);
+            header_offset += copy;
+            ptr += copy;
+            left -= copy;
+        }
+        if (left) {
+            // 帧负载直接拷贝进ts包
+            // The frame payload is copied directly into the TS packet
+            memcpy(ptr, data, left);
+            data += left;
+        }
+        remain -= take;
+        first = false;
+        out.setSize(out.size() + kPacketSize);
+    }
+}
+
+} // namespace mediakit
+
+#endif // defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
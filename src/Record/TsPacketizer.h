@@ -0,0 +1,103 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef ZLMEDIAKIT_TSPACKETIZER_H
+#define ZLMEDIAKIT_TSPACKETIZER_H
+
+#if defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
+
+#include <vector>
+#include <cstdint>
+#include "Extension/Frame.h"
+#include "Network/Buffer.h"
+
+namespace mediakit {
+
+/**
+ * 内置mpeg-ts打包器
+ * ts包头与pes头直接写入调用方提供的内存块，帧负载从源数据一次性拷贝进ts包，无中间pes缓存
+ * Built-in mpeg-ts packetizer
+ * TS packet headers and PES headers are written directly into the memory block provided by the caller,
+ * the frame payload is copied into TS packets once from the source data, without an intermediate PES buffer
+ */
+class TsPacketizer {
+public:
+    static constexpr size_t kPacketSize = 188;
+
+    /**
+     * 是否支持该编码
+     * Whether the codec is supported
+     */
+    static bool isSupported(CodecId codec);
+
+    /**
+     * 封装一帧数据最多产生的字节数(188字节整数倍)
+     * @param bytes 帧长度
+     * Max number of bytes generated by muxing one frame (multiple of 188 bytes)
+     * @param bytes Frame length
+     */
+    static size_t maxOutputSize(size_t bytes);
+
+    /**
+     * 添加流
+     * @return 流索引，失败返回-1
+     * Add a stream
+     * @return Stream index, -1 on failure
+     */
+    int addStream(CodecId codec);
+
+    /**
+     * 清空所有流
+     * Clear all streams
+     */
+    void reset();
+
+    /**
+     * 封装一帧数据
+     * @param stream addStream返回的流索引
+     * @param key 是否为关键帧
+     * @param pts 显示时间戳，单位毫秒
+     * @param dts 解码时间戳，单位毫秒
+     * @param out 输出内存块，ts包追加到其尾部，剩余容量不得小于maxOutputSize(bytes)
+     * Mux one frame
+     * @param stream Stream index returned by addStream
+     * @param key Whether it is a key frame
+     * @param pts Presentation timestamp, in milliseconds
+     * @param dts Decoding timestamp, in milliseconds
+     * @param out Output memory block, TS packets are appended to its end, the remaining capacity must not be less than maxOutputSize(bytes)
+     */
+    void input(int stream, bool key, uint64_t pts, uint64_t dts, const char *data, size_t bytes, toolkit::BufferRaw &out);
+
+private:
+    struct Stream {
+        CodecId codec;
+        uint8_t stream_type;
+        uint8_t stream_id;
+        uint16_t pid;
+        uint8_t cc = 0;
+    };
+
+    void writePsi(uint64_t dts, toolkit::BufferRaw &out);
+    void writeSection(uint16_t pid, uint8_t &cc, const uint8_t *section, size_t bytes, toolkit::BufferRaw &out);
+    size_t makePesHeader(Stream &stream, uint64_t pts, uint64_t dts, const char *data, size_t bytes, uint8_t *header);
+
+private:
+    bool _have_video = false;
+    uint8_t _pat_cc = 0;
+    uint8_t _pmt_cc = 0;
+    uint16_t _pcr_pid = 0;
+    int64_t _last_psi_dts = -1;
+    std::vector<Stream> _streams;
+};
+
+} // namespace mediakit
+
+#endif // defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
+#endif // ZLMEDIAKIT_TSPACKETIZER_H
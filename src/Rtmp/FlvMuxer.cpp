@@ -47,6 +47,7 @@ void FlvMuxer::start(const EventPoller::Ptr &poller, const RtmpMediaSource::Ptr
     std::weak_ptr<FlvMuxer> weak_self = getSharedPtr();
     media->pause(false);
     _ring_reader = media->getRing()->attach(poller);
+    _egress_tracer = EgressTracer(media->getMetrics(), StreamMetrics::kLatencyFlv);
     _ring_reader->setGetInfoCB([weak_self]() {
         Any ret;
         ret.set(dynamic_pointer_cast<SockInfo>(weak_self.lock()));
@@ -61,13 +62,17 @@ void FlvMuxer::start(const EventPoller::Ptr &poller, const RtmpMediaSource::Ptr
     });
 
     bool check = start_pts > 0;
-    _ring_reader->setReadCB([weak_self, start_pts, check](const RtmpMediaSource::RingDataType &pkt) mutable {
+    _ring_reader->setReadCB(media->wrapReadCB([weak_self, start_pts, check](const RtmpMediaSource::RingDataType &pkt) mutable {
         auto strong_self = weak_self.lock();
         if (!strong_self) {
             return;
         }
 
+        if (!strong_self->onCheckSlowReader(pkt->front()->gop_start, pkt->size())) {
+            return;
+        }
         size_t i = 0;
+        uint64_t ingest_stamp = 0;
         auto size = pkt->size();
         pkt->for_each([&](const RtmpPacket::Ptr &rtmp) {
             if (check) {
@@ -77,8 +82,11 @@ void FlvMuxer::start(const EventPoller::Ptr &poller, const RtmpMediaSource::Ptr
                 check = false;
             }
             strong_self->onWriteRtmp(rtmp, ++i == size);
+            ingest_stamp = ingest_stamp ? ingest_stamp : rtmp->ingest_stamp;
         });
-    });
+        strong_self->_egress_tracer.trace(ingest_stamp);
+    }));
+    _egress_tracer.setLive();
 }
 
 BufferRaw::Ptr FlvMuxer::obtainBuffer() {
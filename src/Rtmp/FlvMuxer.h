@@ -31,6 +31,17 @@ protected:
     virtual void onDetach() = 0;
     virtual std::shared_ptr<FlvMuxer> getSharedPtr() = 0;
 
+    /**
+     * 收到环形缓冲的一批数据时调用，返回false时丢弃该批数据，用于慢速播放器检测
+     * @param gop_start 该批数据是否从可以开始播放的位置开始
+     * @param packets 该批数据包个数
+     * Called when a batch of data of the ring buffer is received, the batch is dropped when false is returned,
+     * used for slow reader detection
+     * @param gop_start Whether the batch starts from a position that playback can start from
+     * @param packets Number of packets of the batch
+     */
+    virtual bool onCheckSlowReader(bool gop_start, size_t packets) { return true; }
+
 private:
     void onWriteFlvHeader(const RtmpMediaSource::Ptr &src);
     void onWriteRtmp(const RtmpPacket::Ptr &pkt, bool flush);
@@ -42,6 +53,9 @@ private:
 private:
     toolkit::ResourcePool<toolkit::BufferRaw> _packet_pool;
     RtmpMediaSource::RingType::RingReader::Ptr _ring_reader;
+    // 出口时延采样
+    // Egress latency sampling
+    EgressTracer _egress_tracer;
 };
 
 class FlvRecorder : public FlvMuxer , public std::enable_shared_from_this<FlvRecorder>{
@@ -10,6 +10,7 @@
 
 #include "Rtmp.h"
 #include "Common/config.h"
+#include "Common/MediaMetrics.h"
 #include "Extension/Factory.h"
 
 namespace mediakit {
@@ -137,7 +138,9 @@ RtmpPacket::Ptr RtmpPacket::create() {
     ret->clear();
     return ret;
 #else
-    return Ptr(new RtmpPacket);
+    auto ret = Ptr(new RtmpPacket);
+    ret->ingest_stamp = LatencyTracer::current();
+    return ret;
 #endif
 }
 
@@ -146,6 +149,8 @@ void RtmpPacket::clear() {
     time_stamp = 0;
     ts_field = 0;
     body_size = 0;
+    ingest_stamp = 0;
+    gop_start = false;
     buffer.clear();
 }
 
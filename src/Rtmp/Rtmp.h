@@ -182,6 +182,12 @@ public:
     uint32_t stream_index;
     uint32_t chunk_id;
     size_t body_size;
+    // 时延采样时间戳，为0时代表未采样，参考LatencyTracer
+    // Latency sampling timestamp, 0 means not sampled, refer to LatencyTracer
+    uint64_t ingest_stamp = 0;
+    // 是否为一批数据中可以开始播放的位置(视频关键帧或纯音频)，慢速播放器跳帧时使用
+    // Whether it is the position in a batch that playback can start from (video key frame or audio only), used when a slow reader skips
+    bool gop_start = false;
     toolkit::BufferLikeString buffer;
 
 public:
@@ -225,6 +231,9 @@ private:
     // 对象个数统计  [AUTO-TRANSLATED:3b43e8c2]
     // Object count statistics
     toolkit::ObjectStatistic<RtmpPacket> _statistic;
+    // 内存分配采样统计
+    // Sampled memory allocation statistics
+    AllocProfiler::Tracker _alloc_tracker { AllocProfiler::kRtmpPacket, this, [](const void *owner) { return ((const RtmpPacket *)owner)->buffer.size(); } };
 };
 
 /**
@@ -20,6 +20,7 @@
 #include "Rtmp.h"
 #include "Common/MediaSource.h"
 #include "Common/PacketCache.h"
+#include "Common/FrameGopCache.h"
 #include "Util/RingBuffer.h"
 
 #define RTMP_GOP_SIZE 512
@@ -40,7 +41,7 @@ namespace mediakit {
  
  * [AUTO-TRANSLATED:72d515c8]
  */
-class RtmpMediaSource : public MediaSource, public toolkit::RingDelegate<RtmpPacket::Ptr>, private PacketCache<RtmpPacket>{
+class RtmpMediaSource : public MediaSource, public toolkit::RingDelegate<RtmpPacket::Ptr>, public LazyGopSource<RtmpPacket>, private PacketCache<RtmpPacket>{
 public:
     using Ptr = std::shared_ptr<RtmpMediaSource>;
     using RingDataType = std::shared_ptr<toolkit::List<RtmpPacket::Ptr> >;
@@ -178,7 +179,15 @@ private:
     void onFlush(std::shared_ptr<toolkit::List<RtmpPacket::Ptr> > rtmp_list, bool key_pos) override {
         // 如果不存在视频，那么就没有存在GOP缓存的意义，所以is_key一直为true确保一直清空GOP缓存  [AUTO-TRANSLATED:5818a8d8]
         // If there is no video, then there is no point in having a GOP cache, so is_key is always true to ensure that the GOP cache is always cleared
-        _ring->write(std::move(rtmp_list), _have_video ? key_pos : true);
+        // 统一gop缓存模式下gop由帧缓存按需打包，环形缓冲只保留最新数据
+        // In unified gop cache mode the gop is packetized on demand from the frame cache, the ring buffer only keeps the latest data
+        auto gop_reset = _have_video && !isLazyGop() ? key_pos : true;
+        rtmp_list->front()->gop_start = _have_video ? key_pos : true;
+        auto drop_gop = onPacketFlush(gop_reset, _ring->readerCount());
+        _ring->write(std::move(rtmp_list), gop_reset);
+        if (drop_gop) {
+            _ring->clearCache();
+        }
     }
 
 private:
@@ -49,6 +49,7 @@ void RtmpMediaSource::setMetaData(const AMFValue &metadata) {
 void RtmpMediaSource::onWrite(RtmpPacket::Ptr pkt, bool /*= true*/) {
     bool is_video = pkt->type_id == MSG_VIDEO;
     _speed[is_video ? TrackVideo : TrackAudio] += pkt->size();
+    onPacketWrite(pkt->size(), pkt->ingest_stamp);
     // 保存当前时间戳  [AUTO-TRANSLATED:2b09ff42]
     // Save the current timestamp
     switch (pkt->type_id) {
@@ -16,6 +16,18 @@
 
 namespace mediakit {
 
+// 统一gop缓存模式下，收集按需打包gop产生的rtmp包
+// Collect the rtmp packets generated by packetizing the gop on demand in unified gop cache mode
+class RtmpGopCollector final : public toolkit::RingDelegate<RtmpPacket::Ptr> {
+public:
+    RtmpGopCollector(GopPacketizer<RtmpPacket>::onPacket cb) { _cb = std::move(cb); }
+
+    void onWrite(RtmpPacket::Ptr in, bool is_key = true) override { _cb(std::move(in)); }
+
+private:
+    GopPacketizer<RtmpPacket>::onPacket _cb;
+};
+
 class RtmpMediaSourceMuxer final : public RtmpMuxer, public MediaSourceEventInterceptor,
                                    public std::enable_shared_from_this<RtmpMediaSourceMuxer> {
 public:
@@ -50,6 +62,19 @@ public:
         return _media_src->readerCount();
     }
 
+    /**
+     * 开启统一gop缓存，环形缓冲不再缓存gop，新播放器的gop从帧缓存按需打包
+     * Enable unified gop cache, the ring buffer no longer caches the gop, the gop of new players is packetized on demand from the frame cache
+     */
+    void setGopCache(const FrameGopCache::Ptr &cache) {
+        auto packetizer = GopPacketizer<RtmpPacket>::create(cache, [](GopPacketizer<RtmpPacket>::onPacket cb) -> MediaSinkInterface::Ptr {
+            auto muxer = std::make_shared<RtmpMuxer>(nullptr);
+            muxer->getRtmpRing()->setDelegate(std::make_shared<RtmpGopCollector>(std::move(cb)));
+            return muxer;
+        });
+        _media_src->setGopMaker([packetizer](uint64_t stamp) { return packetizer->makeGop(stamp); });
+    }
+
     void addTrackCompleted() override {
         RtmpMuxer::addTrackCompleted();
         makeConfigPacket();
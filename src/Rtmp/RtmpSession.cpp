@@ -10,6 +10,7 @@
 
 #include "RtmpSession.h"
 #include "Common/config.h"
+#include "Common/PollerMonitor.h"
 #include "Util/onceToken.h"
 
 using namespace std;
@@ -303,18 +304,24 @@ void RtmpSession::sendPlayResponse(const string &err, const RtmpMediaSource::Ptr
 
     src->pause(false);
     _ring_reader = src->getRing()->attach(getPoller());
+    _egress_tracer = EgressTracer(src->getMetrics(), StreamMetrics::kLatencyRtmp);
     weak_ptr<RtmpSession> weak_self = static_pointer_cast<RtmpSession>(shared_from_this());
     _ring_reader->setGetInfoCB([weak_self]() {
         Any ret;
         ret.set(static_pointer_cast<SockInfo>(weak_self.lock()));
         return ret;
     });
-    _ring_reader->setReadCB([weak_self](const RtmpMediaSource::RingDataType &pkt) {
+    _ring_reader->setReadCB(src->wrapReadCB([weak_self](const RtmpMediaSource::RingDataType &pkt) {
         auto strong_self = weak_self.lock();
         if (!strong_self) {
             return;
         }
+        if (!strong_self->checkSlowReader(pkt->front()->gop_start, strong_self->isSocketBusy(), pkt->size())) {
+            return;
+        }
+        PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginSend, strong_self->_media_info);
         size_t i = 0;
+        uint64_t ingest_stamp = 0;
         auto size = pkt->size();
         strong_self->setSendFlushFlag(false);
         pkt->for_each([&](const RtmpPacket::Ptr &rtmp){
@@ -322,8 +329,11 @@ void RtmpSession::sendPlayResponse(const string &err, const RtmpMediaSource::Ptr
                 strong_self->setSendFlushFlag(true);
             }
             strong_self->onSendMedia(rtmp);
+            ingest_stamp = ingest_stamp ? ingest_stamp : rtmp->ingest_stamp;
         });
-    });
+        strong_self->_egress_tracer.trace(ingest_stamp);
+    }));
+    _egress_tracer.setLive();
     _ring_reader->setDetachCB([weak_self]() {
         auto strong_self = weak_self.lock();
         if (!strong_self) {
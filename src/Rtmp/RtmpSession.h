@@ -17,12 +17,13 @@
 #include "utils.h"
 #include "RtmpProtocol.h"
 #include "RtmpMediaSourceImp.h"
+#include "Common/SlowReaderGuard.h"
 #include "Util/TimeTicker.h"
 #include "Network/Session.h"
 
 namespace mediakit {
 
-class RtmpSession : public toolkit::Session, public RtmpProtocol, public MediaSourceEvent {
+class RtmpSession : public toolkit::Session, public RtmpProtocol, public MediaSourceEvent, public SlowReaderGuard {
 public:
     using Ptr = std::shared_ptr<RtmpSession>;
 
@@ -109,6 +110,9 @@ private:
     RtmpMediaSourceImp::Ptr _push_src;
     std::shared_ptr<void> _push_src_ownership;
     RtmpMediaSource::RingType::RingReader::Ptr _ring_reader;
+    // 出口时延采样
+    // Egress latency sampling
+    EgressTracer _egress_tracer;
 };
 
 /**
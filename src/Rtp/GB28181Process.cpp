@@ -15,8 +15,10 @@
 #include "Http/HttpTSPlayer.h"
 #include "Util/File.h"
 #include "Common/config.h"
+#include "Common/PollerMonitor.h"
 #include "Rtsp/RtpReceiver.h"
 #include "Rtsp/Rtsp.h"
+#include "Thread/WorkThreadPool.h"
 
 using namespace std;
 using namespace toolkit;
@@ -50,12 +52,68 @@ private:
     int _sample_rate;
 };
 
+// 在解复用线程产生的track与frame，切换回rtp接收线程后再输出
+// Tracks and frames generated in the demux thread are output after switching back to the rtp receive thread
+class DemuxSinkProxy : public MediaSinkInterface {
+public:
+    DemuxSinkProxy(toolkit::EventPoller::Ptr poller, std::weak_ptr<GB28181Process> process, MediaSinkInterface *sink) {
+        _poller = std::move(poller);
+        _process = std::move(process);
+        _sink = sink;
+    }
+
+    bool addTrack(const Track::Ptr &track) override {
+        post([track](MediaSinkInterface *sink) { sink->addTrack(track); });
+        return true;
+    }
+
+    void addTrackCompleted() override {
+        post([](MediaSinkInterface *sink) { sink->addTrackCompleted(); });
+    }
+
+    void resetTracks() override {
+        post([](MediaSinkInterface *sink) { sink->resetTracks(); });
+    }
+
+    bool inputFrame(const Frame::Ptr &frame) override {
+        // 帧数据指向解复用器内部缓存，跨线程前需要拷贝
+        // The frame data points to the demuxer's internal buffer, it must be copied before crossing threads
+        auto frame_cached = Frame::getCacheAbleFrame(frame);
+        post([frame_cached](MediaSinkInterface *sink) { sink->inputFrame(frame_cached); });
+        return true;
+    }
+
+private:
+    void post(std::function<void(MediaSinkInterface *sink)> cb) {
+        std::weak_ptr<GB28181Process> weak_process = _process;
+        auto sink = _sink;
+        _poller->async([weak_process, sink, cb]() {
+            // GB28181Process销毁后，其所属的sink也已经无效
+            // When GB28181Process is destroyed, its sink is invalid too
+            if (weak_process.lock()) {
+                cb(sink);
+            }
+        }, false);
+    }
+
+private:
+    MediaSinkInterface *_sink;
+    toolkit::EventPoller::Ptr _poller;
+    std::weak_ptr<GB28181Process> _process;
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 
 GB28181Process::GB28181Process(const MediaInfo &media_info, MediaSinkInterface *sink) {
     assert(sink);
     _media_info = media_info;
     _interface = sink;
+
+    GET_CONFIG(bool, demux_in_worker, RtpProxy::kDemuxInWorker);
+    _owner_poller = EventPoller::getCurrentPoller();
+    // 只有在事件线程中创建时才能把解复用结果切换回来
+    // Demux results can only be switched back when it is created in an event thread
+    _demux_in_worker = demux_in_worker && _owner_poller;
 }
 
 void GB28181Process::onRtpSorted(RtpPacket::Ptr rtp) {
@@ -63,9 +121,28 @@ void GB28181Process::onRtpSorted(RtpPacket::Ptr rtp) {
 }
 
 void GB28181Process::flush() {
-    if (_decoder) {
+    if (!_decoder) {
+        return;
+    }
+    if (!_demux_in_worker) {
         _decoder->flush();
+        return;
+    }
+    auto decoder = _decoder;
+    _demux_poller->async([decoder]() { decoder->flush(); }, false);
+}
+
+void GB28181Process::createDecoder(DecoderImp::Type type) {
+    if (!_demux_in_worker) {
+        _decoder = DecoderImp::createDecoder(type, _interface);
+        return;
     }
+    // 解复用器在后台线程运行，同一路流的数据投递到同一线程，保证顺序
+    // The demuxer runs in a background thread, data of one stream is posted to the same thread to keep its order
+    _demux_poller = WorkThreadPool::Instance().getPoller();
+    _demux_sink = std::make_shared<DemuxSinkProxy>(_owner_poller, shared_from_this(), _interface);
+    _demux_tuple = std::make_shared<MediaTuple>(_media_info);
+    _decoder = DecoderImp::createDecoder(type, _demux_sink.get());
 }
 
 bool GB28181Process::inputRtp(bool, const char *data, size_t data_len) {
@@ -191,18 +268,32 @@ void GB28181Process::onRtpDecode(const Frame::Ptr &frame) {
             // 猜测是ts负载  [AUTO-TRANSLATED:c2be3a47]
             // Guess it is a ts payload
             InfoL << _media_info.stream << " judged to be TS";
-            _decoder = DecoderImp::createDecoder(DecoderImp::decoder_ts, _interface);
+            createDecoder(DecoderImp::decoder_ts);
         } else {
             // 猜测是ps负载  [AUTO-TRANSLATED:b7c0ff45]
             // Guess it is a ps payload
             InfoL << _media_info.stream << " judged to be PS";
-            _decoder = DecoderImp::createDecoder(DecoderImp::decoder_ps, _interface);
+            createDecoder(DecoderImp::decoder_ps);
         }
     }
 
-    if (_decoder) {
+    if (!_decoder) {
+        return;
+    }
+    if (!_demux_in_worker) {
         _decoder->input(reinterpret_cast<const uint8_t *>(frame->data()), frame->size());
+        return;
     }
+    // 解复用器与代理sink由任务持有，GB28181Process销毁后剩余任务仍可安全执行
+    // The demuxer and proxy sink are held by the task, the remaining tasks can still run safely after GB28181Process is destroyed
+    auto decoder = _decoder;
+    auto sink = _demux_sink;
+    auto tuple = _demux_tuple;
+    auto frame_cached = Frame::getCacheAbleFrame(frame);
+    _demux_poller->async([decoder, sink, tuple, frame_cached]() {
+        PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginDemux, *tuple);
+        decoder->input(reinterpret_cast<const uint8_t *>(frame_cached->data()), frame_cached->size());
+    }, false);
 }
 
 } // namespace mediakit
@@ -18,11 +18,12 @@
 #include "Http/HttpRequestSplitter.h"
 #include "Rtsp/RtpCodec.h"
 #include "Common/MediaSource.h"
+#include "Poller/EventPoller.h"
 
 namespace mediakit{
 
 class RtpReceiverImp;
-class GB28181Process : public ProcessInterface {
+class GB28181Process : public ProcessInterface, public std::enable_shared_from_this<GB28181Process> {
 public:
     using Ptr = std::shared_ptr<GB28181Process>;
 
@@ -56,8 +57,22 @@ protected:
 
 private:
     void onRtpDecode(const Frame::Ptr &frame);
+    void createDecoder(DecoderImp::Type type);
 
 private:
+    // 是否在后台线程解复用ps/ts
+    // Whether to demux ps/ts in a background thread
+    bool _demux_in_worker = false;
+    // ps/ts解复用线程，同一路流固定在同一线程以保证顺序
+    // ps/ts demux thread, a stream is bound to one thread to keep its order
+    toolkit::EventPoller::Ptr _demux_poller;
+    // 解复用结果回调至该线程(rtp接收线程)
+    // Demux results are delivered back to this thread (rtp receive thread)
+    toolkit::EventPoller::Ptr _owner_poller;
+    std::shared_ptr<MediaSinkInterface> _demux_sink;
+    // 供后台线程统计解复用耗时
+    // Used by the background thread to count the demux time
+    std::shared_ptr<const MediaTuple> _demux_tuple;
     MediaInfo _media_info;
     DecoderImp::Ptr _decoder;
     MediaSinkInterface *_interface;
@@ -13,6 +13,7 @@
 #include "RtpProcess.h"
 #include "Util/File.h"
 #include "Common/config.h"
+#include "Common/PollerMonitor.h"
 
 using namespace std;
 using namespace toolkit;
@@ -140,6 +141,7 @@ bool RtpProcess::inputRtp(bool is_udp, const Socket::Ptr &sock, const char *data
         return false;
     }
 
+    PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginDemux, _media_info);
     bool ret = _process ? _process->inputRtp(is_udp, data, len) : false;
     if (dts_out) {
         *dts_out = _dts;
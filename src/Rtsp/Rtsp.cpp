@@ -15,6 +15,7 @@
 #include "Network/Socket.h"
 #include "Common/Parser.h"
 #include "Common/config.h"
+#include "Common/MediaMetrics.h"
 #include "Extension/Track.h"
 #include "Extension/Factory.h"
 
@@ -699,7 +700,9 @@ RtpPacket::Ptr RtpPacket::create() {
     ret->setSize(0);
     return ret;
 #else
-    return Ptr(new RtpPacket);
+    auto ret = Ptr(new RtpPacket);
+    ret->ingest_stamp = LatencyTracer::current();
+    return ret;
 #endif
 }
 
@@ -199,6 +199,12 @@ public:
     uint64_t ntp_stamp;
 
     int track_index;
+    // 时延采样时间戳，为0时代表未采样，参考LatencyTracer
+    // Latency sampling timestamp, 0 means not sampled, refer to LatencyTracer
+    uint64_t ingest_stamp = 0;
+    // 是否为一批数据中可以开始播放的位置(视频关键帧或纯音频)，慢速播放器跳帧时使用
+    // Whether it is the position in a batch that playback can start from (video key frame or audio only), used when a slow reader skips
+    bool gop_start = false;
 
     static Ptr create();
 
@@ -210,6 +216,9 @@ private:
     // 对象个数统计  [AUTO-TRANSLATED:f4a012d0]
     // Object Count Statistics
     toolkit::ObjectStatistic<RtpPacket> _statistic;
+    // 内存分配采样统计
+    // Sampled memory allocation statistics
+    AllocProfiler::Tracker _alloc_tracker { AllocProfiler::kRtpPacket, this, [](const void *owner) { return ((const RtpPacket *)owner)->size(); } };
 };
 
 class RtpPayload {
@@ -196,7 +196,13 @@ private:
     void onFlush(std::shared_ptr<toolkit::List<RtpPacket::Ptr> > rtp_list, bool key_pos) override {
         // 如果不存在视频，那么就没有存在GOP缓存的意义，所以is_key一直为true确保一直清空GOP缓存  [AUTO-TRANSLATED:5818a8d8]
         // If there is no video, then there is no point in having a GOP cache, so is_key is always true to ensure that the GOP cache is always cleared
-        _ring->write(std::move(rtp_list), _have_video ? key_pos : true);
+        auto gop_reset = _have_video ? key_pos : true;
+        rtp_list->front()->gop_start = _have_video ? key_pos : true;
+        auto drop_gop = onPacketFlush(gop_reset, _ring->readerCount());
+        _ring->write(std::move(rtp_list), gop_reset);
+        if (drop_gop) {
+            _ring->clearCache();
+        }
     }
 
 private:
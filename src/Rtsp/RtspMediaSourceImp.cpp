@@ -51,6 +51,7 @@ void RtspMediaSource::setTimeStamp(uint32_t stamp) {
 
 void RtspMediaSource::onWrite(RtpPacket::Ptr rtp, bool keyPos) {
     _speed[rtp->type] += rtp->size();
+    onPacketWrite(rtp->size(), rtp->ingest_stamp);
     assert(rtp->type >= 0 && rtp->type < TrackMax);
     auto &track = _tracks[rtp->type];
     auto stamp = rtp->getStampMS();
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <iomanip>
 #include "Common/config.h"
+#include "Common/PollerMonitor.h"
 #include "UDPServer.h"
 #include "RtspSession.h"
 #include "Util/MD5.h"
@@ -855,6 +856,7 @@ void RtspSession::handleReq_Play(const Parser &parser) {
     if (!_play_reader && _rtp_type != Rtsp::RTP_MULTICAST) {
         weak_ptr<RtspSession> weak_self = static_pointer_cast<RtspSession>(shared_from_this());
         _play_reader = play_src->getRing()->attach(getPoller(), use_gop);
+        _egress_tracer = EgressTracer(play_src->getMetrics(), StreamMetrics::kLatencyRtsp);
         _play_reader->setGetInfoCB([weak_self]() {
             Any ret;
             ret.set(static_pointer_cast<SockInfo>(weak_self.lock()));
@@ -872,8 +874,15 @@ void RtspSession::handleReq_Play(const Parser &parser) {
             if (!strong_self) {
                 return;
             }
+            // udp方式发送rtp时无法通过tcp socket判断拥塞
+            // Congestion can not be judged by the tcp socket when sending rtp over udp
+            if (strong_self->_rtp_type == Rtsp::RTP_TCP
+                && !strong_self->checkSlowReader(pack->front()->gop_start, strong_self->isSocketBusy(), pack->size())) {
+                return;
+            }
             strong_self->sendRtpPacket(pack);
         });
+        _egress_tracer.setLive();
     }
 }
 
@@ -1224,6 +1233,10 @@ void RtspSession::updateRtcpContext(const RtpPacket::Ptr &rtp){
 }
 
 void RtspSession::sendRtpPacket(const RtspMediaSource::RingDataType &pkt) {
+    PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginSend, _media_info);
+    // 每批数据最多采样一次
+    // Sample at most once per batch
+    uint64_t ingest_stamp = 0;
     switch (_rtp_type) {
         case Rtsp::RTP_TCP: {
             setSendFlushFlag(false);
@@ -1231,6 +1244,7 @@ void RtspSession::sendRtpPacket(const RtspMediaSource::RingDataType &pkt) {
                 if (_target_play_track == TrackInvalid || _target_play_track == rtp->type) {
                     updateRtcpContext(rtp);
                     send(rtp);
+                    ingest_stamp = ingest_stamp ? ingest_stamp : rtp->ingest_stamp;
                 }
             });
             flushAll();
@@ -1252,6 +1266,7 @@ void RtspSession::sendRtpPacket(const RtspMediaSource::RingDataType &pkt) {
                     }
                     _bytes_usage += rtp->size() - RtpPacket::kRtpTcpHeaderSize;
                     sock->send(std::make_shared<BufferRtp>(rtp, RtpPacket::kRtpTcpHeaderSize), nullptr, 0, false);
+                    ingest_stamp = ingest_stamp ? ingest_stamp : rtp->ingest_stamp;
                 }
             });
             for (auto &sock : rtp_socks) {
@@ -1264,6 +1279,9 @@ void RtspSession::sendRtpPacket(const RtspMediaSource::RingDataType &pkt) {
         default:
             break;
     }
+    // 写入socket后统计时延
+    // Count the latency after writing into the socket
+    _egress_tracer.trace(ingest_stamp);
 }
 
 void RtspSession::setSocketFlags(){
@@ -21,11 +21,12 @@
 #include "RtspMediaSource.h"
 #include "RtspMediaSourceImp.h"
 #include "RtpMultiCaster.h"
+#include "Common/SlowReaderGuard.h"
 
 namespace mediakit {
 
 using BufferRtp = toolkit::BufferOffset<toolkit::Buffer::Ptr>;
-class RtspSession : public toolkit::Session, public RtspSplitter, public RtpReceiver, public MediaSourceEvent {
+class RtspSession : public toolkit::Session, public RtspSplitter, public RtpReceiver, public MediaSourceEvent, public SlowReaderGuard {
 public:
     using Ptr = std::shared_ptr<RtspSession>;
     using onGetRealm = std::function<void(const std::string &realm)>;
@@ -237,6 +238,9 @@ private:
     // 直播源读取器  [AUTO-TRANSLATED:e1edc193]
     // Live source reader
     RtspMediaSource::RingType::RingReader::Ptr _play_reader;
+    // 出口时延采样
+    // Egress latency sampling
+    EgressTracer _egress_tracer;
     // sdp里面有效的track,包含音频或视频  [AUTO-TRANSLATED:64e2fcdf]
     // Valid track in SDP, including audio or video
     std::vector<SdpTrack::Ptr> _sdp_track;
@@ -13,6 +13,7 @@
 
 #include "Common/MediaSource.h"
 #include "Common/PacketCache.h"
+#include "Common/FrameGopCache.h"
 #include "Util/RingBuffer.h"
 
 #define TS_GOP_SIZE 512
@@ -30,11 +31,14 @@ public:
 
 public:
     uint64_t time_stamp = 0;
+    // 是否为一批数据中可以开始播放的位置(视频关键帧或纯音频)，慢速播放器跳帧时使用
+    // Whether it is the position in a batch that playback can start from (video key frame or audio only), used when a slow reader skips
+    bool gop_start = false;
 };
 
 // TS直播源  [AUTO-TRANSLATED:0d25ead6]
 // TS Live Source
-class TSMediaSource final : public MediaSource, public toolkit::RingDelegate<TSPacket::Ptr>, private PacketCache<TSPacket>{
+class TSMediaSource final : public MediaSource, public toolkit::RingDelegate<TSPacket::Ptr>, public LazyGopSource<TSPacket>, private PacketCache<TSPacket>{
 public:
     using Ptr = std::shared_ptr<TSMediaSource>;
     using RingDataType = std::shared_ptr<toolkit::List<TSPacket::Ptr> >;
@@ -87,6 +91,7 @@ public:
      */
     void onWrite(TSPacket::Ptr packet, bool key) override {
         _speed[TrackVideo] += packet->size();
+        onPacketWrite(packet->size());
         if (!_ring) {
             createRing();
         }
@@ -136,7 +141,15 @@ private:
     void onFlush(std::shared_ptr<toolkit::List<TSPacket::Ptr> > packet_list, bool key_pos) override {
         // 如果不存在视频，那么就没有存在GOP缓存的意义，所以确保一直清空GOP缓存  [AUTO-TRANSLATED:66208f94]
         // If there is no video, then there is no meaning to the existence of GOP cache, so make sure to clear the GOP cache all the time
-        _ring->write(std::move(packet_list), _have_video ? key_pos : true);
+        // 统一gop缓存模式下gop由帧缓存按需打包，环形缓冲只保留最新数据
+        // In unified gop cache mode the gop is packetized on demand from the frame cache, the ring buffer only keeps the latest data
+        auto gop_reset = _have_video && !isLazyGop() ? key_pos : true;
+        packet_list->front()->gop_start = _have_video ? key_pos : true;
+        auto drop_gop = onPacketFlush(gop_reset, _ring->readerCount());
+        _ring->write(std::move(packet_list), gop_reset);
+        if (drop_gop) {
+            _ring->clearCache();
+        }
     }
 
 private:
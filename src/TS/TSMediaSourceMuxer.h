@@ -13,9 +13,120 @@
 
 #include "TSMediaSource.h"
 #include "Record/MPEG.h"
+#include "Record/TsPacketizer.h"
 
 namespace mediakit {
 
+// 统一gop缓存模式下，为新播放器按需打包gop的ts封装器
+// Ts muxer that packetizes the gop on demand for new players in unified gop cache mode
+class TSGopMuxer final : public MpegMuxer {
+public:
+    TSGopMuxer(GopPacketizer<TSPacket>::onPacket cb) : MpegMuxer(false) { _cb = std::move(cb); }
+
+protected:
+    void onWrite(std::shared_ptr<toolkit::Buffer> buffer, uint64_t timestamp, bool key_pos) override {
+        if (!buffer) {
+            return;
+        }
+        auto packet = std::make_shared<TSPacket>(std::move(buffer));
+        packet->time_stamp = timestamp;
+        _cb(std::move(packet));
+    }
+
+private:
+    GopPacketizer<TSPacket>::onPacket _cb;
+};
+
+/**
+ * 按需打包的gop由独立封装器生成，其连续计数器与直播ts不衔接
+ * 在每个pid的首个直播ts包前插入一个仅含适配域且置位discontinuity_indicator的ts包，其连续计数器取直播ts包的前一个值，
+ * 播放器据此接受gop与直播ts间的计数跳变
+ * The gop packetized on demand is generated by a separate muxer, its continuity counters do not join the live ts.
+ * An adaptation field only ts packet with discontinuity_indicator set is inserted before the first live ts packet of each pid,
+ * its continuity counter is the one before the live ts packet, so the player accepts the counter jump between the gop and the live ts
+ */
+class TSGopJoiner {
+public:
+    using RingDataType = TSMediaSource::RingDataType;
+    using onReadCB = LazyGopSource<TSPacket>::onReadCB;
+
+    static onReadCB join(const RingDataType &gop, onReadCB cb) {
+        auto pending = std::make_shared<std::vector<uint16_t> >();
+        gop->for_each([&](const TSPacket::Ptr &packet) {
+            forEachTsPacket(packet, [&](const uint8_t *ts) {
+                auto pid = getPid(ts);
+                if (std::find(pending->begin(), pending->end(), pid) == pending->end()) {
+                    pending->emplace_back(pid);
+                }
+            });
+        });
+        if (pending->empty()) {
+            return cb;
+        }
+        return [pending, cb](const RingDataType &data) {
+            if (pending->empty()) {
+                cb(data);
+                return;
+            }
+            auto ret = std::make_shared<toolkit::List<TSPacket::Ptr> >();
+            data->for_each([&](const TSPacket::Ptr &packet) {
+                // 该ts包中首次出现的pid及其连续计数器
+                // Pids that show up for the first time in this ts packet and their continuity counters
+                std::vector<std::pair<uint16_t, uint8_t> > joined;
+                forEachTsPacket(packet, [&](const uint8_t *ts) {
+                    auto it = std::find(pending->begin(), pending->end(), getPid(ts));
+                    if (it != pending->end()) {
+                        pending->erase(it);
+                        joined.emplace_back(getPid(ts), ts[3] & 0x0F);
+                    }
+                });
+                if (!joined.empty()) {
+                    auto marker = toolkit::BufferRaw::create();
+                    marker->setCapacity(joined.size() * TsPacketizer::kPacketSize);
+                    marker->setSize(0);
+                    for (auto &pr : joined) {
+                        writeMarker(pr.first, pr.second, *marker);
+                    }
+                    auto marker_packet = std::make_shared<TSPacket>(std::move(marker));
+                    marker_packet->time_stamp = packet->time_stamp;
+                    ret->emplace_back(std::move(marker_packet));
+                }
+                ret->emplace_back(packet);
+            });
+            cb(ret);
+        };
+    }
+
+private:
+    static uint16_t getPid(const uint8_t *ts) { return ((ts[1] & 0x1F) << 8) | ts[2]; }
+
+    template <typename FUNC>
+    static void forEachTsPacket(const TSPacket::Ptr &packet, FUNC &&func) {
+        auto ptr = (const uint8_t *)packet->data();
+        auto end = ptr + packet->size() / TsPacketizer::kPacketSize * TsPacketizer::kPacketSize;
+        for (; ptr < end; ptr += TsPacketizer::kPacketSize) {
+            if (ptr[0] == 0x47) {
+                func(ptr);
+            }
+        }
+    }
+
+    static void writeMarker(uint16_t pid, uint8_t live_cc, toolkit::BufferRaw &out) {
+        auto ptr = (uint8_t *)out.data() + out.size();
+        ptr[0] = 0x47;
+        ptr[1] = (pid >> 8) & 0x1F;
+        ptr[2] = pid & 0xFF;
+        // 仅含适配域的包不递增连续计数器，下一个直播ts包的计数器恰好为live_cc
+        // A packet with only an adaptation field does not increase the continuity counter, so the next live ts packet is exactly live_cc
+        ptr[3] = 0x20 | ((live_cc - 1) & 0x0F);
+        ptr[4] = TsPacketizer::kPacketSize - 5;
+        // discontinuity_indicator
+        ptr[5] = 0x80;
+        memset(ptr + 6, 0xFF, TsPacketizer::kPacketSize - 6);
+        out.setSize(out.size() + TsPacketizer::kPacketSize);
+    }
+};
+
 class TSMediaSourceMuxer final : public MpegMuxer, public MediaSourceEventInterceptor,
                                  public std::enable_shared_from_this<TSMediaSourceMuxer> {
 public:
@@ -43,6 +154,17 @@ public:
         return _media_src->readerCount();
     }
 
+    /**
+     * 开启统一gop缓存，环形缓冲不再缓存gop，新播放器的gop从帧缓存按需打包
+     * Enable unified gop cache, the ring buffer no longer caches the gop, the gop of new players is packetized on demand from the frame cache
+     */
+    void setGopCache(const FrameGopCache::Ptr &cache) {
+        auto packetizer = GopPacketizer<TSPacket>::create(cache, [](GopPacketizer<TSPacket>::onPacket cb) -> MediaSinkInterface::Ptr {
+            return std::make_shared<TSGopMuxer>(std::move(cb));
+        });
+        _media_src->setGopMaker([packetizer](uint64_t stamp) { return packetizer->makeGop(stamp); }, &TSGopJoiner::join);
+    }
+
     void onReaderChanged(MediaSource &sender, int size) override {
         _enabled = _option.ts_demand ? size : true;
         if (!size && _option.ts_demand) {
@@ -52,22 +174,37 @@ public:
     }
 
     bool inputFrame(const Frame::Ptr &frame) override {
-        if (_clear_cache && _option.ts_demand) {
-            _clear_cache = false;
-            _media_src->clearCache();
-        }
-        if (_enabled || !_option.ts_demand) {
+        if (checkEnabled()) {
             return MpegMuxer::inputFrame(frame);
         }
         return false;
     }
 
+    /**
+     * 输入共享ts封装(SharedMpegMuxer)产生的ts数据
+     * Input ts data generated by the shared ts muxer (SharedMpegMuxer)
+     */
+    void inputMpegData(const std::shared_ptr<toolkit::Buffer> &buffer, uint64_t timestamp, bool key_pos) {
+        if (checkEnabled()) {
+            onWrite(buffer, timestamp, key_pos);
+        }
+    }
+
     bool isEnabled() {
         // 缓存尚未清空时，还允许触发inputFrame函数，以便及时清空缓存  [AUTO-TRANSLATED:7cfd4d49]
         // Allow the inputFrame function to be triggered even when the cache is not yet cleared, so that the cache can be cleared in time.
         return _option.ts_demand ? (_clear_cache ? true : _enabled) : true;
     }
 
+private:
+    bool checkEnabled() {
+        if (_clear_cache && _option.ts_demand) {
+            _clear_cache = false;
+            _media_src->clearCache();
+        }
+        return _enabled || !_option.ts_demand;
+    }
+
 protected:
     void onWrite(std::shared_ptr<toolkit::Buffer> buffer, uint64_t timestamp, bool key_pos) override {
         if (!buffer) {
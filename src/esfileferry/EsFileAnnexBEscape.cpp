@@ -0,0 +1,187 @@
+﻿#include "EsFileAnnexBEscape.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ESFILE_ANNEXB_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ESFILE_ANNEXB_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define ESFILE_ANNEXB_NEON 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+#if defined(ESFILE_ANNEXB_AVX2)
+constexpr size_t kBlockBytes = 32;
+#elif defined(ESFILE_ANNEXB_SSE2) || defined(ESFILE_ANNEXB_NEON)
+constexpr size_t kBlockBytes = 16;
+#else
+constexpr size_t kBlockBytes = 8;
+#endif
+
+// 00 00 之后至多再有一个待判定字节，越过该位置且末尾非 0x00 即可回到整块处理
+constexpr size_t kScalarTailBytes = 3;
+
+inline size_t countTrailingZeroBits(uint64_t value) {
+#if defined(_MSC_VER)
+  unsigned long index = 0;
+  if (_BitScanForward(&index, static_cast<unsigned long>(value & 0xFFFFFFFFu))) {
+    return static_cast<size_t>(index);
+  }
+  _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+  return static_cast<size_t>(index) + 32;
+#else
+  return static_cast<size_t>(__builtin_ctzll(value));
+#endif
+}
+
+// 返回 [0, ret) 内不存在以该区间内位置开头的 00 00 的最大整块长度；
+// 找到 00 00 时返回其起始位置（字长回退实现返回所在块的起始位置）。
+// 判定位置 i 需要读取 p[i + 1]，因此只处理 off + kBlockBytes + 1 <= size 的整块。
+size_t findZeroPair(const uint8_t *p, size_t size) {
+  size_t off = 0;
+  while (off + kBlockBytes + 1 <= size) {
+#if defined(ESFILE_ANNEXB_AVX2)
+    const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + off));
+    const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + off + 1));
+    const auto eq = _mm256_cmpeq_epi8(_mm256_or_si256(a, b), _mm256_setzero_si256());
+    const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+    if (mask != 0) {
+      return off + countTrailingZeroBits(mask);
+    }
+#elif defined(ESFILE_ANNEXB_SSE2)
+    const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + off));
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + off + 1));
+    const auto eq = _mm_cmpeq_epi8(_mm_or_si128(a, b), _mm_setzero_si128());
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+    if (mask != 0) {
+      return off + countTrailingZeroBits(mask);
+    }
+#elif defined(ESFILE_ANNEXB_NEON)
+    const auto eq = vceqq_u8(vorrq_u8(vld1q_u8(p + off), vld1q_u8(p + off + 1)),
+                             vdupq_n_u8(0));
+    // 每字节收窄为 4 bit 的掩码
+    const auto mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    if (mask != 0) {
+      return off + countTrailingZeroBits(mask) / 4;
+    }
+#else
+    uint64_t a = 0;
+    uint64_t b = 0;
+    std::memcpy(&a, p + off, sizeof(a));
+    std::memcpy(&b, p + off + 1, sizeof(b));
+    const auto v = a | b;
+    if (((v - 0x0101010101010101ULL) & ~v & 0x8080808080808080ULL) != 0) {
+      return off;
+    }
+#endif
+    off += kBlockBytes;
+  }
+  return off;
+}
+
+inline void afterBulk(const uint8_t *data, size_t end, size_t bulk,
+                      int &zero_count) {
+  // 整块内不含 00 00，末尾至多一个 0x00
+  if (bulk > 0) {
+    zero_count = data[end - 1] == 0x00 ? 1 : 0;
+  }
+}
+
+} // namespace
+
+size_t ScanEsFileAnnexBEscape(const uint8_t *data, size_t size,
+                              EsFileAnnexBEscapeState &state) {
+  size_t inserted = 0;
+  size_t i = 0;
+  while (i < size) {
+    if (state.zero_count == 0) {
+      const auto bulk = findZeroPair(data + i, size - i);
+      i += bulk;
+      afterBulk(data, i, bulk, state.zero_count);
+    }
+    const auto scalar_end = std::min(size, i + kScalarTailBytes);
+    while (i < size && (i < scalar_end || state.zero_count != 0)) {
+      const auto byte = data[i++];
+      if (state.zero_count >= 2 && byte <= 0x03) {
+        ++inserted;
+        state.zero_count = 0;
+      }
+      state.zero_count = byte == 0x00 ? state.zero_count + 1 : 0;
+    }
+  }
+  return inserted;
+}
+
+uint8_t *EscapeEsFileAnnexB(const uint8_t *data, size_t size, uint8_t *out,
+                            EsFileAnnexBEscapeState &state) {
+  size_t i = 0;
+  while (i < size) {
+    if (state.zero_count == 0) {
+      const auto bulk = findZeroPair(data + i, size - i);
+      if (bulk > 0) {
+        std::memcpy(out, data + i, bulk);
+        out += bulk;
+      }
+      i += bulk;
+      afterBulk(data, i, bulk, state.zero_count);
+    }
+    const auto scalar_end = std::min(size, i + kScalarTailBytes);
+    while (i < size && (i < scalar_end || state.zero_count != 0)) {
+      const auto byte = data[i++];
+      if (state.zero_count >= 2 && byte <= 0x03) {
+        *out++ = 0x03;
+        state.zero_count = 0;
+      }
+      *out++ = byte;
+      state.zero_count = byte == 0x00 ? state.zero_count + 1 : 0;
+    }
+  }
+  return out;
+}
+
+bool UnescapeEsFileAnnexB(const uint8_t *data, size_t size, uint8_t *out,
+                          size_t out_size, size_t &consumed) {
+  int zero_count = 0;
+  size_t i = 0;
+  size_t written = 0;
+  while (written < out_size) {
+    if (i >= size) {
+      return false;
+    }
+    if (zero_count == 0) {
+      // 整块原样拷贝，长度不能超过剩余待还原字节数
+      const auto limit = std::min(size - i, out_size - written);
+      const auto bulk = findZeroPair(data + i, limit);
+      if (bulk > 0) {
+        std::memcpy(out + written, data + i, bulk);
+        written += bulk;
+      }
+      i += bulk;
+      afterBulk(data, i, bulk, zero_count);
+    }
+    const auto scalar_end = std::min(size, i + kScalarTailBytes);
+    while (i < size && written < out_size &&
+           (i < scalar_end || zero_count != 0)) {
+      const auto byte = data[i++];
+      if (zero_count >= 2 && byte == 0x03) {
+        zero_count = 0;
+        continue;
+      }
+      out[written++] = byte;
+      zero_count = byte == 0x00 ? zero_count + 1 : 0;
+    }
+  }
+  consumed = i;
+  return true;
+}
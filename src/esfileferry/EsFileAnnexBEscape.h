@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Annex-B 防竞争转义：连续两个 0x00 后出现 0x00~0x03 时插入 0x03。
+// 不含 00 00 的数据段按 SIMD 宽度整块跳过/拷贝（AVX2/SSE2/NEON，其余平台按 8 字节字长），
+// 仅在 00 00 附近逐字节处理。
+
+// 转义状态，可跨多段输入延续
+struct EsFileAnnexBEscapeState {
+    // 已输出数据末尾连续 0x00 的个数
+    int zero_count = 0;
+};
+
+// 统计转义需要插入的 0x03 个数（只读），state 同步推进
+size_t ScanEsFileAnnexBEscape(const uint8_t *data, size_t size,
+                              EsFileAnnexBEscapeState &state);
+// 转义写入 out，调用方需按 ScanEsFileAnnexBEscape 的结果预留空间，返回写入后的位置
+uint8_t *EscapeEsFileAnnexB(const uint8_t *data, size_t size, uint8_t *out,
+                            EsFileAnnexBEscapeState &state);
+// 反转义，直到还原出 out_size 字节；consumed 返回消耗的转义后字节数。
+// 输入不足以还原 out_size 字节时返回 false。
+bool UnescapeEsFileAnnexB(const uint8_t *data, size_t size, uint8_t *out,
+                          size_t out_size, size_t &consumed);
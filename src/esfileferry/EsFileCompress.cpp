@@ -0,0 +1,176 @@
+﻿#include "EsFileCompress.h"
+#include "EsFilePayloadProtocol.h"
+
+#include <algorithm>
+
+#if defined(ENABLE_LZ4)
+#include <lz4.h>
+#endif
+#if defined(ENABLE_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace {
+
+constexpr size_t kRawSizePrefixBytes = 4;
+
+void writeRawSizePrefix(uint8_t *out, uint32_t value) {
+  for (int i = 3; i >= 0; --i) {
+    *out++ = static_cast<uint8_t>(value >> (i * 8));
+  }
+}
+
+#if defined(ENABLE_ZSTD)
+// 分片较小且连续到来，取最快档位
+constexpr int kZstdLevel = 1;
+#endif
+
+} // namespace
+
+bool IsEsFileCompressCodecAvailable(EsFileCompressCodec codec) {
+  switch (codec) {
+  case EsFileCompressCodec::None:
+    return true;
+  case EsFileCompressCodec::Lz4:
+#if defined(ENABLE_LZ4)
+    return true;
+#else
+    return false;
+#endif
+  case EsFileCompressCodec::Zstd:
+#if defined(ENABLE_ZSTD)
+    return true;
+#else
+    return false;
+#endif
+  }
+  return false;
+}
+
+uint16_t EsFileCompressCodecFlag(EsFileCompressCodec codec) {
+  switch (codec) {
+  case EsFileCompressCodec::Lz4:
+    return kEsFileFlagPayloadLz4;
+  case EsFileCompressCodec::Zstd:
+    return kEsFileFlagPayloadZstd;
+  case EsFileCompressCodec::None:
+  default:
+    return 0;
+  }
+}
+
+EsFileCompressCodec EsFileCompressCodecFromFlags(uint16_t flags) {
+  if ((flags & kEsFileFlagPayloadZstd) != 0) {
+    return EsFileCompressCodec::Zstd;
+  }
+  if ((flags & kEsFileFlagPayloadLz4) != 0) {
+    return EsFileCompressCodec::Lz4;
+  }
+  return EsFileCompressCodec::None;
+}
+
+const char *EsFileCompressCodecName(EsFileCompressCodec codec) {
+  switch (codec) {
+  case EsFileCompressCodec::Lz4:
+    return "lz4";
+  case EsFileCompressCodec::Zstd:
+    return "zstd";
+  case EsFileCompressCodec::None:
+  default:
+    return "none";
+  }
+}
+
+EsFileCompressor::~EsFileCompressor() {
+#if defined(ENABLE_ZSTD)
+  ZSTD_freeCCtx(static_cast<ZSTD_CCtx *>(_zstd_cctx));
+#endif
+}
+
+bool EsFileCompressor::compress(EsFileCompressCodec codec, const uint8_t *data, size_t size,
+                                size_t max_out_size, std::vector<uint8_t> &out) {
+  if (size == 0 || size > 0xFFFFFFFFu || max_out_size <= kRawSizePrefixBytes) {
+    return false;
+  }
+  size_t compressed = 0;
+  switch (codec) {
+#if defined(ENABLE_LZ4)
+  case EsFileCompressCodec::Lz4: {
+    if (size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+      return false;
+    }
+    out.resize(max_out_size);
+    // 目标容量不足时 LZ4 提前放弃并返回 0
+    const auto ret = LZ4_compress_default(
+        reinterpret_cast<const char *>(data),
+        reinterpret_cast<char *>(out.data() + kRawSizePrefixBytes),
+        static_cast<int>(size),
+        static_cast<int>(std::min<size_t>(max_out_size - kRawSizePrefixBytes, 0x7FFFFFFF)));
+    if (ret <= 0) {
+      return false;
+    }
+    compressed = static_cast<size_t>(ret);
+    break;
+  }
+#endif
+#if defined(ENABLE_ZSTD)
+  case EsFileCompressCodec::Zstd: {
+    if (!_zstd_cctx) {
+      _zstd_cctx = ZSTD_createCCtx();
+      if (!_zstd_cctx) {
+        return false;
+      }
+    }
+    out.resize(max_out_size);
+    const auto ret = ZSTD_compressCCtx(static_cast<ZSTD_CCtx *>(_zstd_cctx),
+                                       out.data() + kRawSizePrefixBytes,
+                                       max_out_size - kRawSizePrefixBytes, data, size,
+                                       kZstdLevel);
+    if (ZSTD_isError(ret)) {
+      return false;
+    }
+    compressed = ret;
+    break;
+  }
+#endif
+  default:
+    return false;
+  }
+  writeRawSizePrefix(out.data(), static_cast<uint32_t>(size));
+  out.resize(kRawSizePrefixBytes + compressed);
+  return true;
+}
+
+bool DecompressEsFilePayload(EsFileCompressCodec codec, const uint8_t *data, size_t size,
+                             size_t max_size, std::vector<uint8_t> &out) {
+  if (!data || size < kRawSizePrefixBytes) {
+    return false;
+  }
+  const size_t raw_size = ReadEsFileU32BE(data);
+  if (raw_size == 0 || raw_size > max_size) {
+    return false;
+  }
+  switch (codec) {
+#if defined(ENABLE_LZ4)
+  case EsFileCompressCodec::Lz4: {
+    out.resize(raw_size);
+    const auto ret = LZ4_decompress_safe(
+        reinterpret_cast<const char *>(data + kRawSizePrefixBytes),
+        reinterpret_cast<char *>(out.data()),
+        static_cast<int>(size - kRawSizePrefixBytes), static_cast<int>(raw_size));
+    return ret >= 0 && static_cast<size_t>(ret) == raw_size;
+  }
+#endif
+#if defined(ENABLE_ZSTD)
+  case EsFileCompressCodec::Zstd: {
+    // 解压可能发生在任意接收线程，不持有线程级上下文
+    out.resize(raw_size);
+    const auto ret = ZSTD_decompress(out.data(), raw_size, data + kRawSizePrefixBytes,
+                                     size - kRawSizePrefixBytes);
+    return !ZSTD_isError(ret) && ret == raw_size;
+  }
+#endif
+  default:
+    return false;
+  }
+}
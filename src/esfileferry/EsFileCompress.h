@@ -0,0 +1,44 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// FileChunk 负载压缩。LZ4/Zstd 分别在定义 ENABLE_LZ4/ENABLE_ZSTD 时编译进来，
+// 未编译的算法既不能用于发送，也无法解压对端发来的包。
+// 压缩负载布局：u32 原始长度（大端）+ 压缩数据；算法由 kEsFileFlagPayloadLz4/kEsFileFlagPayloadZstd 标记。
+
+enum class EsFileCompressCodec : uint8_t {
+    None = 0,
+    Lz4 = 1,
+    Zstd = 2,
+};
+
+// 当前编译是否支持该算法，None 恒为 true
+bool IsEsFileCompressCodecAvailable(EsFileCompressCodec codec);
+// 算法对应的协议标记位，None 为 0
+uint16_t EsFileCompressCodecFlag(EsFileCompressCodec codec);
+// 从协议标记位取算法，未压缩返回 None
+EsFileCompressCodec EsFileCompressCodecFromFlags(uint16_t flags);
+const char *EsFileCompressCodecName(EsFileCompressCodec codec);
+
+// 负载压缩器，Zstd 压缩状态在多次调用间复用；非线程安全，由单个发送线程持有
+class EsFileCompressor {
+public:
+    EsFileCompressor() = default;
+    ~EsFileCompressor();
+    EsFileCompressor(const EsFileCompressor &) = delete;
+    EsFileCompressor &operator=(const EsFileCompressor &) = delete;
+
+    // 压缩 data 写入 out（含长度前缀）；结果超过 max_out_size 或算法不可用时返回 false，
+    // 调用方据此按原始负载发送
+    bool compress(EsFileCompressCodec codec, const uint8_t *data, size_t size,
+                  size_t max_out_size, std::vector<uint8_t> &out);
+
+private:
+    void *_zstd_cctx = nullptr;
+};
+
+// 解压 data 写入 out；原始长度超过 max_size、数据损坏或算法不可用时返回 false
+bool DecompressEsFilePayload(EsFileCompressCodec codec, const uint8_t *data, size_t size,
+                             size_t max_size, std::vector<uint8_t> &out);
@@ -0,0 +1,148 @@
+﻿#include "EsFileCrc32c.h"
+
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <nmmintrin.h>
+#define ESFILE_CRC32C_X86 1
+#define ESFILE_CRC32C_TARGET __attribute__((target("sse4.2")))
+#elif defined(_M_X64)
+#include <intrin.h>
+#include <nmmintrin.h>
+#define ESFILE_CRC32C_X86 1
+#define ESFILE_CRC32C_TARGET
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define ESFILE_CRC32C_ARM 1
+#endif
+
+namespace {
+
+// 0x1EDC6F41 的反射形式
+constexpr uint32_t kCrc32cPolyReflected = 0x82F63B78;
+
+// slicing-by-8 查表
+struct Crc32cTable {
+  uint32_t table[8][256];
+
+  Crc32cTable() {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ ((crc & 1) ? kCrc32cPolyReflected : 0);
+      }
+      table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+      for (int k = 1; k < 8; ++k) {
+        table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
+      }
+    }
+  }
+};
+
+uint32_t crc32cSoftware(uint32_t crc, const uint8_t *data, size_t size) {
+  static const Crc32cTable s_table;
+  const auto &t = s_table.table;
+  while (size > 0 && (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+    crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+    --size;
+  }
+  while (size >= 8) {
+    // 按小端字节序组合，与逐字节处理顺序一致
+    const uint32_t lo = crc ^ (static_cast<uint32_t>(data[0]) |
+                               static_cast<uint32_t>(data[1]) << 8 |
+                               static_cast<uint32_t>(data[2]) << 16 |
+                               static_cast<uint32_t>(data[3]) << 24);
+    const uint32_t hi = static_cast<uint32_t>(data[4]) |
+                        static_cast<uint32_t>(data[5]) << 8 |
+                        static_cast<uint32_t>(data[6]) << 16 |
+                        static_cast<uint32_t>(data[7]) << 24;
+    crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^
+          t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+          t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^
+          t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+  }
+  return crc;
+}
+
+#if defined(ESFILE_CRC32C_X86)
+bool hasSse42() {
+#if defined(_MSC_VER)
+  int info[4] = {0};
+  __cpuid(info, 1);
+  return (info[2] & (1 << 20)) != 0;
+#else
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  return (ecx & bit_SSE4_2) != 0;
+#endif
+}
+
+ESFILE_CRC32C_TARGET uint32_t crc32cHardware(uint32_t crc, const uint8_t *data,
+                                             size_t size) {
+#if defined(__x86_64__) || defined(_M_X64)
+  uint64_t crc64 = crc;
+  while (size >= 8) {
+    uint64_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    crc64 = _mm_crc32_u64(crc64, word);
+    data += 8;
+    size -= 8;
+  }
+  crc = static_cast<uint32_t>(crc64);
+#endif
+  while (size >= 4) {
+    uint32_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    crc = _mm_crc32_u32(crc, word);
+    data += 4;
+    size -= 4;
+  }
+  while (size-- > 0) {
+    crc = _mm_crc32_u8(crc, *data++);
+  }
+  return crc;
+}
+#elif defined(ESFILE_CRC32C_ARM)
+uint32_t crc32cHardware(uint32_t crc, const uint8_t *data, size_t size) {
+  while (size >= 8) {
+    uint64_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    crc = __crc32cd(crc, word);
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    crc = __crc32cb(crc, *data++);
+  }
+  return crc;
+}
+#endif
+
+} // namespace
+
+uint32_t UpdateEsFileCrc32c(uint32_t crc, const uint8_t *data, size_t size) {
+  crc = ~crc;
+#if defined(ESFILE_CRC32C_X86)
+  static const bool s_hardware = hasSse42();
+  crc = s_hardware ? crc32cHardware(crc, data, size)
+                   : crc32cSoftware(crc, data, size);
+#elif defined(ESFILE_CRC32C_ARM)
+  crc = crc32cHardware(crc, data, size);
+#else
+  crc = crc32cSoftware(crc, data, size);
+#endif
+  return ~crc;
+}
@@ -0,0 +1,10 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// CRC32C（Castagnoli，多项式 0x1EDC6F41），与 iSCSI/ext4 等使用的算法一致。
+// x86 运行时检测 SSE4.2，ARMv8 在编译目标开启 CRC 扩展时使用 CRC 指令，其余走查表实现。
+
+// 累加计算 CRC32C，crc 传入上一段的结果，首段传 0；可分段调用，结果与整段计算一致
+uint32_t UpdateEsFileCrc32c(uint32_t crc, const uint8_t *data, size_t size);
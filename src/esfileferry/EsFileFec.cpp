@@ -0,0 +1,89 @@
+﻿#include "EsFileFec.h"
+#include "EsFilePayloadProtocol.h"
+
+#include <cstring>
+
+namespace {
+constexpr size_t kFecMemberEntrySize = sizeof(uint64_t) + sizeof(uint32_t);
+
+uint8_t *writeU16(uint8_t *out, uint16_t value) {
+  out[0] = static_cast<uint8_t>(value >> 8);
+  out[1] = static_cast<uint8_t>(value);
+  return out + 2;
+}
+
+uint8_t *writeU32(uint8_t *out, uint32_t value) {
+  for (int i = 3; i >= 0; --i) {
+    *out++ = static_cast<uint8_t>(value >> (i * 8));
+  }
+  return out;
+}
+
+uint8_t *writeU64(uint8_t *out, uint64_t value) {
+  for (int i = 7; i >= 0; --i) {
+    *out++ = static_cast<uint8_t>(value >> (i * 8));
+  }
+  return out;
+}
+} // namespace
+
+void XorEsFileFecBytes(uint8_t *dst, const uint8_t *src, size_t size) {
+  // 按 8 字节字长处理，编译器可进一步向量化
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t a;
+    uint64_t b;
+    std::memcpy(&a, dst + i, sizeof(a));
+    std::memcpy(&b, src + i, sizeof(b));
+    a ^= b;
+    std::memcpy(dst + i, &a, sizeof(a));
+  }
+  for (; i < size; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+size_t EsFileFecTableSize(size_t member_count) {
+  return sizeof(uint16_t) + member_count * kFecMemberEntrySize;
+}
+
+uint8_t *WriteEsFileFecTable(uint8_t *out,
+                             const std::vector<EsFileFecMember> &members) {
+  out = writeU16(out, static_cast<uint16_t>(members.size()));
+  for (const auto &member : members) {
+    out = writeU64(out, member.offset);
+    out = writeU32(out, member.size);
+  }
+  return out;
+}
+
+bool ParseEsFileFecParity(const uint8_t *data, size_t size,
+                          std::vector<EsFileFecMember> &members,
+                          const uint8_t *&parity, size_t &parity_size) {
+  members.clear();
+  parity = nullptr;
+  parity_size = 0;
+  if (!data || size < sizeof(uint16_t)) {
+    return false;
+  }
+  const auto count = ReadEsFileU16BE(data);
+  const auto table_size = EsFileFecTableSize(count);
+  if (count == 0 || size < table_size) {
+    return false;
+  }
+  members.resize(count);
+  const uint8_t *p = data + sizeof(uint16_t);
+  uint32_t max_size = 0;
+  for (auto &member : members) {
+    member.offset = ReadEsFileU64BE(p);
+    member.size = ReadEsFileU32BE(p + sizeof(uint64_t));
+    p += kFecMemberEntrySize;
+    max_size = member.size > max_size ? member.size : max_size;
+  }
+  if (size - table_size != max_size) {
+    return false;
+  }
+  parity = data + table_size;
+  parity_size = max_size;
+  return true;
+}
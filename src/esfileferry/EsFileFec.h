@@ -0,0 +1,26 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// FileChunk 异或校验（单校验 FEC）：每组 N 个 FileChunk 后追加一个 FileParity 包，
+// 组内任意丢失一个 FileChunk 时可由其余成员与校验包还原。
+// FileParity 负载：u16 成员数 + 成员数 × (u64 data_offset, u32 payload_len) + 异或块，
+// 异或块长度为组内最长成员长度，较短成员按 0 补齐参与异或。整数均为大端。
+
+struct EsFileFecMember {
+    uint64_t offset = 0;
+    uint32_t size = 0;
+};
+
+// dst[i] ^= src[i]
+void XorEsFileFecBytes(uint8_t *dst, const uint8_t *src, size_t size);
+// 成员表字节数
+size_t EsFileFecTableSize(size_t member_count);
+// 写入成员表，返回写入后的位置
+uint8_t *WriteEsFileFecTable(uint8_t *out, const std::vector<EsFileFecMember> &members);
+// 解析 FileParity 负载，parity/parity_size 指向异或块
+bool ParseEsFileFecParity(const uint8_t *data, size_t size,
+                          std::vector<EsFileFecMember> &members,
+                          const uint8_t *&parity, size_t &parity_size);
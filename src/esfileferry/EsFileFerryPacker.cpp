@@ -1,4 +1,7 @@
 ﻿#include "EsFileFerryPacker.h"
+#include "EsFileAnnexBEscape.h"
+#include "EsFileCrc32c.h"
+#include "EsFileRangeSet.h"
 #include "Util/logger.h"
 #include "Util/base64.h"
 #include <algorithm>
@@ -18,6 +21,8 @@ constexpr uint32_t EsFileFerryPacker::kDefaultBootstrapIntervalMs;
 constexpr uint32_t EsFileFerryPacker::kDefaultPaceIntervalMs;
 constexpr uint64_t EsFileFerryPacker::kDefaultSchedulerRoundBudgetBytes;
 constexpr uint64_t EsFileFerryPacker::kDefaultUnifiedBufferedBytes;
+constexpr size_t EsFileFerryPacker::kDefaultPacketPoolSize;
+constexpr size_t EsFileFerryPacker::kMaxFecGroupSize;
 
 EsFileFerryPacker &EsFileFerryPacker::Instance() {
   static std::shared_ptr<EsFileFerryPacker> instance(new EsFileFerryPacker());
@@ -30,6 +35,7 @@ EsFileFerryPacker::EsFileFerryPacker()
   std::lock_guard<std::mutex> lock(_mtx);
   _global_options = EsFileGlobalOptions{};
   _http_chunk_pool.setSize(kDefaultMaxHttpBufferBlocksPerTask * 8);
+  _packet_pool.setSize(kDefaultPacketPoolSize);
   startPacketThreadLocked();
   startBootstrapTimerLocked();
   startPaceTimerLocked();
@@ -37,45 +43,29 @@ EsFileFerryPacker::EsFileFerryPacker()
 
 EsFileFerryPacker::~EsFileFerryPacker() {
   std::thread join_thread;
-  std::vector<std::thread> http_join_threads;
-  std::vector<std::shared_ptr<std::condition_variable>> buffer_cvs;
   {
     std::lock_guard<std::mutex> lock(_mtx);
     stopPaceTimerLocked();
     stopBootstrapTimerLocked();
     stopPacketThreadLocked(join_thread);
-    buffer_cvs.reserve(_task_registry.tasks.size());
-    for (const auto &item : _task_registry.tasks) {
-      if (item.second.http.buffer.cv) {
-        buffer_cvs.emplace_back(item.second.http.buffer.cv);
-      }
-    }
-    http_join_threads.reserve(_http_fetch_threads.size());
-    for (auto &thread_state : _http_fetch_threads) {
-      if (thread_state && thread_state->thread.joinable()) {
-        http_join_threads.emplace_back(std::move(thread_state->thread));
-      }
-    }
-    _http_fetch_threads.clear();
-  }
-  for (const auto &buffer_cv : buffer_cvs) {
-    buffer_cv->notify_all();
   }
   if (join_thread.joinable()) {
     join_thread.join();
   }
-  for (auto &thread : http_join_threads) {
-    if (thread.joinable()) {
-      thread.join();
-    }
-  }
+  // 未完成的拉取在引擎线程内以失败结束，需在成员析构前完成
+  _http_fetch_engine.shutdown();
 }
 
 namespace {
 constexpr int64_t kHttpBufferWaitSlowLogMs = 1000;
 constexpr int64_t kEmitPacketSlowLogMs = 1000;
-constexpr int64_t kRateLimitWaitStepMs = 20;
 constexpr bool kEnableAnnexBPayloadEscape = true;
+// 小于该长度的分片压缩收益有限，直接按原样发送
+constexpr size_t kMinCompressPayloadBytes = 512;
+// 压缩无收益后的退避分片数，随连续失败翻倍直至上限
+constexpr uint32_t kCompressBackoffChunks = 4;
+constexpr uint32_t kMaxCompressBackoffChunks = 256;
+constexpr uint32_t kMaxCompressMissStreak = 6;
 constexpr uint64_t kBitsPerByte = 8;
 constexpr uint64_t kBitsPerMegabit = 1024 * 1024;
 
@@ -110,132 +100,45 @@ std::string toLowerCopy(std::string value) {
   return value;
 }
 
-void writeU32BEAt(std::vector<uint8_t> &out, size_t offset, uint32_t value) {
-  out[offset + 0] = static_cast<uint8_t>((value >> 24) & 0xFF);
-  out[offset + 1] = static_cast<uint8_t>((value >> 16) & 0xFF);
-  out[offset + 2] = static_cast<uint8_t>((value >> 8) & 0xFF);
-  out[offset + 3] = static_cast<uint8_t>(value & 0xFF);
-}
-
-void writeU16BEAt(std::vector<uint8_t> &out, size_t offset, uint16_t value) {
-  out[offset + 0] = static_cast<uint8_t>((value >> 8) & 0xFF);
-  out[offset + 1] = static_cast<uint8_t>(value & 0xFF);
-}
-
 bool equalsIgnoreCase(std::string lhs, std::string rhs) {
   lhs = toLowerCopy(std::move(lhs));
   rhs = toLowerCopy(std::move(rhs));
   return lhs == rhs;
 }
 
-bool needsAnnexBEscape(const uint8_t *data, size_t size) {
-  if (!data || size < 3) {
-    return false;
-  }
-  for (size_t i = 2; i < size; ++i) {
-    if (data[i - 2] == 0x00 && data[i - 1] == 0x00 && data[i] <= 0x03) {
-      return true;
-    }
-  }
-  return false;
-}
+// 连续内存负载
+struct ContiguousPayload {
+  const uint8_t *data;
+  size_t size;
 
-void escapeAnnexBPayload(const uint8_t *data, size_t size,
-                         std::vector<uint8_t> &out) {
-  out.clear();
-  out.reserve(size + size / 16 + 8);
-  int zero_count = 0;
-  for (size_t i = 0; i < size; ++i) {
-    const auto byte = data[i];
-    if (zero_count >= 2 && byte <= 0x03) {
-      out.push_back(0x03);
-      zero_count = 0;
-    }
-    out.push_back(byte);
-    if (byte == 0x00) {
-      ++zero_count;
-    } else {
-      zero_count = 0;
+  template <typename Fn>
+  void operator()(Fn &&fn) const {
+    if (size > 0) {
+      fn(data, size);
     }
   }
-}
+};
 
-bool maybeEscapeCarrierPacket(std::vector<uint8_t> &packet) {
-  size_t prefix_size = 0;
-  if (!DetectEsFileCarrierPrefixSize(packet.data(), packet.size(), prefix_size) ||
-      packet.size() < prefix_size + kEsFileFixedHeaderSize) {
-    return false;
-  }
-  EsFilePacketHeader header;
-  if (!DecodeEsFilePacketHeader(packet.data() + prefix_size,
-                                packet.size() - prefix_size, header)) {
-    return false;
-  }
-  const size_t payload_offset = prefix_size + kEsFileFixedHeaderSize +
-                                header.task_id_len + header.file_name_len;
-  if (packet.size() < payload_offset + header.payload_len) {
-    return false;
-  }
-  auto *payload = packet.data() + payload_offset;
-  const auto payload_len = static_cast<size_t>(header.payload_len);
-  if (payload_len == 0 || !needsAnnexBEscape(payload, payload_len)) {
-    return false;
-  }
+// 锁内取出的分段负载，持有各段所在缓冲的引用，组包可在锁外进行
+struct SharedSegmentsPayload {
+  std::vector<std::shared_ptr<const void>> owners;
+  std::vector<std::pair<const uint8_t *, size_t>> segments;
 
-  std::vector<uint8_t> escaped_payload;
-  escapeAnnexBPayload(payload, payload_len, escaped_payload);
-  if (escaped_payload.size() == payload_len) {
-    return false;
+  void append(std::shared_ptr<const void> owner, const uint8_t *data, size_t size) {
+    if (size == 0) {
+      return;
+    }
+    owners.emplace_back(std::move(owner));
+    segments.emplace_back(data, size);
   }
-  std::vector<uint8_t> escaped_packet;
-  escaped_packet.reserve(payload_offset + escaped_payload.size());
-  escaped_packet.insert(escaped_packet.end(), packet.begin(),
-                        packet.begin() + static_cast<std::ptrdiff_t>(payload_offset));
-  escaped_packet.insert(escaped_packet.end(), escaped_payload.begin(),
-                        escaped_payload.end());
-  packet.swap(escaped_packet);
-  return true;
-}
 
-bool encodeFileInfoPayloadBase64(std::vector<uint8_t> &packet) {
-  size_t prefix_size = 0;
-  if (!DetectEsFileCarrierPrefixSize(packet.data(), packet.size(), prefix_size) ||
-      packet.size() < prefix_size + kEsFileFixedHeaderSize) {
-    return false;
-  }
-  EsFilePacketHeader header;
-  if (!DecodeEsFilePacketHeader(packet.data() + prefix_size,
-                                packet.size() - prefix_size, header) ||
-      header.type != EsFilePacketType::FileInfo) {
-    return false;
-  }
-  const size_t payload_offset = prefix_size + kEsFileFixedHeaderSize +
-                                header.task_id_len + header.file_name_len;
-  if (packet.size() < payload_offset + header.payload_len) {
-    return false;
-  }
-  const auto payload_len = static_cast<size_t>(header.payload_len);
-  if (payload_len == 0) {
-    return false;
+  template <typename Fn>
+  void operator()(Fn &&fn) const {
+    for (const auto &segment : segments) {
+      fn(segment.first, segment.second);
+    }
   }
-  const auto encoded = encodeBase64(std::string(
-      reinterpret_cast<const char *>(packet.data() + payload_offset),
-      payload_len));
-  std::vector<uint8_t> encoded_payload(encoded.begin(), encoded.end());
-  std::vector<uint8_t> rebuilt;
-  rebuilt.reserve(payload_offset + encoded_payload.size());
-  rebuilt.insert(rebuilt.end(), packet.begin(),
-                 packet.begin() + static_cast<std::ptrdiff_t>(payload_offset));
-  rebuilt.insert(rebuilt.end(), encoded_payload.begin(), encoded_payload.end());
-  const auto new_payload_len = static_cast<uint32_t>(encoded_payload.size());
-  const auto new_total_len = static_cast<uint32_t>(
-      kEsFileFixedHeaderSize + header.task_id_len + header.file_name_len +
-      new_payload_len);
-  writeU32BEAt(rebuilt, prefix_size + 24, new_payload_len);
-  writeU32BEAt(rebuilt, prefix_size + 40, new_total_len);
-  packet.swap(rebuilt);
-  return true;
-}
+};
 
 bool headerValueContains(const EsFileFerryPacker::HttpHeaders &headers,
                          const std::string &name,
@@ -267,6 +170,32 @@ std::vector<uint8_t> buildHttpResponseMetaPayload(
   return std::vector<uint8_t>(text.begin(), text.end());
 }
 
+// 已做内容编码或 Content-Type 为媒体/归档类型时不值得再压缩，其余类型交给分片采样判断
+bool isHttpContentCompressible(const EsFileFerryPacker::HttpHeaders &headers) {
+  static const char *const kIncompressibleTypes[] = {
+      "zip", "compressed", "x-7z", "x-rar", "x-xz", "x-bzip", "zstd", "x-lz4"};
+  for (const auto &header : headers) {
+    if (equalsIgnoreCase(header.first, "content-encoding")) {
+      const auto value = toLowerCopy(header.second);
+      if (!value.empty() && value != "identity") {
+        return false;
+      }
+    } else if (equalsIgnoreCase(header.first, "content-type")) {
+      const auto value = toLowerCopy(header.second);
+      if (value.compare(0, 6, "video/") == 0 || value.compare(0, 6, "audio/") == 0 ||
+          (value.compare(0, 6, "image/") == 0 && value.find("svg") == std::string::npos)) {
+        return false;
+      }
+      for (const auto *type : kIncompressibleTypes) {
+        if (value.find(type) != std::string::npos) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
 bool tryParseContentLength(const EsFileFerryPacker::HttpHeaders &headers,
                            uint64_t &content_length) {
   for (const auto &header : headers) {
@@ -279,6 +208,36 @@ bool tryParseContentLength(const EsFileFerryPacker::HttpHeaders &headers,
   return false;
 }
 
+// 解析 206 响应的 Content-Range: bytes <first>-<last>/<total>，total 为 * 时 total_known 为 false
+bool tryParseContentRange(const EsFileFerryPacker::HttpHeaders &headers,
+                          uint64_t &first, uint64_t &total, bool &total_known) {
+  for (const auto &header : headers) {
+    if (!equalsIgnoreCase(header.first, "content-range")) {
+      continue;
+    }
+    const auto &value = header.second;
+    const auto unit_pos = toLowerCopy(value).find("bytes");
+    if (unit_pos == std::string::npos) {
+      return false;
+    }
+    const char *p = value.c_str() + unit_pos + 5;
+    while (*p == ' ') {
+      ++p;
+    }
+    char *end = nullptr;
+    first = std::strtoull(p, &end, 10);
+    if (end == p) {
+      return false;
+    }
+    const auto slash = value.find('/');
+    total_known = slash != std::string::npos && slash + 1 < value.size() &&
+                  value[slash + 1] != '*';
+    total = total_known ? std::strtoull(value.c_str() + slash + 1, nullptr, 10) : 0;
+    return true;
+  }
+  return false;
+}
+
 } // namespace
 
 // Config And Lifecycle
@@ -348,6 +307,11 @@ void EsFileFerryPacker::setGlobalOptions(const EsFileGlobalOptions &opts) {
             : opts.http_pull_per_task_buffer_limit_bytes;
     _global_options.http_pull_total_rate_mbps =
         opts.http_pull_total_rate_mbps;
+    _global_options.payload_crc32c = opts.payload_crc32c;
+    _global_options.fec_group_size =
+        std::min(opts.fec_group_size, kMaxFecGroupSize);
+    _global_options.payload_compression = opts.payload_compression;
+    _global_options.stripe_min_file_bytes = opts.stripe_min_file_bytes;
     recomputeAllTaskRateProfilesLocked(false);
     should_try_start_http = !_http_runtime.pending_fetches.empty();
   }
@@ -361,17 +325,72 @@ void EsFileFerryPacker::setPacketCallback(PacketCallback cb) {
   std::lock_guard<std::mutex> lock(_mtx);
   _packet_runtime.callback = std::move(cb);
   if (_packet_runtime.callback) {
-    _packet_runtime.ts_started = false;
-    _packet_runtime.last_ts_ms = 0;
-    _packet_runtime.bootstrap_due = true;
-    _packet_runtime.packet_sem.post();
-  } else {
-    _packet_runtime.bootstrap_due = false;
+    _packet_runtime.buffer_callback = nullptr;
+    _packet_runtime.stripe_callbacks.clear();
+    _packet_runtime.stripe_congested.clear();
+  }
+  onPacketCallbackChangedLocked();
+}
+
+void EsFileFerryPacker::setPacketBufferCallback(PacketBufferCallback cb) {
+  std::lock_guard<std::mutex> lock(_mtx);
+  _packet_runtime.buffer_callback = std::move(cb);
+  if (_packet_runtime.buffer_callback) {
+    _packet_runtime.callback = nullptr;
+    _packet_runtime.stripe_callbacks.clear();
+    _packet_runtime.stripe_congested.clear();
+  }
+  onPacketCallbackChangedLocked();
+}
+
+void EsFileFerryPacker::setStripePacketCallbacks(std::vector<PacketBufferCallback> cbs) {
+  bool should_try_start_http = false;
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (cbs.size() > kMaxStripeCount) {
+      cbs.resize(kMaxStripeCount);
+    }
+    // 任一路为空时整组视为无效，避免按下标路由到空回调
+    if (std::any_of(cbs.begin(), cbs.end(),
+                    [](const PacketBufferCallback &cb) { return !cb; })) {
+      cbs.clear();
+    }
+    _packet_runtime.stripe_callbacks = std::move(cbs);
+    _packet_runtime.stripe_congested.assign(_packet_runtime.stripe_callbacks.size(), false);
+    if (!_packet_runtime.stripe_callbacks.empty()) {
+      _packet_runtime.callback = nullptr;
+      _packet_runtime.buffer_callback = nullptr;
+    }
+    onPacketCallbackChangedLocked();
+    should_try_start_http = !isDataPlaneCongestedLocked() &&
+                            !_http_runtime.pending_fetches.empty();
+  }
+  _http_fetch_engine.wakeup();
+  if (should_try_start_http) {
+    maybeStartPendingHttpFetches();
+  }
+}
+
+void EsFileFerryPacker::setStripeCongested(size_t stripe, bool congested) {
+  bool should_try_start_http = false;
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto &states = _packet_runtime.stripe_congested;
+    if (stripe >= states.size() || states[stripe] == congested) {
+      return;
+    }
+    states[stripe] = congested;
+    should_try_start_http = !isDataPlaneCongestedLocked() &&
+                            !_http_runtime.pending_fetches.empty();
+  }
+  _http_fetch_engine.wakeup();
+  _packet_runtime.packet_sem.post();
+  if (should_try_start_http) {
+    maybeStartPendingHttpFetches();
   }
 }
 
 void EsFileFerryPacker::setDownstreamCongested(bool congested) {
-  std::vector<std::shared_ptr<std::condition_variable>> cvs;
   bool should_try_start_http = false;
   {
     std::lock_guard<std::mutex> lock(_mtx);
@@ -380,16 +399,8 @@ void EsFileFerryPacker::setDownstreamCongested(bool congested) {
     }
     _packet_runtime.downstream_congested = congested;
     should_try_start_http = !congested && !_http_runtime.pending_fetches.empty();
-    for (auto &item : _task_registry.tasks) {
-      auto &cv = item.second.http.buffer.cv;
-      if (cv) {
-        cvs.emplace_back(cv);
-      }
-    }
-  }
-  for (const auto &cv : cvs) {
-    cv->notify_all();
   }
+  _http_fetch_engine.wakeup();
   _packet_runtime.packet_sem.post();
   if (should_try_start_http) {
     maybeStartPendingHttpFetches();
@@ -417,6 +428,38 @@ bool EsFileFerryPacker::addTask(const std::string &task_id,
                                 const HttpHeaders &headers,
                                 const std::string &body,
                                 const std::string &file_name) {
+  return addTaskWithRanges(task_id, source, method, headers, body, file_name, {});
+}
+
+bool EsFileFerryPacker::addResumeTask(const std::string &task_id,
+                                      const std::string &source,
+                                      uint64_t start_offset,
+                                      const std::string &method,
+                                      const HttpHeaders &headers,
+                                      const std::string &body,
+                                      const std::string &file_name) {
+  return addTaskWithRanges(task_id, source, method, headers, body, file_name,
+                           {ByteRange(start_offset, 0)});
+}
+
+bool EsFileFerryPacker::addRangeTask(const std::string &task_id,
+                                     const std::string &source,
+                                     const std::vector<ByteRange> &ranges,
+                                     const std::string &method,
+                                     const HttpHeaders &headers,
+                                     const std::string &body,
+                                     const std::string &file_name) {
+  return addTaskWithRanges(task_id, source, method, headers, body, file_name,
+                           ranges);
+}
+
+bool EsFileFerryPacker::addTaskWithRanges(const std::string &task_id,
+                                          const std::string &source,
+                                          const std::string &method,
+                                          const HttpHeaders &headers,
+                                          const std::string &body,
+                                          const std::string &file_name,
+                                          const std::vector<ByteRange> &ranges) {
 
   if (task_id.empty()) {
     setLastError("task_id is empty");
@@ -426,8 +469,35 @@ bool EsFileFerryPacker::addTask(const std::string &task_id,
     setLastError("source is empty");
     return false;
   }
+  // 区间排序合并，end 为 0 的区间视为到文件末尾
+  std::vector<ByteRange> send_ranges;
+  if (!ranges.empty()) {
+    EsFileRangeSet range_set;
+    for (const auto &range : ranges) {
+      range_set.add(range.first, range.second == 0 ? UINT64_MAX : range.second);
+    }
+    send_ranges = range_set.ranges();
+    if (send_ranges.empty()) {
+      setLastError("ranges is empty");
+      return false;
+    }
+  }
   TaskState state;
   state.task_id = task_id;
+  auto apply_ranges = [&send_ranges](TaskState &task) {
+    if (send_ranges.empty()) {
+      return;
+    }
+    task.send.resume = true;
+    for (auto &range : send_ranges) {
+      if (range.second == UINT64_MAX) {
+        range.second = 0;
+      }
+    }
+    task.send.sent_bytes = send_ranges.front().first;
+    task.send.range_end = send_ranges.front().second;
+    task.send.pending_ranges.assign(send_ranges.begin() + 1, send_ranges.end());
+  };
   if (isHttpUrl(source)) {
     std::string method_upper = method;
     std::transform(
@@ -437,6 +507,11 @@ bool EsFileFerryPacker::addTask(const std::string &task_id,
       setLastError("method must be GET or POST");
       return false;
     }
+    // 续传/补发按区间多次请求源站，只允许幂等的 GET；POST 重放可能产生副作用，且各次响应未必一致
+    if (!send_ranges.empty() && method_upper != "GET") {
+      setLastError("resume/range task requires GET for http source");
+      return false;
+    }
     state.source.file_path = source;
     state.source.file_name =
         file_name.empty() ? inferHttpFileName(source, task_id) : file_name;
@@ -451,11 +526,13 @@ bool EsFileFerryPacker::addTask(const std::string &task_id,
     state.http.method = method_upper;
     state.http.request_headers = headers;
     state.http.request_body = body;
-    state.http.buffer.cv = std::make_shared<std::condition_variable>();
+    apply_ranges(state);
     uint64_t generation = 0;
     {
       std::lock_guard<std::mutex> lock(_mtx);
       refreshUnifiedTaskProfileLocked(state, true);
+      initTaskFecLocked(state);
+      initTaskCompressLocked(state);
       generation = ++_task_registry.generation;
       state.generation = generation;
       _task_registry.tasks[task_id] = std::move(state);
@@ -481,8 +558,20 @@ bool EsFileFerryPacker::addTask(const std::string &task_id,
     state.source.file_size = file_size;
     state.source.memory_mode = false;
     state.source.stream = std::move(stream);
+    // 超出文件末尾的区间丢弃；全部丢弃时任务只发送 FileInfo/FileEnd
+    send_ranges.erase(std::remove_if(send_ranges.begin(), send_ranges.end(),
+                                     [file_size](const ByteRange &range) {
+                                       return range.first >= file_size;
+                                     }),
+                      send_ranges.end());
+    if (!ranges.empty() && send_ranges.empty()) {
+      send_ranges.emplace_back(file_size, file_size);
+    }
+    apply_ranges(state);
     std::lock_guard<std::mutex> lock(_mtx);
     refreshUnifiedTaskProfileLocked(state, true);
+    initTaskFecLocked(state);
+    initTaskCompressLocked(state);
     state.generation = ++_task_registry.generation;
     _task_registry.tasks[task_id] = std::move(state);
     recomputeAllTaskRateProfilesLocked(false);
@@ -492,8 +581,25 @@ bool EsFileFerryPacker::addTask(const std::string &task_id,
 
 }
 
+bool EsFileFerryPacker::setTaskFecGroupSize(const std::string &task_id,
+                                            size_t group_size) {
+  std::lock_guard<std::mutex> lock(_mtx);
+  auto it = _task_registry.tasks.find(task_id);
+  if (it == _task_registry.tasks.end()) {
+    return false;
+  }
+  auto &task = it->second;
+  if (!task.fec) {
+    if (group_size == 0) {
+      return true;
+    }
+    task.fec = std::make_shared<TaskFecState>();
+  }
+  task.fec->group_size = std::min(group_size, kMaxFecGroupSize);
+  return true;
+}
+
 void EsFileFerryPacker::removeTask(const std::string &task_id) {
-  std::shared_ptr<std::condition_variable> buffer_cv;
   bool task_found = false;
   bool info_sent = false;
   bool end_sent = false;
@@ -506,7 +612,6 @@ void EsFileFerryPacker::removeTask(const std::string &task_id) {
     auto it = _task_registry.tasks.find(task_id);
     if (it != _task_registry.tasks.end()) {
       task_found = true;
-      buffer_cv = it->second.http.buffer.cv;
       info_sent = it->second.send.info_sent;
       end_sent = it->second.send.end_sent;
       http_pending = it->second.http.queued || it->second.http.active;
@@ -526,8 +631,9 @@ void EsFileFerryPacker::removeTask(const std::string &task_id) {
         << " http_pending:" << http_pending
         << " sent_bytes:" << sent_bytes
         << " file_size:" << file_size;
-  if (buffer_cv) {
-    buffer_cv->notify_all();
+  if (http_pending) {
+    // 让暂停中的拉取尽快发现任务已移除并中止
+    _http_fetch_engine.wakeup();
   }
   if (should_schedule_http) {
     maybeStartPendingHttpFetches();
@@ -536,18 +642,9 @@ void EsFileFerryPacker::removeTask(const std::string &task_id) {
 }
 
 void EsFileFerryPacker::clearTasks() {
-  std::vector<std::shared_ptr<std::condition_variable>> buffer_cvs;
-  std::vector<std::thread> http_join_threads;
   bool should_schedule_http = false;
   {
     std::lock_guard<std::mutex> lock(_mtx);
-    reapCompletedHttpFetchThreadsLocked(http_join_threads);
-    buffer_cvs.reserve(_task_registry.tasks.size());
-    for (const auto &it : _task_registry.tasks) {
-      if (it.second.http.buffer.cv) {
-        buffer_cvs.emplace_back(it.second.http.buffer.cv);
-      }
-    }
     _http_runtime.pending_fetches.clear();
     _http_runtime.total_buffered_bytes = 0;
     _task_registry.tasks.clear();
@@ -555,14 +652,7 @@ void EsFileFerryPacker::clearTasks() {
     recomputeAllTaskRateProfilesLocked(false);
     should_schedule_http = !_http_runtime.pending_fetches.empty();
   }
-  for (const auto &buffer_cv : buffer_cvs) {
-    buffer_cv->notify_all();
-  }
-  for (auto &thread : http_join_threads) {
-    if (thread.joinable()) {
-      thread.join();
-    }
-  }
+  _http_fetch_engine.wakeup();
   if (should_schedule_http) {
     maybeStartPendingHttpFetches();
   }
@@ -575,7 +665,7 @@ bool EsFileFerryPacker::onBootstrapTimer() {
   if (_packet_runtime.packet_thread_exit) {
     return false;
   }
-  if (_packet_runtime.callback) {
+  if (hasPacketCallbackLocked()) {
     _packet_runtime.bootstrap_due = true;
     _packet_runtime.packet_sem.post();
   }
@@ -587,7 +677,7 @@ bool EsFileFerryPacker::onPaceTimer() {
   if (_packet_runtime.packet_thread_exit) {
     return false;
   }
-  if (!_task_registry.tasks.empty() && _packet_runtime.callback) {
+  if (!_task_registry.tasks.empty() && hasPacketCallbackLocked()) {
     _packet_runtime.packet_sem.post();
   }
   return true;
@@ -638,23 +728,11 @@ void EsFileFerryPacker::stopPacketThreadLocked(std::thread &join_thread) {
 }
 
 void EsFileFerryPacker::packetThreadLoop() {
-  auto reap_http_fetch_threads = [this]() {
-    std::vector<std::thread> http_join_threads;
-    {
-      std::lock_guard<std::mutex> lock(_mtx);
-      reapCompletedHttpFetchThreadsLocked(http_join_threads);
-    }
-    for (auto &thread : http_join_threads) {
-      if (thread.joinable()) {
-        thread.join();
-      }
-    }
-  };
   while (true) {
     _packet_runtime.packet_sem.wait();
-    reap_http_fetch_threads();
     while (true) {
-      PacketCallback bootstrap_cb;
+      bool has_callback = false;
+      bool zero_copy = false;
       bool should_exit = false;
       bool should_emit_bootstrap = false;
       uint64_t round_payload_budget_bytes = 0;
@@ -667,19 +745,19 @@ void EsFileFerryPacker::packetThreadLoop() {
         should_emit_bootstrap = _packet_runtime.bootstrap_due;
         if (should_emit_bootstrap) {
           _packet_runtime.bootstrap_due = false;
-          bootstrap_cb = _packet_runtime.callback;
+          has_callback = hasPacketCallbackLocked();
+          zero_copy = isZeroCopyLocked();
         }
         round_payload_budget_bytes = _global_options.scheduler_round_budget_bytes;
       }
-      if (should_emit_bootstrap && bootstrap_cb) {
-        emitBootstrapPackets(bootstrap_cb);
+      if (should_emit_bootstrap && has_callback) {
+        emitBootstrapPackets(zero_copy);
       }
       const auto packet_count = processTickPackets(round_payload_budget_bytes);
       if (!should_emit_bootstrap && packet_count == 0) {
         break;
       }
     }
-    reap_http_fetch_threads();
     bool should_exit = false;
     {
       std::lock_guard<std::mutex> lock(_mtx);
@@ -694,6 +772,8 @@ void EsFileFerryPacker::packetThreadLoop() {
 size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes) {
   size_t packet_count = 0;
   bool downstream_congested = false;
+  bool zero_copy = false;
+  bool payload_crc32c = false;
   auto collect_ids = [&](const std::function<bool(const TaskState &)> &pred) {
     std::vector<std::string> ids;
     {
@@ -710,7 +790,9 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
   {
     std::lock_guard<std::mutex> lock(_mtx);
     recomputeAllTaskRateProfilesLocked(false);
-    downstream_congested = _packet_runtime.downstream_congested;
+    downstream_congested = isDataPlaneCongestedLocked();
+    zero_copy = isZeroCopyLocked();
+    payload_crc32c = _global_options.payload_crc32c;
   }
 
   // Control plane first: failed/info/end packets bypass the data fair round.
@@ -736,7 +818,6 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
         next_seq = it->second.send.next_seq;
         http_error = it->second.http.error;
       }
-      std::vector<uint8_t> status_payload(http_error.begin(), http_error.end());
       const auto status_ts = nextRelativeTimestampMs();
       TaskState status_task;
       status_task.task_id = task_id;
@@ -744,9 +825,12 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
       status_task.source.file_size = file_size;
       auto status_header =
           makePacketHeader(status_task, EsFilePacketType::TaskStatus, 0,
-                           static_cast<uint32_t>(status_payload.size()), 0,
+                           static_cast<uint32_t>(http_error.size()), 0,
                            next_seq, status_ts);
-      auto status_packet = buildPacket(status_task, status_header, status_payload);
+      auto status_packet = assemblePacket(
+          status_task, status_header, http_error.size(), zero_copy, payload_crc32c,
+          ContiguousPayload{reinterpret_cast<const uint8_t *>(http_error.data()),
+                            http_error.size()});
       if (!emitPacket(task_id, std::move(status_packet), status_header)) {
         continue;
       }
@@ -779,6 +863,8 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
       std::string file_name;
       uint64_t file_size = 0;
       uint32_t next_seq = 0;
+      bool resume = false;
+      bool striped = false;
       std::vector<uint8_t> http_meta_payload;
       {
         std::lock_guard<std::mutex> lock(_mtx);
@@ -791,13 +877,28 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
         file_name = it->second.source.file_name;
         file_size = it->second.source.file_size;
         next_seq = it->second.send.next_seq;
+        resume = it->second.send.resume;
+        // 是否条带化在 FileInfo 发出前定下，之后整个任务不再变化
+        it->second.send.striped = shouldStripeTaskLocked(it->second);
+        striped = it->second.send.striped;
         if (it->second.http.source) {
           http_meta_payload = it->second.http.response_meta_payload;
         }
       }
       uint16_t info_flags = 0;
+      std::string info_payload;
       if (!http_meta_payload.empty()) {
-        info_flags = kEsFileFlagFileInfoHasHttpResponseHeaders;
+        info_flags = kEsFileFlagFileInfoHasHttpResponseHeaders |
+                     kEsFileFlagFileInfoPayloadBase64;
+        info_payload = encodeBase64(std::string(
+            reinterpret_cast<const char *>(http_meta_payload.data()),
+            http_meta_payload.size()));
+      }
+      if (resume) {
+        info_flags |= kEsFileFlagFileInfoResume;
+      }
+      if (striped) {
+        info_flags |= kEsFileFlagStriped;
       }
       const auto info_ts = nextRelativeTimestampMs();
       TaskState info_task;
@@ -806,9 +907,12 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
       info_task.source.file_size = file_size;
       auto info_header = makePacketHeader(
           info_task, EsFilePacketType::FileInfo, 0,
-          static_cast<uint32_t>(http_meta_payload.size()), info_flags, next_seq,
+          static_cast<uint32_t>(info_payload.size()), info_flags, next_seq,
           info_ts);
-      auto info_packet = buildPacket(info_task, info_header, http_meta_payload);
+      auto info_packet = assemblePacket(
+          info_task, info_header, info_payload.size(), zero_copy, payload_crc32c,
+          ContiguousPayload{reinterpret_cast<const uint8_t *>(info_payload.data()),
+                            info_payload.size()});
       if (!emitPacket(task_id, std::move(info_packet), info_header)) {
         continue;
       }
@@ -850,13 +954,17 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
         uint64_t min_emit_payload_bytes = 0;
         const auto packet_ts = nextRelativeTimestampMs();
         std::shared_ptr<std::ifstream> file_stream;
-        std::shared_ptr<std::condition_variable> buffer_cv;
+        bool http_buffer_drained = false;
         bool can_emit_packet = false;
         bool should_try_start_http = false;
+        std::shared_ptr<TaskFecState> fec;
+        size_t fec_group_size = 0;
+        uint16_t chunk_flags = 0;
+        std::shared_ptr<TaskCompressState> compress;
         TaskState packet_task;
-        size_t payload_offset = 0;
         EsFilePacketHeader packet_header;
-        std::vector<uint8_t> packet;
+        PacketBuffer packet;
+        SharedSegmentsPayload chunk_payload;
         {
           std::lock_guard<std::mutex> lock(_mtx);
           auto it = _task_registry.tasks.find(task_id);
@@ -865,11 +973,21 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
             break;
           }
           auto &task = it->second;
+          if (!hasWritableStripeLocked(task)) {
+            break;
+          }
           memory_mode = task.source.memory_mode;
           http_chunk_mode = task.http.source;
           generation = task.generation;
           offset = task.send.sent_bytes;
           seq = task.send.next_seq;
+          fec = task.fec;
+          fec_group_size = fec ? fec->group_size.load() : 0;
+          chunk_flags = fec_group_size > 0 ? kEsFileFlagFecProtected : 0;
+          if (task.send.striped) {
+            chunk_flags |= kEsFileFlagStriped;
+          }
+          compress = task.compress;
           refillTokenBucket(task.control.emit_bucket);
           emit_token_quota = peekTokenBucketBytes(task.control.emit_bucket);
           min_emit_payload_bytes = _global_options.min_emit_payload_bytes;
@@ -915,69 +1033,48 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
                 packet_task.source.file_size = task.source.file_size;
                 packet_header = makePacketHeader(
                     packet_task, EsFilePacketType::FileChunk, offset,
-                    static_cast<uint32_t>(read_len), 0, seq, packet_ts);
-                packet = buildPacket(packet_task, packet_header, read_len,
-                                     &payload_offset);
-                size_t copied = 0;
-                while (copied < read_len && !task.http.buffer.chunks.empty()) {
+                    static_cast<uint32_t>(read_len), chunk_flags, seq, packet_ts);
+                // buffered_bytes 与块队列一致，read_len 字节必然可读；
+                // 锁内只取出各块的引用并出队，压缩、校验与拷贝在锁外进行
+                size_t consumed = 0;
+                while (consumed < read_len && !task.http.buffer.chunks.empty()) {
                   auto &front_chunk = task.http.buffer.chunks.front();
                   const auto available =
                       front_chunk->size - task.http.buffer.front_chunk_offset;
-                  const auto need = read_len - copied;
-                  const auto step = std::min(available, need);
-                  if (step == 0) {
-                    break;
-                  }
-                  std::memcpy(packet.data() + payload_offset + copied,
-                              front_chunk->data.data() +
-                                  task.http.buffer.front_chunk_offset,
-                              step);
-                  copied += step;
+                  const auto step = std::min(available, read_len - consumed);
+                  chunk_payload.append(
+                      front_chunk,
+                      front_chunk->data.data() + task.http.buffer.front_chunk_offset,
+                      step);
+                  consumed += step;
                   task.http.buffer.front_chunk_offset += step;
-                  task.http.buffer.buffered_bytes -= step;
-                  _http_runtime.total_buffered_bytes -= step;
                   if (task.http.buffer.front_chunk_offset >= front_chunk->size) {
                     task.http.buffer.chunks.pop_front();
                     task.http.buffer.front_chunk_offset = 0;
                   }
                 }
-                if (copied == 0) {
-                  no_data = true;
-                } else {
-                  if (copied < read_len) {
-                    read_len = copied;
-                    packet_header.payload_len = static_cast<uint32_t>(copied);
-                    packet_header.total_len = static_cast<uint32_t>(
-                        kEsFileFixedHeaderSize + packet_header.task_id_len +
-                        packet_header.file_name_len + packet_header.payload_len);
-                    const auto payload_len_pos =
-                        static_cast<size_t>(kEsFileCarrierPrefixSize + 24);
-                    const auto total_len_pos =
-                        static_cast<size_t>(kEsFileCarrierPrefixSize + 40);
-                    writeU32BEAt(packet, payload_len_pos, packet_header.payload_len);
-                    writeU32BEAt(packet, total_len_pos, packet_header.total_len);
-                    packet.resize(payload_offset + copied);
-                  }
-                  consumeTokenBucketBytes(task.control.emit_bucket, read_len);
-                  task.send.sent_bytes += read_len;
-                  task.send.next_seq++;
-                  quota = read_len >= quota ? 0 : quota - read_len;
-                  buffer_cv = task.http.buffer.cv;
-                  can_emit_packet = true;
-                  should_try_start_http =
-                      !_http_runtime.pending_fetches.empty() &&
-                      _http_runtime.active_fetches <
-                          _global_options.http_pull_concurrency_limit &&
-                      _http_runtime.total_buffered_bytes <
-                          _global_options.http_pull_total_buffer_limit_bytes;
-                }
+                task.http.buffer.buffered_bytes -= read_len;
+                _http_runtime.total_buffered_bytes -= read_len;
+                // 数据已出队，游标随之前进；令牌按组包后的线上负载扣减
+                task.send.sent_bytes += read_len;
+                task.send.next_seq++;
+                http_buffer_drained = true;
+                can_emit_packet = true;
+                advanceSendRangeLocked(task);
+                should_try_start_http =
+                    !_http_runtime.pending_fetches.empty() &&
+                    _http_runtime.active_fetches <
+                        _global_options.http_pull_concurrency_limit &&
+                    _http_runtime.total_buffered_bytes <
+                        _global_options.http_pull_total_buffer_limit_bytes;
               }
             }
           } else {
-            if (task.send.sent_bytes >= task.source.file_size) {
+            const auto range_end = sendRangeEnd(task);
+            if (task.send.sent_bytes >= range_end) {
               no_data = true;
             } else {
-              auto remain = task.source.file_size - task.send.sent_bytes;
+              auto remain = range_end - task.send.sent_bytes;
               const bool allow_tail_emit =
                   min_emit_payload_bytes > 0 && remain < min_emit_payload_bytes;
               if (min_emit_payload_bytes > 0 &&
@@ -996,9 +1093,10 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
                     remain));
               }
               if (task.source.memory_mode) {
-                if (task.send.sent_bytes < task.source.memory_payload.size()) {
+                if (task.source.memory_payload &&
+                    task.send.sent_bytes < task.source.memory_payload->size()) {
                   const auto available =
-                      task.source.memory_payload.size() -
+                      task.source.memory_payload->size() -
                       static_cast<size_t>(task.send.sent_bytes);
                   read_len = std::min(read_len, available);
                   if (read_len == 0) {
@@ -1009,17 +1107,12 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
                     packet_task.source.file_size = task.source.file_size;
                     packet_header = makePacketHeader(
                         packet_task, EsFilePacketType::FileChunk, offset,
-                        static_cast<uint32_t>(read_len), 0, seq, packet_ts);
-                    packet = buildPacket(packet_task, packet_header, read_len,
-                                         &payload_offset);
-                    std::memcpy(packet.data() + payload_offset,
-                                task.source.memory_payload.data() +
-                                    task.send.sent_bytes,
-                                read_len);
-                    consumeTokenBucketBytes(task.control.emit_bucket, read_len);
-                    task.send.sent_bytes += read_len;
-                    task.send.next_seq++;
-                    quota = read_len >= quota ? 0 : quota - read_len;
+                        static_cast<uint32_t>(read_len), chunk_flags, seq, packet_ts);
+                    // 内存数据不出队，游标与文件源一样在组包后校验并前进
+                    chunk_payload.append(
+                        task.source.memory_payload,
+                        task.source.memory_payload->data() + task.send.sent_bytes,
+                        read_len);
                     can_emit_packet = true;
                   }
                 } else {
@@ -1032,14 +1125,12 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
           }
         }
         if (no_data || read_len == 0) {
-          if (buffer_cv) {
-            buffer_cv->notify_one();
-          }
           break;
         }
 
-        if (buffer_cv) {
-          buffer_cv->notify_one();
+        if (http_buffer_drained) {
+          // 缓冲腾出空间，恢复因背压暂停的拉取
+          _http_fetch_engine.wakeup();
         }
         if (should_try_start_http) {
           maybeStartPendingHttpFetches();
@@ -1049,6 +1140,39 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
           if (!can_emit_packet) {
             break;
           }
+          // 压缩、CRC32C、转义与拷贝在锁外进行，不阻塞 HTTP 拉取线程写缓冲与任务增删
+          packet = assembleChunkPacket(packet_task, compress.get(), packet_header,
+                                       read_len, zero_copy, payload_crc32c,
+                                       chunk_payload);
+          {
+            std::lock_guard<std::mutex> lock(_mtx);
+            auto it = _task_registry.tasks.find(task_id);
+            if (it == _task_registry.tasks.end() || it->second.send.end_sent) {
+              break;
+            }
+            auto &task = it->second;
+            if (task.generation != generation) {
+              continue;
+            }
+            if (memory_mode) {
+              if (task.send.sent_bytes != offset || task.send.next_seq != seq) {
+                continue;
+              }
+              task.send.sent_bytes += read_len;
+              task.send.next_seq++;
+            }
+            // 令牌与本轮预算按线上负载扣减，压缩后的分片占用更少码率
+            const auto wire_len = packet_header.payload_len;
+            consumeTokenBucketBytes(task.control.emit_bucket, wire_len);
+            recordChunkSentLocked(task, packet_header);
+            quota = wire_len >= quota ? 0 : quota - wire_len;
+            if (memory_mode) {
+              advanceSendRangeLocked(task);
+            }
+          }
+          if (fec_group_size > 0) {
+            accumulateFecParity(*fec, offset, read_len, chunk_payload);
+          }
         } else {
           {
             std::lock_guard<std::mutex> lock(_mtx);
@@ -1060,49 +1184,78 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
             packet_task.source.file_name = it->second.source.file_name;
             packet_task.source.file_size = it->second.source.file_size;
           }
-          packet_header = makePacketHeader(
-              packet_task, EsFilePacketType::FileChunk, offset,
-              static_cast<uint32_t>(read_len), 0, seq, packet_ts);
-          packet =
-              buildPacket(packet_task, packet_header, read_len, &payload_offset);
-          file_stream->read(reinterpret_cast<char *>(
-                                packet.data() + static_cast<long>(payload_offset)),
+          // 文件读取在锁外进行，读到复用缓冲后按实际长度组包
+          if (_file_read_buffer.size() < read_len) {
+            _file_read_buffer.resize(read_len);
+          }
+          // 续传/补发时游标会跳转，按 data_offset 重新定位
+          if (!*file_stream ||
+              file_stream->tellg() != static_cast<std::streamoff>(offset)) {
+            file_stream->clear();
+            file_stream->seekg(static_cast<std::streamoff>(offset));
+          }
+          file_stream->read(reinterpret_cast<char *>(_file_read_buffer.data()),
                             static_cast<std::streamsize>(read_len));
           auto read_size = static_cast<size_t>(file_stream->gcount());
           if (read_size == 0) {
             break;
           }
-          if (read_size < read_len) {
-            packet_header.payload_len = static_cast<uint32_t>(read_size);
-            packet_header.total_len = static_cast<uint32_t>(
-                kEsFileFixedHeaderSize + packet_header.task_id_len +
-                packet_header.file_name_len + packet_header.payload_len);
-            const auto payload_len_pos =
-                static_cast<size_t>(kEsFileCarrierPrefixSize + 24);
-            const auto total_len_pos =
-                static_cast<size_t>(kEsFileCarrierPrefixSize + 40);
-            writeU32BEAt(packet, payload_len_pos, packet_header.payload_len);
-            writeU32BEAt(packet, total_len_pos, packet_header.total_len);
-            packet.resize(payload_offset + read_size);
-          }
-          std::lock_guard<std::mutex> lock(_mtx);
-          auto it = _task_registry.tasks.find(task_id);
-          if (it == _task_registry.tasks.end() || it->second.send.end_sent) {
-            break;
+          packet_header = makePacketHeader(
+              packet_task, EsFilePacketType::FileChunk, offset,
+              static_cast<uint32_t>(read_size), chunk_flags, seq, packet_ts);
+          const ContiguousPayload chunk_payload{_file_read_buffer.data(), read_size};
+          packet = assembleChunkPacket(packet_task, compress.get(), packet_header,
+                                       read_size, zero_copy, payload_crc32c,
+                                       chunk_payload);
+          {
+            std::lock_guard<std::mutex> lock(_mtx);
+            auto it = _task_registry.tasks.find(task_id);
+            if (it == _task_registry.tasks.end() || it->second.send.end_sent) {
+              break;
+            }
+            auto &task = it->second;
+            if (task.generation != generation || task.send.sent_bytes != offset ||
+                task.send.next_seq != seq) {
+              continue;
+            }
+            const auto wire_len = packet_header.payload_len;
+            consumeTokenBucketBytes(task.control.emit_bucket, wire_len);
+            recordChunkSentLocked(task, packet_header);
+            task.send.sent_bytes += read_size;
+            task.send.next_seq++;
+            quota = wire_len >= quota ? 0 : quota - wire_len;
+            advanceSendRangeLocked(task);
           }
-          auto &task = it->second;
-          if (task.generation != generation || task.send.sent_bytes != offset ||
-              task.send.next_seq != seq) {
-            continue;
+          // FEC 状态只由发包线程修改，异或在锁外完成
+          if (fec_group_size > 0) {
+            accumulateFecParity(*fec, offset, read_size, chunk_payload);
           }
-          consumeTokenBucketBytes(task.control.emit_bucket, read_size);
-          task.send.sent_bytes += read_size;
-          task.send.next_seq++;
-          quota = read_size >= quota ? 0 : quota - read_size;
         }
         if (emitPacket(task_id, std::move(packet), packet_header)) {
           ++packet_count;
         }
+        if (fec_group_size > 0 && fec->members.size() >= fec_group_size) {
+          // 组满后紧跟校验包，占用一个序号并计入发送令牌
+          uint32_t parity_seq = 0;
+          TaskState parity_task;
+          {
+            std::lock_guard<std::mutex> lock(_mtx);
+            auto it = _task_registry.tasks.find(task_id);
+            if (it == _task_registry.tasks.end() || it->second.generation != generation) {
+              fec->members.clear();
+              break;
+            }
+            auto &task = it->second;
+            parity_seq = task.send.next_seq++;
+            consumeTokenBucketBytes(task.control.emit_bucket, fec->parity.size());
+            parity_task.task_id = task.task_id;
+            parity_task.source.file_name = task.source.file_name;
+            parity_task.source.file_size = task.source.file_size;
+            parity_task.send.striped = task.send.striped;
+          }
+          packet_count += emitFecParity(parity_task, *fec, parity_seq, zero_copy,
+                                        payload_crc32c);
+        }
       }
 
     }
@@ -1116,6 +1269,8 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
     for (const auto &task_id : end_ids) {
       uint64_t end_offset = 0;
       uint32_t end_seq = 0;
+      uint32_t parity_seq = 0;
+      std::shared_ptr<TaskFecState> fec;
       TaskState end_task;
       {
         std::lock_guard<std::mutex> lock(_mtx);
@@ -1124,23 +1279,35 @@ size_t EsFileFerryPacker::processTickPackets(uint64_t total_payload_quota_bytes)
           continue;
         }
         end_offset = it->second.send.sent_bytes;
+        // 未满的最后一组在 FileEnd 之前补发校验包
+        if (it->second.fec && !it->second.fec->members.empty()) {
+          fec = it->second.fec;
+          parity_seq = it->second.send.next_seq++;
+        }
         end_seq = it->second.send.next_seq;
         end_task.task_id = it->second.task_id;
         end_task.source.file_name = it->second.source.file_name;
         end_task.source.file_size = it->second.source.file_size;
+        end_task.send.striped = it->second.send.striped;
         it->second.send.next_seq++;
         it->second.send.end_sent = true;
         it->second.source.stream.reset();
         clearTaskHttpBufferLocked(it->second);
-        it->second.source.memory_payload.clear();
-        it->second.source.memory_payload.shrink_to_fit();
+        it->second.source.memory_payload.reset();
         dirty = true;
       }
+      if (fec) {
+        packet_count += emitFecParity(end_task, *fec, parity_seq, zero_copy,
+                                      payload_crc32c);
+      }
       const auto end_ts = nextRelativeTimestampMs();
+      // 条带任务的 FileEnd 也带标志，接收端据此在数据未收齐时推迟完成
       auto end_header =
           makePacketHeader(end_task, EsFilePacketType::FileEnd, end_offset, 0,
-                           0, end_seq, end_ts);
-      auto end_packet = buildPacket(end_task, end_header, {});
+                           end_task.send.striped ? kEsFileFlagStriped : 0,
+                           end_seq, end_ts);
+      auto end_packet = assemblePacket(end_task, end_header, 0, zero_copy,
+                                       payload_crc32c, ContiguousPayload{nullptr, 0});
       if (emitPacket(task_id, std::move(end_packet), end_header)) {
         ++packet_count;
       }
@@ -1174,28 +1341,11 @@ void EsFileFerryPacker::erasePendingHttpFetchLocked(const std::string &task_id,
       _http_runtime.pending_fetches.end());
 }
 
-void EsFileFerryPacker::reapCompletedHttpFetchThreadsLocked(
-    std::vector<std::thread> &join_threads) {
-  auto it = _http_fetch_threads.begin();
-  while (it != _http_fetch_threads.end()) {
-    auto &thread_state = *it;
-    if (thread_state && thread_state->done &&
-        thread_state->done->load(std::memory_order_acquire)) {
-      if (thread_state->thread.joinable()) {
-        join_threads.emplace_back(std::move(thread_state->thread));
-      }
-      it = _http_fetch_threads.erase(it);
-      continue;
-    }
-    ++it;
-  }
-}
-
 std::vector<std::pair<std::string, uint64_t>>
 EsFileFerryPacker::collectHttpFetchLaunchesLocked() {
   std::vector<std::pair<std::string, uint64_t>> launches;
   bool dirty = false;
-  if (_packet_runtime.downstream_congested) {
+  if (isDataPlaneCongestedLocked()) {
     return launches;
   }
   while (_http_runtime.active_fetches < _global_options.http_pull_concurrency_limit &&
@@ -1265,211 +1415,34 @@ void EsFileFerryPacker::launchHttpFetchTask(const std::string &task_id,
       recomputeAllTaskRateProfilesLocked(false);
       return;
     }
-    source = it->second.source.file_path;
-    method = it->second.http.method;
-    headers = it->second.http.request_headers;
-    body = it->second.http.request_body;
+    auto &task = it->second;
+    source = task.source.file_path;
+    method = task.http.method;
+    headers = task.http.request_headers;
+    body = task.http.request_body;
+    task.http.fetch_begin = task.send.sent_bytes;
+    task.http.fetch_end = task.send.range_end;
+    task.http.stream_pos = 0;
+    if (task.http.fetch_begin > 0 || task.http.fetch_end > 0) {
+      // 区间任务只允许 GET（见 addTaskWithRanges），源站忽略 Range 时在 bufferHttpChunk 中截取区间
+      std::string range = "bytes=" + std::to_string(task.http.fetch_begin) + "-";
+      if (task.http.fetch_end > 0) {
+        range += std::to_string(task.http.fetch_end - 1);
+      }
+      headers.emplace_back("Range", std::move(range));
+    }
   }
 
-  auto fetch_done = std::make_shared<std::atomic_bool>(false);
-  std::thread fetch_thread([this, task_id, generation, source, method, headers,
-                            body, fetch_done]() {
-    const auto fetch_begin = std::chrono::steady_clock::now();
-    InfoL << "http fetch start task_id:" << task_id
-          << " generation:" << generation
-          << " method:" << method
-          << " url:" << source;
-    HttpHeaders response_headers;
-    uint32_t response_status_code = 0;
-    std::string fetch_err;
-    HttpStreamFetcher::TransferDiagnostics diagnostics;
-    const bool ok = HttpStreamFetcher::stream(
-        source, method, headers, body,
-        [this, task_id, generation](const uint8_t *data, size_t size) {
-          if (!data || size == 0) {
-            return true;
-          }
-          size_t consumed = 0;
-          auto logChunkAbort = [&](const char *reason, uint64_t task_generation,
-                                   size_t task_buffered_bytes,
-                                   bool has_task_state) {
-            WarnL << "http on_chunk abort, task_id:" << task_id
-                  << " reason:" << reason
-                  << " fetch_generation:" << generation
-                  << " task_generation:" << task_generation
-                  << " consumed_bytes:" << consumed
-                  << " incoming_chunk_bytes:" << size
-                  << " task_buffered_bytes:" << task_buffered_bytes
-                  << " has_task_state:" << has_task_state;
-          };
-          while (consumed < size) {
-            size_t copy_len = 0;
-            {
-              std::unique_lock<std::mutex> lock(_mtx);
-              bool waited_for_buffer = false;
-              bool waited_for_rate = false;
-              const auto wait_begin = std::chrono::steady_clock::now();
-              while (true) {
-                auto it = _task_registry.tasks.find(task_id);
-                if (_packet_runtime.packet_thread_exit) {
-                  logChunkAbort("packet_thread_exit", 0, 0, false);
-                  return false;
-                }
-                if (it == _task_registry.tasks.end()) {
-                  logChunkAbort("task_missing", 0, 0, false);
-                  return false;
-                }
-                if (it->second.generation != generation) {
-                  logChunkAbort("generation_mismatch", it->second.generation,
-                                it->second.http.buffer.buffered_bytes, true);
-                  return false;
-                }
-                auto &task = it->second;
-                auto buffer_cv = it->second.http.buffer.cv;
-                if (!buffer_cv) {
-                  logChunkAbort("null_buffer_cv", task.generation,
-                                task.http.buffer.buffered_bytes, true);
-                  return false;
-                }
-                if (_packet_runtime.downstream_congested) {
-                  waited_for_buffer = true;
-                  buffer_cv->wait_for(
-                      lock, std::chrono::milliseconds(kRateLimitWaitStepMs));
-                  continue;
-                }
-                refillTokenBucket(task.control.fetch_bucket);
-
-                if (task.http.buffer.buffered_bytes >=
-                        task.control.max_buffered_bytes &&
-                    task.http.buffer.buffered_bytes >
-                        task.control.resume_buffered_bytes) {
-                  waited_for_buffer = true;
-                  buffer_cv->wait_for(
-                      lock, std::chrono::milliseconds(kRateLimitWaitStepMs));
-                  continue;
-                }
-                if (_http_runtime.total_buffered_bytes >=
-                    _global_options.http_pull_total_buffer_limit_bytes) {
-                  waited_for_buffer = true;
-                  buffer_cv->wait_for(
-                      lock, std::chrono::milliseconds(kRateLimitWaitStepMs));
-                  continue;
-                }
-
-                const auto task_room = task.control.max_buffered_bytes >
-                                               task.http.buffer.buffered_bytes
-                                           ? task.control.max_buffered_bytes -
-                                                 task.http.buffer.buffered_bytes
-                                           : 0;
-                const auto total_room =
-                    _global_options.http_pull_total_buffer_limit_bytes >
-                            _http_runtime.total_buffered_bytes
-                        ? _global_options.http_pull_total_buffer_limit_bytes -
-                              _http_runtime.total_buffered_bytes
-                        : 0;
-                auto fetch_tokens = peekTokenBucketBytes(task.control.fetch_bucket);
-                if (task_room == 0 || total_room == 0) {
-                  waited_for_buffer = true;
-                  buffer_cv->wait_for(
-                      lock, std::chrono::milliseconds(kRateLimitWaitStepMs));
-                  continue;
-                }
-                if (fetch_tokens == 0) {
-                  waited_for_rate = true;
-                  auto wait_for =
-                      estimateTokenWait(task.control.fetch_bucket, 1);
-                  if (wait_for.count() <= 0) {
-                    wait_for = std::chrono::milliseconds(kRateLimitWaitStepMs);
-                  }
-                  buffer_cv->wait_for(lock, wait_for);
-                  continue;
-                }
-
-                auto chunk = _http_chunk_pool.obtain([](HttpChunkBuffer *buffer) {
-                  buffer->size = 0;
-                });
-                const auto max_copy = std::min<uint64_t>(
-                    std::min<uint64_t>(task_room, total_room), fetch_tokens);
-                copy_len = static_cast<size_t>(std::min<uint64_t>(
-                    std::min<uint64_t>(size - consumed, chunk->data.size()),
-                    max_copy));
-                if (copy_len == 0) {
-                  waited_for_rate = true;
-                  buffer_cv->wait_for(
-                      lock, std::chrono::milliseconds(kRateLimitWaitStepMs));
-                  continue;
-                }
-                std::memcpy(chunk->data.data(), data + consumed, copy_len);
-                chunk->size = copy_len;
-                consumeTokenBucketBytes(task.control.fetch_bucket, copy_len);
-                task.http.received_bytes += copy_len;
-                task.http.buffer.buffered_bytes += copy_len;
-                _http_runtime.total_buffered_bytes += copy_len;
-                task.http.buffer.chunks.emplace_back(std::move(chunk));
-                break;
-              }
-              if (waited_for_buffer || waited_for_rate) {
-                const auto wait_ms =
-                    std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::steady_clock::now() - wait_begin)
-                        .count();
-                if (wait_ms >= kHttpBufferWaitSlowLogMs) {
-                  auto it = _task_registry.tasks.find(task_id);
-                  const auto buffered_bytes =
-                      it != _task_registry.tasks.end() ? it->second.http.buffer.buffered_bytes : 0;
-                  WarnL << "http chunk buffer wait, task_id:" << task_id
-                        << " wait_ms:" << wait_ms
-                        << " waited_for_rate:" << waited_for_rate
-                        << " task_buffered_bytes:" << buffered_bytes
-                        << " total_buffered_bytes:" << _http_runtime.total_buffered_bytes
-                        << " chunk_block_size:" << kDefaultHttpBufferChunkBytes
-                        << " task_buffer_limit:"
-                        << (it != _task_registry.tasks.end()
-                                ? it->second.control.max_buffered_bytes
-                                : 0);
-                }
-              }
-            }
-            consumed += copy_len;
-            _packet_runtime.packet_sem.post();
-          }
-          return true;
-        },
-        [this, task_id, generation, source](uint32_t status_code,
-                                            const HttpHeaders &headers_in) {
-          uint64_t content_length = 0;
-          const bool has_content_length =
-              tryParseContentLength(headers_in, content_length);
-          std::lock_guard<std::mutex> lock(_mtx);
-          if (_packet_runtime.packet_thread_exit) {
-            return;
-          }
-          auto it = _task_registry.tasks.find(task_id);
-          if (it == _task_registry.tasks.end() || it->second.generation != generation) {
-            return;
-          }
-          auto &task = it->second;
-          refreshUnifiedTaskProfileLocked(task, false);
-          recomputeAllTaskRateProfilesLocked(false);
-          task.http.status_code = status_code;
-          task.http.response_meta_payload =
-              buildHttpResponseMetaPayload(status_code, headers_in);
-          task.http.headers_ready = true;
-          if (has_content_length) {
-            task.source.file_size = content_length;
-            task.http.size_known = true;
-          }
-          InfoL << "http fetch headers task_id:" << task_id
-                << " generation:" << generation
-                << " status:" << status_code
-                << " has_content_length:" << has_content_length
-                << " content_length:" << content_length
-                << " response_header_count:" << headers_in.size()
-                << " url:" << source;
-          _packet_runtime.packet_sem.post();
-        },
-        &response_headers, &response_status_code, fetch_err, &diagnostics);
-
+  const auto fetch_begin = std::chrono::steady_clock::now();
+  InfoL << "http fetch start task_id:" << task_id
+        << " generation:" << generation
+        << " method:" << method
+        << " url:" << source;
+  auto on_complete = [this, task_id, generation, source, method, fetch_begin](
+                         bool ok, uint32_t response_status_code,
+                         const HttpHeaders &response_headers,
+                         const std::string &fetch_err,
+                         const HttpStreamFetcher::TransferDiagnostics &diagnostics) {
     const auto fetch_cost_ms =
         std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::steady_clock::now() - fetch_begin)
@@ -1479,7 +1452,6 @@ void EsFileFerryPacker::launchHttpFetchTask(const std::string &task_id,
     bool final_size_known = false;
     size_t final_buffered_bytes = 0;
     bool packet_runtime_stopped = false;
-    std::shared_ptr<std::condition_variable> buffer_cv;
     {
       std::lock_guard<std::mutex> lock(_mtx);
       packet_runtime_stopped = _packet_runtime.packet_thread_exit;
@@ -1498,13 +1470,12 @@ void EsFileFerryPacker::launchHttpFetchTask(const std::string &task_id,
         task.http.response_meta_payload =
             buildHttpResponseMetaPayload(response_status_code, response_headers);
         task.http.headers_ready = true;
-        if (ok && !task.http.size_known) {
-          task.source.file_size = task.http.received_bytes;
+        if (ok && !task.http.size_known && task.http.fetch_end == 0) {
+          task.source.file_size = task.http.stream_pos;
           task.http.size_known = true;
           final_file_size = task.source.file_size;
           final_size_known = true;
         }
-        buffer_cv = task.http.buffer.cv;
         if (!ok) {
           task.http.failed = true;
           task.http.error = fetch_err.empty() ? "http fetch failed" : fetch_err;
@@ -1513,13 +1484,12 @@ void EsFileFerryPacker::launchHttpFetchTask(const std::string &task_id,
         } else {
           task.http.failed = false;
           task.http.error.clear();
+          // 缓冲已在拉取期间排空时由此切换到下一个补发区间
+          advanceSendRangeLocked(task);
         }
       }
       recomputeAllTaskRateProfilesLocked(false);
     }
-    if (buffer_cv) {
-      buffer_cv->notify_all();
-    }
     InfoL << "http fetch task_id:" << task_id << " method:" << method
           << " status:" << response_status_code << " ok:" << ok
           << " bytes:" << fetched_bytes << " file_size:" << final_file_size
@@ -1541,24 +1511,205 @@ void EsFileFerryPacker::launchHttpFetchTask(const std::string &task_id,
       maybeStartPendingHttpFetches();
       _packet_runtime.packet_sem.post();
     }
-    fetch_done->store(true, std::memory_order_release);
-    if (!packet_runtime_stopped) {
-      _packet_runtime.packet_sem.post();
-    }
-  });
-  std::vector<std::thread> http_join_threads;
+  };
+  // 所有拉取由同一个 curl multi 线程驱动，背压时暂停对应传输而不是阻塞线程
+  std::string start_err;
+  const bool started = _http_fetch_engine.start(
+      source, method, headers, body,
+      [this, task_id, generation](const uint8_t *data, size_t size) {
+        return bufferHttpChunk(task_id, generation, data, size);
+      },
+      [this, task_id, generation, source](uint32_t status_code,
+                                          const HttpHeaders &headers_in) {
+        uint64_t content_length = 0;
+        bool has_content_length =
+            tryParseContentLength(headers_in, content_length);
+        uint64_t range_first = 0;
+        uint64_t range_total = 0;
+        bool range_total_known = false;
+        const bool has_content_range =
+            status_code == 206 &&
+            tryParseContentRange(headers_in, range_first, range_total,
+                                 range_total_known);
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (_packet_runtime.packet_thread_exit) {
+          return;
+        }
+        auto it = _task_registry.tasks.find(task_id);
+        if (it == _task_registry.tasks.end() || it->second.generation != generation) {
+          return;
+        }
+        auto &task = it->second;
+        refreshUnifiedTaskProfileLocked(task, false);
+        recomputeAllTaskRateProfilesLocked(false);
+        task.http.status_code = status_code;
+        task.http.response_meta_payload =
+            buildHttpResponseMetaPayload(status_code, headers_in);
+        task.http.headers_ready = true;
+        if (task.compress && !isHttpContentCompressible(headers_in)) {
+          task.compress->content_skip = true;
+        }
+        if (has_content_range) {
+          // 206 的 Content-Length 只是区间长度，文件大小取 Content-Range 的 total
+          task.http.stream_pos = range_first;
+          has_content_length = range_total_known;
+          content_length = range_total;
+        } else {
+          // 源站忽略 Range 时从头返回完整内容
+          task.http.stream_pos = 0;
+        }
+        if (has_content_length) {
+          task.source.file_size = content_length;
+          task.http.size_known = true;
+        }
+        InfoL << "http fetch headers task_id:" << task_id
+              << " generation:" << generation
+              << " status:" << status_code
+              << " has_content_length:" << has_content_length
+              << " content_length:" << content_length
+              << " response_header_count:" << headers_in.size()
+              << " url:" << source;
+        _packet_runtime.packet_sem.post();
+      },
+      on_complete, start_err);
+  if (!started) {
+    on_complete(false, 0, HttpHeaders(), start_err,
+                HttpStreamFetcher::TransferDiagnostics());
+  }
+}
+
+int64_t EsFileFerryPacker::bufferHttpChunk(const std::string &task_id,
+                                           uint64_t generation,
+                                           const uint8_t *data, size_t size) {
+  if (!data || size == 0) {
+    return static_cast<int64_t>(size);
+  }
+  auto logChunkAbort = [&](const char *reason, uint64_t task_generation,
+                           size_t task_buffered_bytes, bool has_task_state) {
+    WarnL << "http on_chunk abort, task_id:" << task_id
+          << " reason:" << reason
+          << " fetch_generation:" << generation
+          << " task_generation:" << task_generation
+          << " incoming_chunk_bytes:" << size
+          << " task_buffered_bytes:" << task_buffered_bytes
+          << " has_task_state:" << has_task_state;
+  };
+  size_t consumed = 0;
   {
     std::lock_guard<std::mutex> lock(_mtx);
-    reapCompletedHttpFetchThreadsLocked(http_join_threads);
-    _http_fetch_threads.emplace_back(
-        std::unique_ptr<HttpFetchThreadState>(
-            new HttpFetchThreadState(std::move(fetch_thread), fetch_done)));
-  }
-  for (auto &thread : http_join_threads) {
-    if (thread.joinable()) {
-      thread.join();
+    auto it = _task_registry.tasks.find(task_id);
+    if (_packet_runtime.packet_thread_exit) {
+      logChunkAbort("packet_thread_exit", 0, 0, false);
+      return -1;
+    }
+    if (it == _task_registry.tasks.end()) {
+      logChunkAbort("task_missing", 0, 0, false);
+      return -1;
+    }
+    if (it->second.generation != generation) {
+      logChunkAbort("generation_mismatch", it->second.generation,
+                    it->second.http.buffer.buffered_bytes, true);
+      return -1;
+    }
+    auto &task = it->second;
+    bool limited_by_rate = false;
+    const bool data_plane_congested = isDataPlaneCongestedLocked();
+    if (!data_plane_congested) {
+      refillTokenBucket(task.control.fetch_bucket);
+    }
+    // 只缓冲 [fetch_begin, fetch_end) 内的数据，源站未按 Range 返回时跳过区间外字节
+    if (task.http.stream_pos < task.http.fetch_begin) {
+      const auto skip = static_cast<size_t>(std::min<uint64_t>(
+          task.http.fetch_begin - task.http.stream_pos, size));
+      consumed += skip;
+      task.http.stream_pos += skip;
+    }
+    if (task.http.fetch_end > 0 && task.http.stream_pos >= task.http.fetch_end) {
+      task.http.stream_pos += size - consumed;
+      consumed = size;
+    }
+    // 下游拥塞、缓冲已满或令牌不足时只接收部分数据，剩余部分由拉取引擎暂停后重试
+    while (!data_plane_congested && consumed < size) {
+      if (task.http.buffer.buffered_bytes >= task.control.max_buffered_bytes &&
+          task.http.buffer.buffered_bytes > task.control.resume_buffered_bytes) {
+        break;
+      }
+      const auto task_room = task.control.max_buffered_bytes >
+                                     task.http.buffer.buffered_bytes
+                                 ? task.control.max_buffered_bytes -
+                                       task.http.buffer.buffered_bytes
+                                 : 0;
+      const auto total_room =
+          _global_options.http_pull_total_buffer_limit_bytes >
+                  _http_runtime.total_buffered_bytes
+              ? _global_options.http_pull_total_buffer_limit_bytes -
+                    _http_runtime.total_buffered_bytes
+              : 0;
+      if (task_room == 0 || total_room == 0) {
+        break;
+      }
+      const auto fetch_tokens = peekTokenBucketBytes(task.control.fetch_bucket);
+      if (fetch_tokens == 0) {
+        limited_by_rate = true;
+        break;
+      }
+
+      auto chunk = _http_chunk_pool.obtain([](HttpChunkBuffer *buffer) {
+        buffer->size = 0;
+      });
+      auto max_copy = std::min<uint64_t>(
+          std::min<uint64_t>(task_room, total_room), fetch_tokens);
+      if (task.http.fetch_end > 0) {
+        max_copy = std::min<uint64_t>(max_copy,
+                                      task.http.fetch_end - task.http.stream_pos);
+      }
+      const auto copy_len = static_cast<size_t>(std::min<uint64_t>(
+          std::min<uint64_t>(size - consumed, chunk->data.size()), max_copy));
+      std::memcpy(chunk->data.data(), data + consumed, copy_len);
+      chunk->size = copy_len;
+      consumeTokenBucketBytes(task.control.fetch_bucket, copy_len);
+      task.http.received_bytes += copy_len;
+      task.http.stream_pos += copy_len;
+      task.http.buffer.buffered_bytes += copy_len;
+      _http_runtime.total_buffered_bytes += copy_len;
+      task.http.buffer.chunks.emplace_back(std::move(chunk));
+      consumed += copy_len;
+      if (task.http.fetch_end > 0 && task.http.stream_pos >= task.http.fetch_end) {
+        task.http.stream_pos += size - consumed;
+        consumed = size;
+      }
+    }
+
+    auto &buffer = task.http.buffer;
+    const auto now = std::chrono::steady_clock::now();
+    if (consumed > 0 && buffer.waiting) {
+      buffer.waiting = false;
+      const auto wait_ms =
+          std::chrono::duration_cast<std::chrono::milliseconds>(now - buffer.wait_begin)
+              .count();
+      if (wait_ms >= kHttpBufferWaitSlowLogMs) {
+        WarnL << "http chunk buffer wait, task_id:" << task_id
+              << " wait_ms:" << wait_ms
+              << " waited_for_rate:" << buffer.waited_for_rate
+              << " task_buffered_bytes:" << buffer.buffered_bytes
+              << " total_buffered_bytes:" << _http_runtime.total_buffered_bytes
+              << " chunk_block_size:" << kDefaultHttpBufferChunkBytes
+              << " task_buffer_limit:" << task.control.max_buffered_bytes;
+      }
     }
+    if (consumed < size) {
+      if (!buffer.waiting) {
+        buffer.waiting = true;
+        buffer.waited_for_rate = false;
+        buffer.wait_begin = now;
+      }
+      buffer.waited_for_rate = buffer.waited_for_rate || limited_by_rate;
+    }
+  }
+  if (consumed > 0) {
+    _packet_runtime.packet_sem.post();
   }
+  return static_cast<int64_t>(consumed);
 }
 
 // Query And Packet Helpers
@@ -1574,7 +1725,10 @@ std::vector<EsFilePackTaskInfo> EsFileFerryPacker::getTaskInfos() const {
     info.file_size = it.second.source.file_size;
     info.sent_bytes = it.second.send.sent_bytes;
     info.next_seq = it.second.send.next_seq;
+    info.wire_payload_bytes = it.second.send.wire_payload_bytes;
+    info.compressed_chunk_count = it.second.send.compressed_chunk_count;
     info.info_sent = it.second.send.info_sent;
+    info.striped = it.second.send.striped;
     info.completed = it.second.send.end_sent;
     infos.emplace_back(std::move(info));
   }
@@ -1636,18 +1790,22 @@ EsFilePacketHeader EsFileFerryPacker::makePacketHeader(
   return header;
 }
 
-void EsFileFerryPacker::emitBootstrapPackets(const PacketCallback &cb) const {
-  std::vector<uint8_t> sps = {0x00, 0x00, 0x00, 0x01, 0x67, 0x42,
-                              0xC0, 0x1E, 0xDA, 0x02, 0x80, 0x2D,
-                              0xD0, 0x80, 0x80, 0xA0};
-  std::vector<uint8_t> pps = {0x00, 0x00, 0x00, 0x01,
-                              0x68, 0xCE, 0x06, 0xE2};
-  std::vector<uint8_t> idr = {0x00, 0x00, 0x00, 0x01, 0x65,
-                              0x88, 0x84, 0x21, 0xA0};
-  EsFilePacketHeader header;
-  cb(kBootstrapTaskId, std::move(sps), header);
-  cb(kBootstrapTaskId, std::move(pps), header);
-  cb(kBootstrapTaskId, std::move(idr), header);
+void EsFileFerryPacker::emitBootstrapPackets(bool zero_copy) {
+  static const uint8_t sps[] = {0x00, 0x00, 0x00, 0x01, 0x67, 0x42,
+                                0xC0, 0x1E, 0xDA, 0x02, 0x80, 0x2D,
+                                0xD0, 0x80, 0x80, 0xA0};
+  static const uint8_t pps[] = {0x00, 0x00, 0x00, 0x01,
+                                0x68, 0xCE, 0x06, 0xE2};
+  static const uint8_t idr[] = {0x00, 0x00, 0x00, 0x01, 0x65,
+                                0x88, 0x84, 0x21, 0xA0};
+  auto emit_nal = [&](const uint8_t *data, size_t size) {
+    auto packet = makePacketBuffer(size, zero_copy);
+    std::memcpy(packet.data(), data, size);
+    emitPacket(kBootstrapTaskId, std::move(packet), EsFilePacketHeader());
+  };
+  emit_nal(sps, sizeof(sps));
+  emit_nal(pps, sizeof(pps));
+  emit_nal(idr, sizeof(idr));
 }
 
 uint32_t EsFileFerryPacker::nextRelativeTimestampMs() {
@@ -1669,20 +1827,93 @@ uint32_t EsFileFerryPacker::nextRelativeTimestampMs() {
   return _packet_runtime.last_ts_ms;
 }
 
-std::vector<uint8_t> EsFileFerryPacker::buildPacket(
-    const TaskState &task, EsFilePacketHeader &header,
-    const std::vector<uint8_t> &payload) const {
-  size_t payload_offset = 0;
-  auto out = buildPacket(task, header, payload.size(), &payload_offset);
-  if (!payload.empty()) {
-    std::memcpy(out.data() + payload_offset, payload.data(), payload.size());
+bool EsFileFerryPacker::hasPacketCallbackLocked() const {
+  return _packet_runtime.callback || _packet_runtime.buffer_callback ||
+         !_packet_runtime.stripe_callbacks.empty();
+}
+
+bool EsFileFerryPacker::isZeroCopyLocked() const {
+  return _packet_runtime.buffer_callback || !_packet_runtime.stripe_callbacks.empty();
+}
+
+bool EsFileFerryPacker::isDataPlaneCongestedLocked() const {
+  if (_packet_runtime.downstream_congested) {
+    return true;
+  }
+  const auto &states = _packet_runtime.stripe_congested;
+  return !states.empty() &&
+         std::all_of(states.begin(), states.end(), [](bool congested) { return congested; });
+}
+
+bool EsFileFerryPacker::hasWritableStripeLocked(const TaskState &task) const {
+  const auto &states = _packet_runtime.stripe_congested;
+  if (states.empty()) {
+    return true;
+  }
+  if (task.send.striped) {
+    return std::find(states.begin(), states.end(), false) != states.end();
+  }
+  return !states[std::hash<std::string>()(task.task_id) % states.size()];
+}
+
+bool EsFileFerryPacker::shouldStripeTaskLocked(const TaskState &task) const {
+  // 大小未知的 HTTP 源无法判断是否值得拆分，固定走一路
+  return _packet_runtime.stripe_callbacks.size() > 1 && task.source.file_size > 0 &&
+         task.source.file_size >= _global_options.stripe_min_file_bytes;
+}
+
+size_t EsFileFerryPacker::pickStripeLocked(const std::string &task_id,
+                                           const EsFilePacketHeader &header) const {
+  const auto &states = _packet_runtime.stripe_congested;
+  const auto count = states.size();
+  const bool striped_data =
+      (header.flags & kEsFileFlagStriped) != 0 &&
+      (header.type == EsFilePacketType::FileChunk ||
+       header.type == EsFilePacketType::FileParity);
+  if (!striped_data) {
+    // 控制面包与非条带任务固定一路，保证同一任务在该路上有序
+    return std::hash<std::string>()(task_id) % count;
+  }
+  // 按 seq 轮转，遇到拥塞载体顺延到下一路；全部拥塞时仍按 seq 发出
+  const auto first = header.seq % count;
+  for (size_t i = 0; i < count; ++i) {
+    const auto stripe = (first + i) % count;
+    if (!states[stripe]) {
+      return stripe;
+    }
+  }
+  return first;
+}
+
+void EsFileFerryPacker::onPacketCallbackChangedLocked() {
+  if (hasPacketCallbackLocked()) {
+    _packet_runtime.ts_started = false;
+    _packet_runtime.last_ts_ms = 0;
+    _packet_runtime.bootstrap_due = true;
+    _packet_runtime.packet_sem.post();
+  } else {
+    _packet_runtime.bootstrap_due = false;
+  }
+}
+
+EsFileFerryPacker::PacketBuffer EsFileFerryPacker::makePacketBuffer(
+    size_t size, bool zero_copy) {
+  PacketBuffer out;
+  if (zero_copy) {
+    // 池中缓冲容量与本次相近时直接复用内存
+    out.pooled = _packet_pool.obtain2();
+    out.pooled->setCapacity(size);
+    out.pooled->setSize(size);
+  } else {
+    out.bytes.resize(size);
   }
   return out;
 }
 
-std::vector<uint8_t> EsFileFerryPacker::buildPacket(
+template <typename Payload>
+EsFileFerryPacker::PacketBuffer EsFileFerryPacker::assemblePacket(
     const TaskState &task, EsFilePacketHeader &header, size_t payload_len,
-    size_t *payload_offset) const {
+    bool zero_copy, bool payload_crc32c, const Payload &payload) {
   header.task_id_len = static_cast<uint16_t>(task.task_id.size());
   header.file_name_len = static_cast<uint16_t>(task.source.file_name.size());
   header.payload_len = static_cast<uint32_t>(payload_len);
@@ -1691,84 +1922,238 @@ std::vector<uint8_t> EsFileFerryPacker::buildPacket(
   header.magic = kEsFilePacketMagic;
   header.version = kEsFilePacketVersion;
   header.file_size = task.source.file_size;
-  const auto total_len = header.total_len;
-
-  std::vector<uint8_t> out;
-  out.reserve(total_len + kEsFileCarrierPrefixSize);
-  AppendEsFileCarrierPrefix(out);
-  AppendEsFilePacketHeader(out, header);
-  out.insert(out.end(), task.task_id.begin(), task.task_id.end());
-  out.insert(out.end(), task.source.file_name.begin(), task.source.file_name.end());
-  const auto data_offset = out.size();
-  if (payload_offset) {
-    *payload_offset = data_offset;
-  }
-  out.resize(data_offset + payload_len);
+
+  // 先只读扫描一遍得到转义字节数，以便一次分配准确大小；
+  // 协议头中的 payload_len/total_len 仍为转义前长度。
+  // CRC32C 在同一遍扫描中计算，覆盖转义前的负载
+  size_t inserted = 0;
+  const bool escape = kEnableAnnexBPayloadEscape && payload_len > 0;
+  const bool checksum = payload_crc32c && payload_len > 0;
+  if (escape || checksum) {
+    EsFileAnnexBEscapeState scan_state;
+    uint32_t crc = 0;
+    payload([&](const uint8_t *data, size_t size) {
+      if (checksum) {
+        crc = UpdateEsFileCrc32c(crc, data, size);
+      }
+      if (escape) {
+        inserted += ScanEsFileAnnexBEscape(data, size, scan_state);
+      }
+    });
+    if (inserted > 0) {
+      header.flags = static_cast<uint16_t>(header.flags | kEsFileFlagPayloadEscaped);
+    }
+    if (checksum) {
+      header.crc32 = crc;
+      header.flags = static_cast<uint16_t>(header.flags | kEsFileFlagPayloadCrc32c);
+    }
+  }
+
+  auto out = makePacketBuffer(kEsFileCarrierPrefixSize + kEsFileFixedHeaderSize +
+                                  task.task_id.size() + task.source.file_name.size() +
+                                  payload_len + inserted,
+                              zero_copy);
+  auto *ptr = WriteEsFileCarrierPrefix(out.data());
+  ptr = WriteEsFilePacketHeader(ptr, header);
+  std::memcpy(ptr, task.task_id.data(), task.task_id.size());
+  ptr += task.task_id.size();
+  std::memcpy(ptr, task.source.file_name.data(), task.source.file_name.size());
+  ptr += task.source.file_name.size();
+  if (inserted == 0) {
+    payload([&](const uint8_t *data, size_t size) {
+      std::memcpy(ptr, data, size);
+      ptr += size;
+    });
+  } else {
+    EsFileAnnexBEscapeState escape_state;
+    payload([&](const uint8_t *data, size_t size) {
+      ptr = EscapeEsFileAnnexB(data, size, ptr, escape_state);
+    });
+  }
   return out;
 }
 
+void EsFileFerryPacker::initTaskCompressLocked(TaskState &task) const {
+  const auto codec = _global_options.payload_compression;
+  if (codec == EsFileCompressCodec::None || !IsEsFileCompressCodecAvailable(codec)) {
+    return;
+  }
+  task.compress = std::make_shared<TaskCompressState>();
+  task.compress->codec = codec;
+}
+
+void EsFileFerryPacker::recordChunkSentLocked(TaskState &task,
+                                              const EsFilePacketHeader &header) {
+  task.send.wire_payload_bytes += header.payload_len;
+  if (EsFileCompressCodecFromFlags(header.flags) != EsFileCompressCodec::None) {
+    task.send.compressed_chunk_count++;
+  }
+}
+
+template <typename Payload>
+EsFileFerryPacker::PacketBuffer EsFileFerryPacker::assembleChunkPacket(
+    const TaskState &task, TaskCompressState *compress, EsFilePacketHeader &header,
+    size_t payload_len, bool zero_copy, bool payload_crc32c, const Payload &payload) {
+  if (!compress || payload_len < kMinCompressPayloadBytes || compress->content_skip) {
+    return assemblePacket(task, header, payload_len, zero_copy, payload_crc32c, payload);
+  }
+  if (compress->skip_chunks > 0) {
+    --compress->skip_chunks;
+    return assemblePacket(task, header, payload_len, zero_copy, payload_crc32c, payload);
+  }
+  // 单段负载直接压缩，多段（HTTP 块队列）先拼接
+  const uint8_t *input = nullptr;
+  size_t segments = 0;
+  payload([&](const uint8_t *data, size_t) {
+    if (segments++ == 0) {
+      input = data;
+    }
+  });
+  if (segments > 1) {
+    _compress_input_buffer.resize(payload_len);
+    size_t pos = 0;
+    payload([&](const uint8_t *data, size_t size) {
+      std::memcpy(_compress_input_buffer.data() + pos, data, size);
+      pos += size;
+    });
+    input = _compress_input_buffer.data();
+  }
+  // 至少节省 1/8 才按压缩发送，否则按原样发送并退避，退避分片数随连续失败翻倍
+  if (_compressor.compress(compress->codec, input, payload_len,
+                           payload_len - payload_len / 8, _compress_output_buffer)) {
+    compress->miss_streak = 0;
+    header.flags = static_cast<uint16_t>(header.flags | EsFileCompressCodecFlag(compress->codec));
+    return assemblePacket(task, header, _compress_output_buffer.size(), zero_copy,
+                          payload_crc32c,
+                          ContiguousPayload{_compress_output_buffer.data(),
+                                            _compress_output_buffer.size()});
+  }
+  compress->skip_chunks =
+      std::min<uint32_t>(kCompressBackoffChunks << compress->miss_streak,
+                         kMaxCompressBackoffChunks);
+  if (compress->miss_streak < kMaxCompressMissStreak) {
+    ++compress->miss_streak;
+  }
+  return assemblePacket(task, header, payload_len, zero_copy, payload_crc32c, payload);
+}
+
+void EsFileFerryPacker::initTaskFecLocked(TaskState &task) const {
+  if (_global_options.fec_group_size == 0) {
+    return;
+  }
+  task.fec = std::make_shared<TaskFecState>();
+  task.fec->group_size = _global_options.fec_group_size;
+}
+
+template <typename Payload>
+void EsFileFerryPacker::accumulateFecParity(TaskFecState &fec, uint64_t offset,
+                                            size_t size, const Payload &payload) {
+  if (fec.members.empty()) {
+    fec.parity.clear();
+  }
+  if (fec.parity.size() < size) {
+    fec.parity.resize(size, 0);
+  }
+  size_t pos = 0;
+  payload([&](const uint8_t *data, size_t len) {
+    XorEsFileFecBytes(fec.parity.data() + pos, data, len);
+    pos += len;
+  });
+  EsFileFecMember member;
+  member.offset = offset;
+  member.size = static_cast<uint32_t>(size);
+  fec.members.push_back(member);
+}
+
+size_t EsFileFerryPacker::emitFecParity(const TaskState &task, TaskFecState &fec,
+                                        uint32_t seq, bool zero_copy,
+                                        bool payload_crc32c) {
+  if (fec.members.empty()) {
+    return 0;
+  }
+  std::vector<uint8_t> table(EsFileFecTableSize(fec.members.size()));
+  WriteEsFileFecTable(table.data(), fec.members);
+  const auto payload_len = table.size() + fec.parity.size();
+  auto header = makePacketHeader(task, EsFilePacketType::FileParity,
+                                 fec.members.front().offset,
+                                 static_cast<uint32_t>(payload_len),
+                                 task.send.striped ? kEsFileFlagStriped : 0, seq,
+                                 nextRelativeTimestampMs());
+  auto packet = assemblePacket(
+      task, header, payload_len, zero_copy, payload_crc32c,
+      [&](const std::function<void(const uint8_t *, size_t)> &fn) {
+        fn(table.data(), table.size());
+        fn(fec.parity.data(), fec.parity.size());
+      });
+  fec.members.clear();
+  return emitPacket(task.task_id, std::move(packet), header) ? 1 : 0;
+}
+
 bool EsFileFerryPacker::emitPacket(
-    const std::string &task_id, std::vector<uint8_t> &&packet,
-    const EsFilePacketHeader &header) const {
+    const std::string &task_id, PacketBuffer &&packet,
+    const EsFilePacketHeader &header) {
   PacketCallback cb;
+  PacketBufferCallback buffer_cb;
+  std::vector<PacketBufferCallback> stripe_cbs;
   {
     std::lock_guard<std::mutex> lock(_mtx);
     cb = _packet_runtime.callback;
-  }
-  if (cb) {
-    auto header_out = header;
-    if (task_id != kBootstrapTaskId &&
-        header_out.type == EsFilePacketType::FileInfo &&
-        encodeFileInfoPayloadBase64(packet)) {
-      header_out.flags = static_cast<uint16_t>(
-          header_out.flags | kEsFileFlagFileInfoPayloadBase64);
-      size_t prefix_size = 0;
-      if (DetectEsFileCarrierPrefixSize(packet.data(), packet.size(),
-                                        prefix_size)) {
-        EsFilePacketHeader tmp_header;
-        if (DecodeEsFilePacketHeader(packet.data() + prefix_size,
-                                     packet.size() - prefix_size, tmp_header)) {
-          header_out.payload_len = tmp_header.payload_len;
-          header_out.total_len = tmp_header.total_len;
-        }
+    buffer_cb = _packet_runtime.buffer_callback;
+    if (!_packet_runtime.stripe_callbacks.empty()) {
+      if (task_id == kBootstrapTaskId) {
+        // 每路载体各自需要引导 NAL 才能进入可解码态
+        stripe_cbs = _packet_runtime.stripe_callbacks;
+      } else {
+        stripe_cbs.emplace_back(
+            _packet_runtime.stripe_callbacks[pickStripeLocked(task_id, header)]);
       }
     }
-    if (task_id != kBootstrapTaskId &&
-        kEnableAnnexBPayloadEscape &&
-        maybeEscapeCarrierPacket(packet)) {
-      header_out.flags =
-          static_cast<uint16_t>(header_out.flags | kEsFileFlagPayloadEscaped);
-    }
-    if (task_id != kBootstrapTaskId) {
-      size_t prefix_size = 0;
-      if (DetectEsFileCarrierPrefixSize(packet.data(), packet.size(),
-                                        prefix_size)) {
-        writeU16BEAt(packet, prefix_size + 10, header_out.flags);
-      }
+  }
+  if (!cb && !buffer_cb && stripe_cbs.empty()) {
+    return true;
+  }
+  // 组包后回调被切换时才需要在两种缓冲形式之间转换
+  if ((buffer_cb || !stripe_cbs.empty()) && !packet.pooled) {
+    auto pooled = makePacketBuffer(packet.bytes.size(), true);
+    if (!packet.bytes.empty()) {
+      std::memcpy(pooled.data(), packet.bytes.data(), packet.bytes.size());
     }
-    if (header.type == EsFilePacketType::FileInfo ||
-        header.type == EsFilePacketType::FileEnd) {
-      DebugL << "emit packet callback, task_id:" << task_id
-             << " type:" << EsFilePacketTypeToString(header.type)
-             << " seq:" << header.seq
-             << " offset:" << header.data_offset
-             << " payload_len:" << header.payload_len
-             << " file_size:" << header.file_size
-             << " total_packet_size:" << packet.size();
-    }
-    const auto emit_begin = std::chrono::steady_clock::now();
-    cb(task_id, std::move(packet), header_out);
-    const auto emit_cost_ms =
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now() - emit_begin)
-            .count();
-    if (emit_cost_ms >= kEmitPacketSlowLogMs) {
-      WarnL << "emit packet callback slow, task_id:" << task_id
-            << " type:" << EsFilePacketTypeToString(header_out.type)
-            << " seq:" << header_out.seq
-            << " payload_len:" << header_out.payload_len
-            << " cost_ms:" << emit_cost_ms;
+    packet = std::move(pooled);
+  } else if (cb && packet.pooled) {
+    const auto *data = reinterpret_cast<const uint8_t *>(packet.pooled->data());
+    packet.bytes.assign(data, data + packet.pooled->size());
+    packet.pooled.reset();
+  }
+  if (header.type == EsFilePacketType::FileInfo ||
+      header.type == EsFilePacketType::FileEnd) {
+    DebugL << "emit packet callback, task_id:" << task_id
+           << " type:" << EsFilePacketTypeToString(header.type)
+           << " seq:" << header.seq
+           << " offset:" << header.data_offset
+           << " payload_len:" << header.payload_len
+           << " file_size:" << header.file_size
+           << " total_packet_size:" << packet.size();
+  }
+  const auto emit_begin = std::chrono::steady_clock::now();
+  if (!stripe_cbs.empty()) {
+    for (const auto &stripe_cb : stripe_cbs) {
+      stripe_cb(task_id, packet.pooled, header);
     }
+  } else if (buffer_cb) {
+    buffer_cb(task_id, packet.pooled, header);
+  } else {
+    cb(task_id, std::move(packet.bytes), header);
+  }
+  const auto emit_cost_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - emit_begin)
+          .count();
+  if (emit_cost_ms >= kEmitPacketSlowLogMs) {
+    WarnL << "emit packet callback slow, task_id:" << task_id
+          << " type:" << EsFilePacketTypeToString(header.type)
+          << " seq:" << header.seq
+          << " payload_len:" << header.payload_len
+          << " cost_ms:" << emit_cost_ms;
   }
   return true;
 }
@@ -1951,19 +2336,6 @@ void EsFileFerryPacker::consumeTokenBucketBytes(TokenBucket &bucket,
 
 // Scheduling Helpers
 
-std::chrono::milliseconds EsFileFerryPacker::estimateTokenWait(
-    const TokenBucket &bucket, uint64_t min_bytes) {
-  if (bucket.unlimited || bucket.tokens >= min_bytes) {
-    return std::chrono::milliseconds(0);
-  }
-  if (bucket.rate_bps == 0) {
-    return std::chrono::milliseconds(0);
-  }
-  const auto deficit = min_bytes - bucket.tokens;
-  const auto wait_ms = (deficit * 1000 + bucket.rate_bps - 1) / bucket.rate_bps;
-  return std::chrono::milliseconds(wait_ms == 0 ? 1 : wait_ms);
-}
-
 std::vector<std::string> EsFileFerryPacker::snapshotSchedulableTaskIds() const {
   std::lock_guard<std::mutex> lock(_mtx);
   std::vector<std::string> ids;
@@ -2013,13 +2385,16 @@ bool EsFileFerryPacker::isTaskReadyToEmitEnd(
   if (task.send.end_sent || !task.send.info_sent) {
     return false;
   }
+  if (!task.send.pending_ranges.empty()) {
+    return false;
+  }
   if (task.http.source) {
     if (task.http.queued || task.http.active || task.http.failed) {
       return false;
     }
     return isHttpTaskBufferDrained(task);
   }
-  return task.send.sent_bytes >= task.source.file_size;
+  return task.send.sent_bytes >= sendRangeEnd(task);
 }
 
 bool EsFileFerryPacker::isTaskControlReady(
@@ -2053,7 +2428,44 @@ bool EsFileFerryPacker::isTaskDataSchedulable(
            task.http.buffer.buffered_bytes > 0;
   }
   if (task.source.memory_mode) {
-    return task.send.sent_bytes < task.source.memory_payload.size();
+    return task.source.memory_payload &&
+           task.send.sent_bytes <
+               std::min<uint64_t>(sendRangeEnd(task), task.source.memory_payload->size());
+  }
+  return task.send.sent_bytes < sendRangeEnd(task);
+}
+
+uint64_t EsFileFerryPacker::sendRangeEnd(const EsFileFerryPacker::TaskState &task) {
+  const auto range_end = task.send.range_end;
+  if (task.http.source && !task.http.size_known) {
+    return range_end;
+  }
+  if (range_end == 0 || range_end > task.source.file_size) {
+    return task.source.file_size;
   }
-  return task.send.sent_bytes < task.source.file_size;
+  return range_end;
+}
+
+bool EsFileFerryPacker::advanceSendRangeLocked(TaskState &task) {
+  if (task.send.pending_ranges.empty()) {
+    return false;
+  }
+  if (task.http.source) {
+    if (task.http.queued || task.http.active || task.http.failed ||
+        !isHttpTaskBufferDrained(task)) {
+      return false;
+    }
+  } else if (task.send.sent_bytes < sendRangeEnd(task)) {
+    return false;
+  }
+  const auto next = task.send.pending_ranges.front();
+  task.send.pending_ranges.pop_front();
+  task.send.sent_bytes = next.first;
+  task.send.range_end = next.second;
+  if (!task.http.source) {
+    return false;
+  }
+  task.http.queued = true;
+  _http_runtime.pending_fetches.emplace_back(task.task_id, task.generation);
+  return true;
 }
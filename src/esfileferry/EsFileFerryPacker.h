@@ -1,12 +1,14 @@
 ﻿#pragma once
 
 #include "HttpStreamFetcher.h"
+#include "EsFileCompress.h"
+#include "EsFileFec.h"
 #include "EsFilePayloadProtocol.h"
 #include "Poller/Timer.h"
+#include "Network/Buffer.h"
 #include "Util/ResourcePool.h"
 #include <atomic>
 #include <chrono>
-#include <condition_variable>
 #include <cstdint>
 #include <deque>
 #include <functional>
@@ -28,12 +30,18 @@ struct EsFilePackTaskInfo {
     std::string file_name;
     // 文件总大小
     uint64_t file_size = 0;
-    // 已发送字节数
+    // 发送游标（下一个待发送字节的偏移）；非续传任务即已发送字节数
     uint64_t sent_bytes = 0;
     // 下一个包序号
     uint32_t next_seq = 0;
+    // FileChunk 实际发出的负载字节数（压缩后，不含转义）
+    uint64_t wire_payload_bytes = 0;
+    // 压缩发送的 FileChunk 数量
+    uint64_t compressed_chunk_count = 0;
     // FileInfo 是否已发送
     bool info_sent = false;
+    // 是否按条带分发到多路载体
+    bool striped = false;
     // 任务是否完成
     bool completed = false;
 };
@@ -61,11 +69,28 @@ struct EsFileGlobalOptions {
     // 但一阶段重构后也作为统一发送面的总体速率上限使用。
     // 单位：Mb/s，按 1 Mbps = 1024 * 1024 bit/s 换算。
     uint64_t http_pull_total_rate_mbps = 450;
+    // 是否为负载计算 CRC32C 并置 kEsFileFlagPayloadCrc32c。
+    // 有 SSE4.2/ARMv8 CRC 指令时开销远小于转义扫描，默认开启。
+    bool payload_crc32c = true;
+    // 新任务默认的 FEC 分组大小：每 N 个 FileChunk 追加一个异或校验包，0 表示关闭。
+    // 校验开销约 1/N，每组可恢复任意一个丢失或校验失败的 FileChunk；可按任务用 setTaskFecGroupSize 覆盖。
+    size_t fec_group_size = 0;
+    // FileChunk 负载压缩算法，默认不压缩；所选算法未编译进来时按不压缩处理。
+    // 逐分片压缩，收益不足的分片按原样发送并按指数退避暂停采样；HTTP 源按 Content-Type/Content-Encoding 跳过已压缩内容。
+    // 发送令牌与限速按压缩后字节计算，可压缩内容在同样码率下传得更快。
+    EsFileCompressCodec payload_compression = EsFileCompressCodec::None;
+    // 条带分发门限：设置了多路载体回调时，已知大小且不小于该值的任务按 seq 轮转分发到各路载体，0 表示所有已知大小的任务。
+    // 条带任务的包在接收端乱序到达，只适合按 data_offset 落盘的消费方（如 EsFileFerrySink）；其余任务固定走一路载体，保持顺序。
+    uint64_t stripe_min_file_bytes = 64 * 1024 * 1024;
 };
 
 class EsFileFerryPacker {
 public:
     static constexpr const char *kBootstrapTaskId = "__bootstrap__";
+    // FEC 分组大小上限
+    static constexpr size_t kMaxFecGroupSize = 64;
+    // 载体路数上限
+    static constexpr size_t kMaxStripeCount = 16;
     // 一阶段主调度面说明：
     // 1. 控制面优先推进：TaskStatus / FileInfo / FileEnd 独立于数据面公平轮转；
     // 2. 数据面统一等权：所有可调度任务进入同一公平轮转集合；
@@ -75,7 +100,13 @@ public:
     // 当队列达到上限时阻塞回调线程，让背压自然回传到 Packer/HTTP 拉取线程，
     // 避免下游无限缓存导致内存放大。
     using PacketCallback = std::function<void(const std::string &task_id, std::vector<uint8_t> &&packet, const EsFilePacketHeader &header)>;
+    // 零拷贝发包回调，运行在 Packer 调度线程。
+    // packet 取自内部缓冲池，内容与 PacketCallback 完全一致，回调返回后仍可继续持有，释放后回收复用；
+    // 可直接用 mediakit::FrameFromBuffer 包装成 Frame 送入媒体链路，无需再次拷贝。
+    using PacketBufferCallback = std::function<void(const std::string &task_id, const toolkit::Buffer::Ptr &packet, const EsFilePacketHeader &header)>;
     using HttpHeaders = HttpStreamFetcher::HttpHeaders;
+    // 字节区间 [begin, end)，end 为 0 表示到文件末尾
+    using ByteRange = std::pair<uint64_t, uint64_t>;
 
     EsFileFerryPacker();
     // 单例入口
@@ -100,8 +131,15 @@ public:
     // 批量设置全局保护参数。
     void setGlobalOptions(const EsFileGlobalOptions &opts);
 
-    // 设置发包回调
+    // 设置发包回调，会清除零拷贝发包回调
     void setPacketCallback(PacketCallback cb);
+    // 设置零拷贝发包回调，会清除 PacketCallback
+    void setPacketBufferCallback(PacketBufferCallback cb);
+    // 设置多路载体的零拷贝发包回调，每个回调对应一路载体流，最多 kMaxStripeCount 路，会清除单路发包回调；传空表示关闭。
+    // bootstrap 包发往每一路；条带任务的 FileChunk/FileParity 按 seq 轮转并跳过拥塞载体，其余包固定走按 task_id 选定的一路。
+    void setStripePacketCallbacks(std::vector<PacketBufferCallback> cbs);
+    // 单路载体拥塞时不再向该路分配 FileChunk，全部载体拥塞时等同 setDownstreamCongested(true)。
+    void setStripeCongested(size_t stripe, bool congested);
     // 下游消费拥塞时抑制普通 FileChunk 的 fetch/emit；控制面包仍继续推进。
     void setDownstreamCongested(bool congested);
     // 添加本地文件任务
@@ -111,6 +149,14 @@ public:
     bool addHttpTask(const std::string &task_id, const std::string &url, const std::string &method = "GET", const HttpHeaders &headers = {}, const std::string &body = "", const std::string &file_name = "");
     // 统一添加任务入口（自动识别本地/HTTP）
     bool addTask(const std::string &task_id, const std::string &source, const std::string &method = "GET", const HttpHeaders &headers = {}, const std::string &body = "", const std::string &file_name = "");
+    // 续传任务：从 start_offset 开始发送，FileInfo 携带 kEsFileFlagFileInfoResume，接收端保留已收区间。
+    // 本地文件按偏移 seek，HTTP 源以 Range 请求拉取；HTTP 源只支持 GET，其他方法返回 false。
+    bool addResumeTask(const std::string &task_id, const std::string &source, uint64_t start_offset, const std::string &method = "GET", const HttpHeaders &headers = {}, const std::string &body = "", const std::string &file_name = "");
+    // 补发任务：只发送 ranges 列出的区间（通常取自接收端 getTaskMissingRanges），区间会先排序合并。
+    // HTTP 源每个区间发起一次 Range 请求，只支持 GET，其他方法返回 false；ranges 为空时等同 addTask。
+    bool addRangeTask(const std::string &task_id, const std::string &source, const std::vector<ByteRange> &ranges, const std::string &method = "GET", const HttpHeaders &headers = {}, const std::string &body = "", const std::string &file_name = "");
+    // 设置任务的 FEC 分组大小，0 表示关闭，上限 kMaxFecGroupSize；从下一组开始生效，任务不存在时返回 false
+    bool setTaskFecGroupSize(const std::string &task_id, size_t group_size);
     // 移除单个任务
     void removeTask(const std::string &task_id);
     // 清空全部任务
@@ -170,18 +216,44 @@ private:
     using HttpChunkPool = toolkit::ResourcePool<HttpChunkBuffer>;
     using HttpChunkBufferPtr = HttpChunkPool::ValuePtr;
 
+    // 发包缓冲：零拷贝回调时取自缓冲池，否则为移交给 PacketCallback 的 vector
+    struct PacketBuffer {
+        toolkit::BufferRaw::Ptr pooled;
+        std::vector<uint8_t> bytes;
+
+        uint8_t *data() {
+            return pooled ? reinterpret_cast<uint8_t *>(pooled->data()) : bytes.data();
+        }
+        size_t size() const { return pooled ? pooled->size() : bytes.size(); }
+    };
+
     struct TaskSendState {
+        // 发送游标，即下一个 FileChunk 的 data_offset
         uint64_t sent_bytes = 0;
         uint32_t next_seq = 0;
         bool info_sent = false;
         bool end_sent = false;
+        // 续传/补发任务
+        bool resume = false;
+        // 当前发送区间的结束偏移，0 表示到文件末尾
+        uint64_t range_end = 0;
+        // 当前区间之后待发送的区间
+        std::deque<ByteRange> pending_ranges;
+        // FileChunk 线上负载字节数与压缩分片数
+        uint64_t wire_payload_bytes = 0;
+        uint64_t compressed_chunk_count = 0;
+        // 是否按条带分发，FileInfo 发出前确定
+        bool striped = false;
     };
 
     struct TaskHttpBufferState {
         uint64_t buffered_bytes = 0;
         size_t front_chunk_offset = 0;
         std::deque<HttpChunkBufferPtr> chunks;
-        std::shared_ptr<std::condition_variable> cv;
+        // 拉取因背压暂停的起始时间，用于慢等待日志
+        bool waiting = false;
+        bool waited_for_rate = false;
+        std::chrono::steady_clock::time_point wait_begin;
     };
 
     struct TokenBucket {
@@ -208,6 +280,11 @@ private:
         bool size_known = false;
         uint32_t status_code = 0;
         uint64_t received_bytes = 0;
+        // 本次拉取请求的区间 [fetch_begin, fetch_end)，fetch_end 为 0 表示到末尾
+        uint64_t fetch_begin = 0;
+        uint64_t fetch_end = 0;
+        // 下一个到达字节在源文件中的偏移；源站忽略 Range 返回 200 时据此跳过区间外数据
+        uint64_t stream_pos = 0;
         std::string error;
         std::string method;
         HttpHeaders request_headers;
@@ -216,6 +293,26 @@ private:
         TaskHttpBufferState buffer;
     };
 
+    // FEC 分组状态，仅发包线程读写成员表与异或块，group_size 可由其他线程修改
+    struct TaskFecState {
+        std::atomic<size_t> group_size{0};
+        // 当前组已发送的 FileChunk
+        std::vector<EsFileFecMember> members;
+        // 当前组负载的异或，长度为组内最长成员
+        std::vector<uint8_t> parity;
+    };
+
+    // 负载压缩状态，采样计数仅发包线程读写，content_skip 可由拉取线程设置
+    struct TaskCompressState {
+        EsFileCompressCodec codec = EsFileCompressCodec::None;
+        // 响应头表明内容已压缩或为媒体/归档类型时整任务跳过
+        std::atomic<bool> content_skip{false};
+        // 连续无收益的采样次数
+        uint32_t miss_streak = 0;
+        // 退避期内剩余不尝试压缩的分片数
+        uint32_t skip_chunks = 0;
+    };
+
     struct TaskSourceState {
         // 数据源路径（本地路径或 URL）
         std::string file_path;
@@ -225,8 +322,8 @@ private:
         uint64_t file_size = 0;
         // 是否为内存分片模式
         bool memory_mode = false;
-        // 内存模式下的完整数据
-        std::vector<uint8_t> memory_payload;
+        // 内存模式下的完整数据，发包线程在锁外组包时持有其引用
+        std::shared_ptr<const std::vector<uint8_t>> memory_payload;
         // 文件流句柄
         std::shared_ptr<std::ifstream> stream;
     };
@@ -246,6 +343,10 @@ private:
         TaskHttpRuntimeState http;
         // 任务级流控态
         TaskControlState control;
+        // FEC 分组态，未开启时为空
+        std::shared_ptr<TaskFecState> fec;
+        // 负载压缩态，未开启时为空
+        std::shared_ptr<TaskCompressState> compress;
     };
 
     struct TaskRegistryState {
@@ -260,18 +361,14 @@ private:
         uint64_t total_buffered_bytes = 0;
     };
 
-    struct HttpFetchThreadState {
-        HttpFetchThreadState(std::thread &&thread_in,
-                             std::shared_ptr<std::atomic_bool> done_in)
-            : thread(std::move(thread_in)), done(std::move(done_in)) {}
-        std::thread thread;
-        std::shared_ptr<std::atomic_bool> done;
-    };
-
     struct PacketRuntimeState {
         PacketCallback callback;
+        PacketBufferCallback buffer_callback;
         std::string last_error;
         bool downstream_congested = false;
+        // 多路载体回调与各路拥塞状态，两者等长；非空时取代单路回调
+        std::vector<PacketBufferCallback> stripe_callbacks;
+        std::vector<bool> stripe_congested;
         bool ts_started = false;
         std::chrono::steady_clock::time_point ts_start_time;
         uint32_t last_ts_ms = 0;
@@ -325,7 +422,17 @@ private:
     // 单任务 HTTP 默认缓冲上限统一收敛为单一值，不再按旧业务分类拆分。
     static constexpr uint64_t kDefaultUnifiedBufferedBytes =
         kDefaultMaxHttpBufferedBytesPerTask;
-
+    // 零拷贝发包缓冲池保留的空闲缓冲数。
+    // 作用：下游持有的包释放后回收复用，覆盖下游队列中同时在途的包数即可避免反复分配。
+    static constexpr size_t kDefaultPacketPoolSize = 64;
+
+    // 添加任务的统一实现，ranges 为空表示发送整个文件
+    bool addTaskWithRanges(const std::string &task_id, const std::string &source, const std::string &method, const HttpHeaders &headers, const std::string &body, const std::string &file_name, const std::vector<ByteRange> &ranges);
+    // 当前发送区间的结束偏移（已按文件大小截断）
+    static uint64_t sendRangeEnd(const TaskState &task);
+    // 当前区间发送完毕时切换到下一个区间（调用方需已持锁）。
+    // HTTP 源需等待当前拉取结束且缓冲排空，切换后重新排队拉取并返回 true
+    bool advanceSendRangeLocked(TaskState &task);
     // 获取本地文件大小
     static bool getFileSize(const std::string &file_path, uint64_t &size);
     // 选择输出文件名（优先显式传入）
@@ -333,7 +440,7 @@ private:
     // 组装协议头
     EsFilePacketHeader makePacketHeader(const TaskState &task, EsFilePacketType type, uint64_t data_offset, uint32_t payload_len, uint16_t flags, uint32_t seq, uint32_t timestamp_ms) const;
     // 输出 bootstrap NAL 包
-    void emitBootstrapPackets(const PacketCallback &cb) const;
+    void emitBootstrapPackets(bool zero_copy);
     // 生成相对毫秒时间戳
     uint32_t nextRelativeTimestampMs();
     // 启动发包线程（调用方需已持锁）
@@ -355,13 +462,44 @@ private:
     // 停止速率整形定时器（调用方需已持锁）
     void stopPaceTimerLocked();
 
-    // 组装完整协议包（含起始码 + 固定头 + 变长字段）
-    std::vector<uint8_t> buildPacket(const TaskState &task, EsFilePacketHeader &header, const std::vector<uint8_t> &payload) const;
-    std::vector<uint8_t> buildPacket(const TaskState &task, EsFilePacketHeader &header, size_t payload_len, size_t *payload_offset) const;
+    // 是否设置了任一发包回调（调用方需已持锁）
+    bool hasPacketCallbackLocked() const;
+    // 发包是否使用缓冲池（零拷贝或多路载体，调用方需已持锁）
+    bool isZeroCopyLocked() const;
+    // 数据面是否整体拥塞：下游拥塞或全部载体拥塞（调用方需已持锁）
+    bool isDataPlaneCongestedLocked() const;
+    // 任务当前是否有可写的载体：条带任务任一路未拥塞，其余任务所在载体未拥塞（调用方需已持锁）
+    bool hasWritableStripeLocked(const TaskState &task) const;
+    // 新任务是否按条带分发（调用方需已持锁）
+    bool shouldStripeTaskLocked(const TaskState &task) const;
+    // 为包选择载体，返回 stripe_callbacks 下标（调用方需已持锁且已设置多路载体）
+    size_t pickStripeLocked(const std::string &task_id, const EsFilePacketHeader &header) const;
+    // 发包回调变更后重置时间戳与 bootstrap 状态（调用方需已持锁）
+    void onPacketCallbackChangedLocked();
+    // 分配指定大小的发包缓冲
+    PacketBuffer makePacketBuffer(size_t size, bool zero_copy);
+    // 单次写出完整协议包：起始码 + 固定头 + 变长字段 + 负载，负载在写入时完成转义。
+    // payload 为可调用对象，按顺序向传入的函数提供一段或多段负载数据，共 payload_len 字节。
+    template <typename Payload>
+    PacketBuffer assemblePacket(const TaskState &task, EsFilePacketHeader &header, size_t payload_len, bool zero_copy, bool payload_crc32c, const Payload &payload);
+    // 按全局默认值初始化任务 FEC 状态（调用方需已持锁）
+    void initTaskFecLocked(TaskState &task) const;
+    // 按全局配置初始化任务压缩状态（调用方需已持锁）
+    void initTaskCompressLocked(TaskState &task) const;
+    // 记录 FileChunk 线上负载字节数与压缩分片数（调用方需已持锁）
+    static void recordChunkSentLocked(TaskState &task, const EsFilePacketHeader &header);
+    // FileChunk 组包：按任务压缩状态尝试压缩，有收益时发送压缩负载并置对应标记，否则同 assemblePacket
+    template <typename Payload>
+    PacketBuffer assembleChunkPacket(const TaskState &task, TaskCompressState *compress, EsFilePacketHeader &header, size_t payload_len, bool zero_copy, bool payload_crc32c, const Payload &payload);
+    // 将一个 FileChunk 负载累加到当前 FEC 组
+    template <typename Payload>
+    static void accumulateFecParity(TaskFecState &fec, uint64_t offset, size_t size, const Payload &payload);
+    // 输出当前 FEC 组的校验包并清空组，返回输出的包数
+    size_t emitFecParity(const TaskState &task, TaskFecState &fec, uint32_t seq, bool zero_copy, bool payload_crc32c);
     // tick 下的任务调度与发包主流程
     size_t processTickPackets(uint64_t total_payload_quota_bytes);
     // 向上游发出一个完整包
-    bool emitPacket(const std::string &task_id, std::vector<uint8_t> &&packet, const EsFilePacketHeader &header) const;
+    bool emitPacket(const std::string &task_id, PacketBuffer &&packet, const EsFilePacketHeader &header);
     // 更新最近一次错误信息
     void setLastError(const std::string &err);
     // 以下为一阶段真实主调度面：
@@ -402,9 +540,6 @@ private:
     static uint64_t peekTokenBucketBytes(TokenBucket &bucket);
     // 从令牌桶消费字节数
     static void consumeTokenBucketBytes(TokenBucket &bucket, uint64_t bytes);
-    // 估算至少获取指定令牌所需等待时间
-    static std::chrono::milliseconds estimateTokenWait(const TokenBucket &bucket,
-                                                       uint64_t min_bytes);
     // 清理任务 HTTP 缓冲并同步更新全局缓冲统计（调用方需已持锁）
     void clearTaskHttpBufferLocked(TaskState &task);
     // 清理待启动 HTTP 拉取队列中的指定任务（调用方需已持锁）
@@ -415,8 +550,9 @@ private:
     std::vector<std::pair<std::string, uint64_t>> collectHttpFetchLaunchesLocked();
     // 启动单个 HTTP 拉取任务
     void launchHttpFetchTask(const std::string &task_id, uint64_t generation);
-    // 回收已结束的 HTTP 拉取线程（调用方需已持锁）
-    void reapCompletedHttpFetchThreadsLocked(std::vector<std::thread> &join_threads);
+    // 在拉取引擎线程写入 HTTP 数据，不阻塞；返回接收的字节数，小于 0 时中止拉取
+    int64_t bufferHttpChunk(const std::string &task_id, uint64_t generation,
+                            const uint8_t *data, size_t size);
 
 private:
     // 全局互斥锁
@@ -424,8 +560,17 @@ private:
     // 全局业务配置
     EsFileGlobalOptions _global_options;
     HttpChunkPool _http_chunk_pool;
+    // 零拷贝发包缓冲池
+    toolkit::ResourcePool<toolkit::BufferRaw> _packet_pool;
+    // 本地文件读取的复用缓冲，仅发包线程使用
+    std::vector<uint8_t> _file_read_buffer;
+    // 负载压缩器及输入拼接、输出缓冲，仅发包线程使用
+    EsFileCompressor _compressor;
+    std::vector<uint8_t> _compress_input_buffer;
+    std::vector<uint8_t> _compress_output_buffer;
     TaskRegistryState _task_registry;
     HttpFetchRuntimeState _http_runtime;
     PacketRuntimeState _packet_runtime;
-    std::vector<std::unique_ptr<HttpFetchThreadState>> _http_fetch_threads;
+    // 驱动全部 HTTP 拉取的 curl multi 引擎
+    HttpFetchEngine _http_fetch_engine;
 };
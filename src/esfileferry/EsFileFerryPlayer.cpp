@@ -1,7 +1,13 @@
 ﻿#include "EsFileFerryPlayer.h"
+#include "EsFileAnnexBEscape.h"
+#include "EsFileCompress.h"
+#include "EsFileCrc32c.h"
+#include "EsFileFec.h"
+#include "EsFileFerrySink.h"
 
 #include "Util/base64.h"
 #include "Util/logger.h"
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 #include <mutex>
@@ -11,6 +17,8 @@ using namespace toolkit;
 
 constexpr size_t EsFileFerryUnPacker::kInitialBufferReserveBytes;
 constexpr size_t EsFileFerryUnPacker::kCompactThresholdBytes;
+constexpr size_t EsFileFerryUnPacker::kTaskShardCount;
+constexpr size_t EsFileFerryUnPacker::kMaxFecCacheBytes;
 
 namespace {
 size_t scanPacketStart(const uint8_t *data, size_t size, uint32_t packet_magic,
@@ -30,7 +38,8 @@ size_t scanPacketStart(const uint8_t *data, size_t size, uint32_t packet_magic,
   return start;
 }
 
-enum class PacketDecodeStatus { Success, NeedMoreData, Invalid };
+// ChecksumMismatch/DecompressFailed 时 consumed 仍为整包长度，调用方跳过该包即可
+enum class PacketDecodeStatus { Success, NeedMoreData, Invalid, ChecksumMismatch, DecompressFailed };
 
 const char *packetDecodeStatusName(PacketDecodeStatus status) {
   switch (status) {
@@ -40,6 +49,10 @@ const char *packetDecodeStatusName(PacketDecodeStatus status) {
     return "need_more_data";
   case PacketDecodeStatus::Invalid:
     return "invalid";
+  case PacketDecodeStatus::ChecksumMismatch:
+    return "checksum_mismatch";
+  case PacketDecodeStatus::DecompressFailed:
+    return "decompress_failed";
   }
   return "unknown";
 }
@@ -84,17 +97,42 @@ const char *unpackErrorTypeName(EsFileUnpackErrorType type) {
     return "buffered_packet_invalid";
   case EsFileUnpackErrorType::MissingTask:
     return "missing_task";
+  case EsFileUnpackErrorType::PayloadChecksumMismatch:
+    return "payload_checksum_mismatch";
+  case EsFileUnpackErrorType::SinkWriteFailed:
+    return "sink_write_failed";
+  case EsFileUnpackErrorType::PayloadDecompressFailed:
+    return "payload_decompress_failed";
   case EsFileUnpackErrorType::Unknown:
   default:
     return "unknown";
   }
 }
 
+// FileChunk 负载视图：未转义时指向输入数据本身，转义时指向线程内复用的反转义缓冲
+struct PacketPayloadView {
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+};
+
+std::vector<uint8_t> &unescapeScratch() {
+  static thread_local std::vector<uint8_t> s_scratch;
+  return s_scratch;
+}
+
+std::vector<uint8_t> &decompressScratch() {
+  static thread_local std::vector<uint8_t> s_scratch;
+  return s_scratch;
+}
+
+// chunk_view 非空时 FileChunk 负载不拷贝到 packet.payload，而是通过视图返回，
+// 视图仅在 data 与当前线程下一次解码前有效
 PacketDecodeStatus decodePacketAt(const uint8_t *data, size_t size,
                                   uint32_t packet_magic,
                                   size_t fixed_header_size,
                                   size_t max_packet_size, EsFilePacket &packet,
-                                  size_t &consumed) {
+                                  size_t &consumed,
+                                  PacketPayloadView *chunk_view = nullptr) {
   consumed = 0;
   packet = EsFilePacket{};
   if (!data || size < fixed_header_size + kEsFileCarrierShortPrefixSize) {
@@ -147,30 +185,59 @@ PacketDecodeStatus decodePacketAt(const uint8_t *data, size_t size,
     pos += packet.header.file_name_len;
   }
   if (packet.header.payload_len > 0) {
-    packet.payload.resize(packet.header.payload_len);
     const bool payload_escaped =
         (packet.header.flags & kEsFileFlagPayloadEscaped) != 0;
+    const bool use_view =
+        chunk_view && packet.header.type == EsFilePacketType::FileChunk;
+    const uint8_t *payload_data = nullptr;
     if (!payload_escaped) {
-      std::memcpy(packet.payload.data(), p + pos, packet.header.payload_len);
+      if (use_view) {
+        payload_data = p + pos;
+      } else {
+        packet.payload.resize(packet.header.payload_len);
+        std::memcpy(packet.payload.data(), p + pos, packet.header.payload_len);
+        payload_data = packet.payload.data();
+      }
       consumed = static_cast<size_t>(packet.header.total_len + prefix_size);
     } else {
-      const auto encoded_limit = size - prefix_size;
-      auto encoded_pos = pos;
-      size_t raw_written = 0;
-      while (raw_written < packet.header.payload_len) {
-        if (encoded_pos >= encoded_limit) {
-          return PacketDecodeStatus::NeedMoreData;
-        }
-        if (encoded_pos >= 2 &&
-            p[encoded_pos - 2] == 0x00 &&
-            p[encoded_pos - 1] == 0x00 &&
-            p[encoded_pos] == 0x03) {
-          ++encoded_pos;
-          continue;
-        }
-        packet.payload[raw_written++] = p[encoded_pos++];
+      auto &target = use_view ? unescapeScratch() : packet.payload;
+      target.resize(packet.header.payload_len);
+      size_t encoded_len = 0;
+      if (!UnescapeEsFileAnnexB(p + pos, size - prefix_size - pos,
+                                target.data(), packet.header.payload_len,
+                                encoded_len)) {
+        return PacketDecodeStatus::NeedMoreData;
+      }
+      payload_data = target.data();
+      consumed = prefix_size + pos + encoded_len;
+    }
+    // 校验覆盖反转义后、base64 解码前的负载，与发送端一致
+    if ((packet.header.flags & kEsFileFlagPayloadCrc32c) != 0 &&
+        UpdateEsFileCrc32c(0, payload_data, packet.header.payload_len) !=
+            packet.header.crc32) {
+      return PacketDecodeStatus::ChecksumMismatch;
+    }
+    // 压缩负载在校验之后解压，payload_len 改为原始长度，后续区间/FEC/sink 只看原始负载
+    const auto codec = EsFileCompressCodecFromFlags(packet.header.flags);
+    if (codec != EsFileCompressCodec::None) {
+      std::vector<uint8_t> raw;
+      auto &target = use_view ? decompressScratch() : raw;
+      if (!DecompressEsFilePayload(codec, payload_data, packet.header.payload_len,
+                                   max_packet_size, target)) {
+        return PacketDecodeStatus::DecompressFailed;
       }
-      consumed = prefix_size + encoded_pos;
+      packet.header.payload_len = static_cast<uint32_t>(target.size());
+      if (use_view) {
+        payload_data = target.data();
+      } else {
+        packet.payload = std::move(raw);
+        payload_data = packet.payload.data();
+      }
+    }
+    if (use_view) {
+      chunk_view->data = payload_data;
+      chunk_view->size = packet.header.payload_len;
+      return PacketDecodeStatus::Success;
     }
     const bool file_info_base64 =
         packet.header.type == EsFilePacketType::FileInfo &&
@@ -201,54 +268,109 @@ EsFileFerryUnPacker &EsFileFerryUnPacker::Instance() {
   return ref;
 }
 
+EsFileFerryUnPacker::Ptr EsFileFerryUnPacker::create() {
+  return Ptr(new EsFileFerryUnPacker());
+}
+
+std::shared_ptr<EsFileFerryUnPacker::TaskRegistry>
+EsFileFerryUnPacker::defaultRegistry() {
+  static std::shared_ptr<TaskRegistry> registry = std::make_shared<TaskRegistry>();
+  return registry;
+}
+
+EsFileFerryUnPacker::TaskShard &
+EsFileFerryUnPacker::getShard(const std::string &task_id) const {
+  return _registry->shards[std::hash<std::string>()(task_id) % kTaskShardCount];
+}
+
 void EsFileFerryUnPacker::setTaskCallback(const std::string &task_id,
                                           OnTaskData cb) {
-  std::lock_guard<std::mutex> lock(_mtx);
   if (task_id.empty()) {
     return;
   }
+  auto &shard = getShard(task_id);
+  std::lock_guard<std::mutex> lock(shard.mtx);
   DebugL << "set task callback, task_id:" << task_id << " cb:" << (void *)&cb << " this:" << this;
   if (cb) {
-    _task_callbacks[task_id] = std::move(cb);
-    if (_task_states.find(task_id) == _task_states.end()) {
-      _task_states.emplace(task_id, TaskRuntimeState{});
+    shard.callbacks[task_id] = std::move(cb);
+    if (shard.states.find(task_id) == shard.states.end()) {
+      shard.states.emplace(task_id, TaskRuntimeState{});
     }
   } else {
-    _task_callbacks.erase(task_id);
-    _task_states.erase(task_id);
+    shard.callbacks.erase(task_id);
+    eraseTaskLocked(shard, task_id);
+  }
+}
+
+bool EsFileFerryUnPacker::setTaskSink(const std::string &task_id,
+                                      std::shared_ptr<EsFileFerrySink> sink) {
+  auto &shard = getShard(task_id);
+  std::lock_guard<std::mutex> lock(shard.mtx);
+  auto it = shard.states.find(task_id);
+  if (it == shard.states.end()) {
+    return false;
   }
+  auto &state = it->second;
+  if (!state.sink && sink) {
+    ++_registry->sink_count;
+  } else if (state.sink && !sink) {
+    --_registry->sink_count;
+  }
+  state.sink = std::move(sink);
+  return true;
 }
 
 void EsFileFerryUnPacker::removeTask(const std::string &task_id) {
-  std::lock_guard<std::mutex> lock(_mtx);
-  _task_callbacks.erase(task_id);
-  _task_states.erase(task_id);
+  auto &shard = getShard(task_id);
+  std::lock_guard<std::mutex> lock(shard.mtx);
+  shard.callbacks.erase(task_id);
+  eraseTaskLocked(shard, task_id);
 }
 
 void EsFileFerryUnPacker::clearTasks() {
-  std::lock_guard<std::mutex> lock(_mtx);
-  _task_callbacks.clear();
-  _task_states.clear();
+  for (auto &shard : _registry->shards) {
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    for (auto &it : shard.states) {
+      if (it.second.sink) {
+        --_registry->sink_count;
+      }
+    }
+    shard.callbacks.clear();
+    shard.states.clear();
+  }
+}
+
+void EsFileFerryUnPacker::eraseTaskLocked(TaskShard &shard,
+                                          const std::string &task_id) {
+  auto it = shard.states.find(task_id);
+  if (it == shard.states.end()) {
+    return;
+  }
+  if (it->second.sink) {
+    --_registry->sink_count;
+  }
+  shard.states.erase(it);
 }
 
 std::vector<std::string> EsFileFerryUnPacker::getTaskIds() const {
-  std::lock_guard<std::mutex> lock(_mtx);
   std::vector<std::string> ids;
-  ids.reserve(_task_callbacks.size());
-  for (auto &it : _task_callbacks) {
-    ids.emplace_back(it.first);
+  for (auto &shard : _registry->shards) {
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    for (auto &it : shard.callbacks) {
+      ids.emplace_back(it.first);
+    }
   }
   return ids;
 }
 
 std::string EsFileFerryUnPacker::getLastError() const {
-  std::lock_guard<std::mutex> lock(_mtx);
-  return _last_error;
+  std::lock_guard<std::mutex> lock(_registry->error_mtx);
+  return _registry->last_error;
 }
 
 void EsFileFerryUnPacker::setOnError(OnError cb) {
-  std::lock_guard<std::mutex> lock(_mtx);
-  _on_error = std::move(cb);
+  std::lock_guard<std::mutex> lock(_registry->error_mtx);
+  _registry->on_error = std::move(cb);
 }
 
 void EsFileFerryUnPacker::setOnError(LegacyOnError cb) {
@@ -363,8 +485,20 @@ bool EsFileFerryUnPacker::inputFrame(const uint8_t *data, size_t size) {
   if (size >= kEsFileFixedHeaderSize + kEsFileCarrierShortPrefixSize) {
     EsFilePacket packet;
     size_t consumed = 0;
-    if (parseOnePacketFromRaw(data, size, packet, consumed) && consumed == size) {
-      dispatchPacket(std::move(packet), data, size);
+    bool decompress_failed = false;
+    // 负载视图指向 data 本身，写盘在 parseOnePacketFromRaw 内完成
+    if (parseOnePacketFromRaw(data, size, packet, consumed, decompress_failed)) {
+      if (consumed == size) {
+        dispatchPacket(std::move(packet), data, size);
+        return true;
+      }
+    } else if (consumed == size) {
+      // 整帧即一个校验或解压失败的包，直接丢弃
+      if (decompress_failed) {
+        onPayloadDecompressFailed(packet);
+      } else {
+        onPayloadChecksumMismatch(packet);
+      }
       return true;
     }
   }
@@ -377,24 +511,33 @@ bool EsFileFerryUnPacker::inputFrame(const uint8_t *data, size_t size) {
   return true;
 }
 
-EsFileFerryUnPacker::EsFileFerryUnPacker() {
+EsFileFerryUnPacker::EsFileFerryUnPacker() : _registry(defaultRegistry()) {
   _buffer.reserve(kInitialBufferReserveBytes);
 }
 
 void EsFileFerryUnPacker::parseBuffer(const uint8_t *data, size_t size) {
   while (true) {
     EsFilePacket packet;
-    if (!parseOnePacket(packet)) {
+    bool skipped = false;
+    if (!parseOnePacket(packet, skipped)) {
+      if (skipped) {
+        continue;
+      }
       break;
     }
     dispatchPacket(std::move(packet), data, size);
   }
 }
 
-bool EsFileFerryUnPacker::parseOnePacket(EsFilePacket &packet) {
+bool EsFileFerryUnPacker::parseOnePacket(EsFilePacket &packet, bool &skipped) {
+  skipped = false;
   EsFileUnpackErrorEvent pending_error;
   bool has_pending_error = false;
   bool parsed = false;
+  bool checksum_mismatch = false;
+  bool decompress_failed = false;
+  bool sink_write_failed = false;
+  std::string sink_error;
   {
     std::lock_guard<std::mutex> lock(_mtx);
     const auto available = _buffer.size() - _buffer_start;
@@ -423,14 +566,30 @@ bool EsFileFerryUnPacker::parseOnePacket(EsFilePacket &packet) {
 
     size_t consumed = 0;
     const auto packet_available = _buffer.size() - _buffer_start;
+    PacketPayloadView chunk_view;
+    const bool want_view = _registry->sink_count.load() > 0;
     const auto status =
         decodePacketAt(_buffer.data() + _buffer_start, packet_available,
                        kEsFilePacketMagic, kEsFileFixedHeaderSize,
-                       kMaxPacketSize, packet, consumed);
+                       kMaxPacketSize, packet, consumed,
+                       want_view ? &chunk_view : nullptr);
     if (status == PacketDecodeStatus::Success) {
+      // 视图指向解析缓冲，必须在持锁且消费前写盘
+      if (chunk_view.data &&
+          !routeChunkPayload(packet, chunk_view.data, chunk_view.size,
+                             sink_error)) {
+        sink_write_failed = true;
+      }
       _buffer_start += consumed;
       resetBufferIfFullyConsumedLocked();
       parsed = true;
+    } else if (status == PacketDecodeStatus::ChecksumMismatch ||
+               status == PacketDecodeStatus::DecompressFailed) {
+      _buffer_start += consumed;
+      resetBufferIfFullyConsumedLocked();
+      checksum_mismatch = status == PacketDecodeStatus::ChecksumMismatch;
+      decompress_failed = status == PacketDecodeStatus::DecompressFailed;
+      skipped = true;
     } else {
       if (status == PacketDecodeStatus::Invalid) {
         pending_error.type = EsFileUnpackErrorType::BufferedPacketInvalid;
@@ -468,6 +627,15 @@ bool EsFileFerryUnPacker::parseOnePacket(EsFilePacket &packet) {
       }
     }
   }
+  if (checksum_mismatch) {
+    onPayloadChecksumMismatch(packet);
+  }
+  if (decompress_failed) {
+    onPayloadDecompressFailed(packet);
+  }
+  if (sink_write_failed) {
+    onSinkWriteFailed(packet, sink_error);
+  }
   if (has_pending_error) {
     emitError(std::move(pending_error));
   }
@@ -477,8 +645,10 @@ bool EsFileFerryUnPacker::parseOnePacket(EsFilePacket &packet) {
 bool EsFileFerryUnPacker::parseOnePacketFromRaw(const uint8_t *data,
                                                 size_t size,
                                                 EsFilePacket &packet,
-                                                size_t &consumed) {
+                                                size_t &consumed,
+                                                bool &decompress_failed) {
   consumed = 0;
+  decompress_failed = false;
   if (!data || size < kEsFileFixedHeaderSize + kEsFileCarrierShortPrefixSize) {
       ErrorL << "frame buf size too small,size:" << size << " hex:" << hexmem(data, size);
     return false;
@@ -492,10 +662,19 @@ bool EsFileFerryUnPacker::parseOnePacketFromRaw(const uint8_t *data,
   }
 
   size_t local_consumed = 0;
+  PacketPayloadView chunk_view;
+  const bool want_view = _registry->sink_count.load() > 0;
   const auto status =
       decodePacketAt(data + start, size - start, kEsFilePacketMagic,
                      kEsFileFixedHeaderSize, kMaxPacketSize, packet,
-                     local_consumed);
+                     local_consumed, want_view ? &chunk_view : nullptr);
+  if (status == PacketDecodeStatus::ChecksumMismatch ||
+      status == PacketDecodeStatus::DecompressFailed) {
+    // 交由调用方决定丢弃整帧或回退到缓冲解析，避免重复计数
+    consumed = start + local_consumed;
+    decompress_failed = status == PacketDecodeStatus::DecompressFailed;
+    return false;
+  }
   if (status != PacketDecodeStatus::Success) {
       ErrorL << "frame invalid,size:" << size << " hex:" << hexmem(data, 100);
 
@@ -534,23 +713,47 @@ bool EsFileFerryUnPacker::parseOnePacketFromRaw(const uint8_t *data,
       //        << " hex:" << hexmem(data, 100);
   }
   consumed = start + local_consumed;
+  if (chunk_view.data && consumed != size) {
+    // 整帧不是单个完整包时调用方会回退到缓冲解析，此处不能提前写盘
+    return true;
+  }
+  std::string sink_error;
+  if (chunk_view.data &&
+      !routeChunkPayload(packet, chunk_view.data, chunk_view.size,
+                         sink_error)) {
+    onSinkWriteFailed(packet, sink_error);
+  }
   return true;
 }
 
-void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data, size_t size) {
+void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data, size_t size,
+                                         bool recovered) {
   OnTaskData on_task_data;
-  TaskRuntimeState state_snapshot;
+  // 只拷贝回调需要的字段，避免复制区间表
+  uint64_t snapshot_file_size = 0;
+  uint64_t snapshot_received_size = 0;
+  bool snapshot_completed = false;
   bool has_state = false;
   const bool is_control_packet = packet.task_id == kBootstrapTaskId;
   EsFileUnpackErrorEvent pending_error;
   bool has_pending_error = false;
+  std::shared_ptr<EsFileFerrySink> sink;
+  EsFilePacket recovered_packet;
+  bool has_recovered = false;
+  const bool striped = (packet.header.flags & kEsFileFlagStriped) != 0;
+  bool info_keep_progress = false;
+  bool end_deferred = false;
+  EsFilePacket deferred_end;
+  bool has_deferred_end = false;
+  bool end_incomplete = false;
   {
-    std::lock_guard<std::mutex> lock(_mtx);
-    auto it = _task_callbacks.find(packet.task_id);
-    if (it == _task_callbacks.end()) {
+    auto &shard = getShard(packet.task_id);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.callbacks.find(packet.task_id);
+    if (it == shard.callbacks.end()) {
       size_t miss_count = 0;
         if (!toolkit::start_with(packet.task_id, "play_channel_")) {
-            ErrorL << "task id:" << packet.task_id << " unnormal" << ",total len:" << packet.header.total_len << " payload len:" << packet.header.payload_len << " packet len:" << packet.payload.size() << " hex:" << toolkit::hexmem(data, 10);
+            ErrorL << "task id:" << packet.task_id << " unnormal" << ",total len:" << packet.header.total_len << " payload len:" << packet.header.payload_len << " packet len:" << packet.payload.size() << " hex:" << toolkit::hexmem(data, std::min<size_t>(size, 10));
         }
       if (shouldLogMissingTask(packet.task_id, miss_count)) {
         pending_error.type = EsFileUnpackErrorType::MissingTask;
@@ -578,19 +781,43 @@ void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data
                << " payload_len:" << packet.header.payload_len
                << " file_size:" << packet.header.file_size
                << " flags:" << packet.header.flags
-               << " callback_count:" << _task_callbacks.size()
+               << " shard_callback_count:" << shard.callbacks.size()
                << " this:" << this;
       }
       on_task_data = it->second;
       if (!is_control_packet) {
-        auto &state = _task_states[packet.task_id];
-        state.matched_packet_count++;
-        state.matched_bytes += packet.header.payload_len;
+        auto &state = shard.states[packet.task_id];
+        // 还原出的 FileChunk 与补发的暂存 FileEnd 不是线上新到的包，不计入匹配与序号统计
+        if (!recovered) {
+          state.matched_packet_count++;
+          state.matched_bytes += packet.header.payload_len;
+        }
+        if ((packet.header.flags & kEsFileFlagPayloadCrc32c) != 0) {
+          state.crc_checked_count++;
+        }
+        if (EsFileCompressCodecFromFlags(packet.header.flags) !=
+            EsFileCompressCodec::None) {
+          state.decompressed_count++;
+        }
         if (packet.header.file_size > 0) {
           state.file_size = packet.header.file_size;
         }
         if (packet.header.type == EsFilePacketType::FileInfo) {
-          state.received_size = 0;
+          // 续传时发送端只补发缺失区间，保留已接收进度；
+          // 条带任务的 FileInfo 晚于其他载体上的分片到达时同样保留
+          info_keep_progress =
+              (packet.header.flags & kEsFileFlagFileInfoResume) != 0 ||
+              (striped && !state.info_seen && state.has_seq);
+          if (!info_keep_progress) {
+            state.received_size = 0;
+            state.received_ranges.clear();
+            state.fec_cache.clear();
+            state.fec_cache_bytes = 0;
+            state.end_pending = false;
+            state.pending_end = EsFilePacket();
+            state.pending_parities.clear();
+          }
+          state.info_seen = true;
           state.completed = false;
           state.has_seq = false;
         } else if (packet.header.type == EsFilePacketType::FileChunk) {
@@ -599,6 +826,42 @@ void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data
           if (current > state.received_size) {
             state.received_size = current;
           }
+          state.received_ranges.add(packet.header.data_offset, current);
+          if ((packet.header.flags & kEsFileFlagFecProtected) != 0 &&
+              !packet.payload.empty()) {
+            cacheFecChunkLocked(state, packet.header.data_offset,
+                                packet.payload.data(), packet.payload.size());
+          }
+          if (!state.pending_parities.empty()) {
+            releaseReceivedParitiesLocked(state);
+          }
+          if (state.end_pending && state.file_size > 0 &&
+              state.received_ranges.covers(0, state.file_size)) {
+            deferred_end = std::move(state.pending_end);
+            state.pending_end = EsFilePacket();
+            state.end_pending = false;
+            has_deferred_end = true;
+          }
+        } else if (packet.header.type == EsFilePacketType::FileParity) {
+          // 条带任务的同组分片可能仍在其他载体上，线上到达的 FileParity 先暂存；超时补发的按丢失处理
+          has_recovered = recoverFecChunkLocked(state, packet, recovered_packet,
+                                                striped && !recovered);
+        } else if (packet.header.type == EsFilePacketType::FileEnd &&
+                   striped && state.file_size > 0 &&
+                   !state.received_ranges.covers(0, state.file_size)) {
+          if (!recovered) {
+            // 其他载体上的分片尚未到齐，FileEnd 暂存到区间收齐或等待超时后再分发
+            if (!state.end_pending) {
+              state.end_pending_since = std::chrono::steady_clock::now();
+            }
+            state.pending_end = packet;
+            state.end_pending = true;
+            end_deferred = true;
+          } else {
+            // 等待超时仍未收齐（分片丢失且 FEC 无法还原），按未完成分发，缺失区间留给上层补发
+            state.completed = false;
+            end_incomplete = true;
+          }
         } else if (packet.header.type == EsFilePacketType::FileEnd) {
           const auto current =
               packet.header.data_offset + packet.header.payload_len;
@@ -610,16 +873,23 @@ void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data
           }
           state.completed = true;
         }
-        if (state.has_seq) {
-          if (packet.header.seq == state.last_seq) {
-            state.duplicate_seq_count++;
-          } else if (packet.header.seq < state.last_seq) {
-            state.out_of_order_seq_count++;
+        if (!recovered) {
+          if (state.has_seq) {
+            if (packet.header.seq == state.last_seq) {
+              state.duplicate_seq_count++;
+            } else if (packet.header.seq < state.last_seq) {
+              state.out_of_order_seq_count++;
+            }
           }
+          state.last_seq = packet.header.seq;
+          state.has_seq = true;
         }
-        state.last_seq = packet.header.seq;
-        state.has_seq = true;
-        state_snapshot = state;
+        sink = state.sink;
+        snapshot_file_size = state.file_size;
+        snapshot_received_size = end_incomplete
+                                     ? state.received_ranges.coveredBytes()
+                                     : state.received_size;
+        snapshot_completed = state.completed;
         has_state = true;
       }
     }
@@ -628,8 +898,46 @@ void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data
     emitError(std::move(pending_error));
     return;
   }
+  if (end_deferred) {
+    return;
+  }
+  // FileParity 只在接收侧消费，还原出的 FileChunk 按普通分片继续分发
+  if (packet.header.type == EsFilePacketType::FileParity) {
+    if (has_recovered) {
+      dispatchPacket(std::move(recovered_packet), data, size, true);
+    }
+    return;
+  }
+
+  if (sink) {
+    switch (packet.header.type) {
+    case EsFilePacketType::FileInfo:
+      if (!sink->onFileInfo(packet.header.file_size, info_keep_progress)) {
+        onSinkWriteFailed(packet, sink->getLastError());
+      }
+      break;
+    case EsFilePacketType::FileChunk:
+      // sink 在解码后才绑定时负载仍在 packet.payload 中
+      if (!packet.payload.empty()) {
+        if (!sink->writeAt(packet.header.data_offset, packet.payload.data(),
+                           packet.payload.size())) {
+          onSinkWriteFailed(packet, sink->getLastError());
+        }
+        packet.payload.clear();
+      }
+      break;
+    case EsFilePacketType::FileEnd:
+      sink->onFileEnd(packet.header.file_size);
+      break;
+    default:
+      break;
+    }
+  }
 
   if (!on_task_data) {
+    if (has_deferred_end) {
+      dispatchPacket(std::move(deferred_end), data, size, true);
+    }
     return;
   }
   EsTaskDataEvent event;
@@ -638,13 +946,13 @@ void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data
   event.file_name = packet.file_name;
   event.file_size = packet.header.file_size > 0
                         ? packet.header.file_size
-                        : (has_state ? state_snapshot.file_size : 0);
+                        : (has_state ? snapshot_file_size : 0);
   event.offset = packet.header.data_offset;
   event.seq = packet.header.seq;
   event.flags = packet.header.flags;
   if (has_state) {
-    event.received_size = state_snapshot.received_size;
-    event.completed = state_snapshot.completed;
+    event.received_size = snapshot_received_size;
+    event.completed = snapshot_completed;
   } else {
     event.received_size = packet.header.data_offset + packet.header.payload_len;
     event.completed = packet.header.type == EsFilePacketType::FileEnd;
@@ -674,29 +982,368 @@ void EsFileFerryUnPacker::dispatchPacket(EsFilePacket packet,const uint8_t *data
     event.status = "file_chunk";
     break;
   case EsFilePacketType::FileEnd:
-    event.status = "file_end";
+    event.status = end_incomplete ? "file_end_incomplete" : "file_end";
     break;
   default:
     event.status = "unknown";
     break;
   }
   on_task_data(event);
+  // 补齐区间的分片已分发，再分发暂存的 FileEnd，保证完成事件在最后
+  if (has_deferred_end) {
+    dispatchPacket(std::move(deferred_end), data, size, true);
+  }
+}
+
+void EsFileFerryUnPacker::onPayloadChecksumMismatch(const EsFilePacket &packet) {
+  {
+    auto &shard = getShard(packet.task_id);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.states.find(packet.task_id);
+    if (it != shard.states.end()) {
+      it->second.crc_checked_count++;
+      it->second.crc_error_count++;
+    }
+  }
+  EsFileUnpackErrorEvent event;
+  event.type = EsFileUnpackErrorType::PayloadChecksumMismatch;
+  event.message =
+      StrPrinter << "payload checksum mismatch, task_id:" << packet.task_id
+                 << " packet_type:"
+                 << EsFilePacketTypeToString(packet.header.type)
+                 << " seq:" << packet.header.seq
+                 << " offset:" << packet.header.data_offset
+                 << " payload_len:" << packet.header.payload_len;
+  event.task_id = packet.task_id;
+  event.packet_type = packet.header.type;
+  event.seq = packet.header.seq;
+  event.payload_len = packet.header.payload_len;
+  event.file_size = packet.header.file_size;
+  event.frame_size = packet.payload.size();
+  static std::atomic<size_t> s_checksum_log_count{0};
+  size_t log_count = 0;
+  if (shouldLogSampled(s_checksum_log_count, 200, log_count)) {
+    WarnL << event.message << " sample_count:" << log_count;
+  }
+  emitError(std::move(event));
+}
+
+void EsFileFerryUnPacker::onPayloadDecompressFailed(const EsFilePacket &packet) {
+  const auto codec = EsFileCompressCodecFromFlags(packet.header.flags);
+  {
+    auto &shard = getShard(packet.task_id);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.states.find(packet.task_id);
+    if (it != shard.states.end()) {
+      it->second.decompress_error_count++;
+    }
+  }
+  EsFileUnpackErrorEvent event;
+  event.type = EsFileUnpackErrorType::PayloadDecompressFailed;
+  event.message =
+      StrPrinter << "payload decompress failed, task_id:" << packet.task_id
+                 << " packet_type:"
+                 << EsFilePacketTypeToString(packet.header.type)
+                 << " seq:" << packet.header.seq
+                 << " offset:" << packet.header.data_offset
+                 << " payload_len:" << packet.header.payload_len
+                 << " codec:" << EsFileCompressCodecName(codec)
+                 << " codec_available:" << IsEsFileCompressCodecAvailable(codec);
+  event.task_id = packet.task_id;
+  event.packet_type = packet.header.type;
+  event.seq = packet.header.seq;
+  event.payload_len = packet.header.payload_len;
+  event.file_size = packet.header.file_size;
+  static std::atomic<size_t> s_decompress_log_count{0};
+  size_t log_count = 0;
+  if (shouldLogSampled(s_decompress_log_count, 200, log_count)) {
+    WarnL << event.message << " sample_count:" << log_count;
+  }
+  emitError(std::move(event));
+}
+
+bool EsFileFerryUnPacker::routeChunkPayload(EsFilePacket &packet,
+                                           const uint8_t *data, size_t size,
+                                           std::string &err) {
+  std::shared_ptr<EsFileFerrySink> sink;
+  {
+    auto &shard = getShard(packet.task_id);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.states.find(packet.task_id);
+    if (it != shard.states.end()) {
+      sink = it->second.sink;
+      // 直写路径不保留负载，受保护分片需在此留一份供 FileParity 还原
+      if (sink && (packet.header.flags & kEsFileFlagFecProtected) != 0) {
+        cacheFecChunkLocked(it->second, packet.header.data_offset, data, size);
+      }
+    }
+  }
+  if (!sink) {
+    packet.payload.assign(data, data + size);
+    return true;
+  }
+  if (!sink->writeAt(packet.header.data_offset, data, size)) {
+    err = sink->getLastError();
+    return false;
+  }
+  return true;
+}
+
+void EsFileFerryUnPacker::onSinkWriteFailed(const EsFilePacket &packet,
+                                            const std::string &err) {
+  EsFileUnpackErrorEvent event;
+  event.type = EsFileUnpackErrorType::SinkWriteFailed;
+  event.message =
+      StrPrinter << "sink write failed, task_id:" << packet.task_id
+                 << " packet_type:"
+                 << EsFilePacketTypeToString(packet.header.type)
+                 << " seq:" << packet.header.seq
+                 << " offset:" << packet.header.data_offset
+                 << " payload_len:" << packet.header.payload_len
+                 << " err:" << err;
+  event.task_id = packet.task_id;
+  event.packet_type = packet.header.type;
+  event.seq = packet.header.seq;
+  event.payload_len = packet.header.payload_len;
+  event.file_size = packet.header.file_size;
+  static std::atomic<size_t> s_sink_log_count{0};
+  size_t log_count = 0;
+  if (shouldLogSampled(s_sink_log_count, 200, log_count)) {
+    WarnL << event.message << " sample_count:" << log_count;
+  }
+  emitError(std::move(event));
+}
+
+void EsFileFerryUnPacker::cacheFecChunkLocked(TaskRuntimeState &state,
+                                              uint64_t offset,
+                                              const uint8_t *data, size_t size) {
+  auto &cached = state.fec_cache[offset];
+  state.fec_cache_bytes -= cached.size();
+  cached.assign(data, data + size);
+  state.fec_cache_bytes += size;
+  while (state.fec_cache_bytes > kMaxFecCacheBytes && !state.fec_cache.empty()) {
+    auto oldest = state.fec_cache.begin();
+    state.fec_cache_bytes -= oldest->second.size();
+    state.fec_cache.erase(oldest);
+  }
+}
+
+void EsFileFerryUnPacker::releaseFecMembersLocked(
+    TaskRuntimeState &state, const std::vector<EsFileFecMember> &members) {
+  for (const auto &member : members) {
+    auto it = state.fec_cache.find(member.offset);
+    if (it != state.fec_cache.end()) {
+      state.fec_cache_bytes -= it->second.size();
+      state.fec_cache.erase(it);
+    }
+  }
+}
+
+void EsFileFerryUnPacker::releaseReceivedParitiesLocked(TaskRuntimeState &state) {
+  auto &pending = state.pending_parities;
+  pending.erase(
+      std::remove_if(pending.begin(), pending.end(),
+                     [&state](const PendingParity &item) {
+                       for (const auto &member : item.members) {
+                         if (!state.received_ranges.covers(
+                                 member.offset, member.offset + member.size)) {
+                           return false;
+                         }
+                       }
+                       releaseFecMembersLocked(state, item.members);
+                       return true;
+                     }),
+      pending.end());
+}
+
+bool EsFileFerryUnPacker::recoverFecChunkLocked(TaskRuntimeState &state,
+                                                const EsFilePacket &packet,
+                                                EsFilePacket &recovered,
+                                                bool hold) {
+  std::vector<EsFileFecMember> members;
+  const uint8_t *parity = nullptr;
+  size_t parity_size = 0;
+  if (!ParseEsFileFecParity(packet.payload.data(), packet.payload.size(),
+                            members, parity, parity_size)) {
+    return false;
+  }
+  const EsFileFecMember *lost = nullptr;
+  size_t lost_count = 0;
+  for (const auto &member : members) {
+    if (!state.received_ranges.covers(member.offset,
+                                      member.offset + member.size)) {
+      lost = &member;
+      ++lost_count;
+    }
+  }
+  if (hold && lost_count > 0) {
+    // 未收到的分片可能仍在其他载体上传输，此时不能判定丢失，也不能释放已缓存的成员
+    PendingParity item;
+    item.packet = packet;
+    item.members = std::move(members);
+    item.since = std::chrono::steady_clock::now();
+    state.pending_parities.emplace_back(std::move(item));
+    return false;
+  }
+  bool ok = false;
+  if (lost_count == 1) {
+    std::vector<uint8_t> block(parity, parity + parity_size);
+    ok = true;
+    for (const auto &member : members) {
+      if (&member == lost) {
+        continue;
+      }
+      auto it = state.fec_cache.find(member.offset);
+      if (it == state.fec_cache.end() || it->second.size() != member.size) {
+        ok = false;
+        break;
+      }
+      XorEsFileFecBytes(block.data(), it->second.data(), member.size);
+    }
+    if (ok) {
+      block.resize(lost->size);
+      recovered.header = packet.header;
+      recovered.header.type = EsFilePacketType::FileChunk;
+      recovered.header.flags = 0;
+      recovered.header.data_offset = lost->offset;
+      recovered.header.payload_len = lost->size;
+      recovered.task_id = packet.task_id;
+      recovered.file_name = packet.file_name;
+      recovered.payload = std::move(block);
+      state.fec_recovered_count++;
+    }
+  }
+  if (!ok) {
+    state.fec_unrecoverable_count += lost_count;
+  }
+  releaseFecMembersLocked(state, members);
+  return ok;
+}
+
+bool EsFileFerryUnPacker::getTaskStats(const std::string &task_id,
+                                       EsFileUnpackTaskStats &stats) const {
+  auto &shard = getShard(task_id);
+  std::lock_guard<std::mutex> lock(shard.mtx);
+  auto it = shard.states.find(task_id);
+  if (it == shard.states.end()) {
+    return false;
+  }
+  const auto &state = it->second;
+  stats.matched_packet_count = state.matched_packet_count;
+  stats.matched_bytes = state.matched_bytes;
+  stats.received_size = state.received_size;
+  stats.received_bytes = state.received_ranges.coveredBytes();
+  stats.file_size = state.file_size;
+  stats.completed = state.completed;
+  stats.duplicate_seq_count = state.duplicate_seq_count;
+  stats.out_of_order_seq_count = state.out_of_order_seq_count;
+  stats.crc_checked_count = state.crc_checked_count;
+  stats.crc_error_count = state.crc_error_count;
+  stats.decompressed_count = state.decompressed_count;
+  stats.decompress_error_count = state.decompress_error_count;
+  stats.fec_recovered_count = state.fec_recovered_count;
+  stats.fec_unrecoverable_count = state.fec_unrecoverable_count;
+  return true;
+}
+
+bool EsFileFerryUnPacker::getTaskMissingRanges(
+    const std::string &task_id,
+    std::vector<EsFileRangeSet::Range> &ranges) const {
+  auto &shard = getShard(task_id);
+  std::lock_guard<std::mutex> lock(shard.mtx);
+  auto it = shard.states.find(task_id);
+  if (it == shard.states.end()) {
+    return false;
+  }
+  ranges = it->second.received_ranges.missing(it->second.file_size);
+  return true;
+}
+
+void EsFileFerryUnPacker::setPendingEndTimeout(uint32_t timeout_ms) {
+  _registry->pending_end_timeout_ms.store(timeout_ms, std::memory_order_relaxed);
+}
+
+size_t EsFileFerryUnPacker::flushExpiredPendingPackets(
+    const std::function<bool(const std::string &)> &filter) {
+  const auto timeout_ms =
+      _registry->pending_end_timeout_ms.load(std::memory_order_relaxed);
+  if (timeout_ms == 0) {
+    return 0;
+  }
+  const auto now = std::chrono::steady_clock::now();
+  auto expired_since = [&](std::chrono::steady_clock::time_point since) {
+    return now - since >= std::chrono::milliseconds(timeout_ms);
+  };
+  auto skip_task = [&](TaskShard &shard, const std::string &task_id) {
+    return shard.callbacks.find(task_id) == shard.callbacks.end() ||
+           (filter && !filter(task_id));
+  };
+  // 先按丢失处理超时的 FileParity，还原出的分片可能补齐区间并带出暂存的 FileEnd；
+  // FileEnd 超时时同任务暂存的 FileParity 一并处理
+  std::vector<EsFilePacket> parities;
+  for (auto &shard : _registry->shards) {
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    for (auto &it : shard.states) {
+      auto &state = it.second;
+      if (state.pending_parities.empty() || skip_task(shard, it.first)) {
+        continue;
+      }
+      const bool end_expired =
+          state.end_pending && expired_since(state.end_pending_since);
+      auto &pending = state.pending_parities;
+      for (auto parity = pending.begin(); parity != pending.end();) {
+        if (end_expired || expired_since(parity->since)) {
+          parities.emplace_back(std::move(parity->packet));
+          parity = pending.erase(parity);
+        } else {
+          ++parity;
+        }
+      }
+    }
+  }
+  for (auto &packet : parities) {
+    dispatchPacket(std::move(packet), nullptr, 0, true);
+  }
+
+  std::vector<EsFilePacket> ends;
+  for (auto &shard : _registry->shards) {
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    for (auto &it : shard.states) {
+      auto &state = it.second;
+      if (!state.end_pending || !expired_since(state.end_pending_since) ||
+          skip_task(shard, it.first)) {
+        continue;
+      }
+      WarnL << "striped file end timeout, task_id:" << it.first
+            << " file_size:" << state.file_size
+            << " received_bytes:" << state.received_ranges.coveredBytes()
+            << " missing_ranges:"
+            << state.received_ranges.missing(state.file_size).size();
+      ends.emplace_back(std::move(state.pending_end));
+      state.pending_end = EsFilePacket();
+      state.end_pending = false;
+    }
+  }
+  for (auto &packet : ends) {
+    dispatchPacket(std::move(packet), nullptr, 0, true);
+  }
+  return parities.size() + ends.size();
 }
 
 void EsFileFerryUnPacker::setLastError(const std::string &err) {
-  std::lock_guard<std::mutex> lock(_mtx);
-  _last_error = err;
+  std::lock_guard<std::mutex> lock(_registry->error_mtx);
+  _registry->last_error = err;
 }
 
 void EsFileFerryUnPacker::emitError(EsFileUnpackErrorEvent event) {
   OnError cb;
   {
-    std::lock_guard<std::mutex> lock(_mtx);
+    std::lock_guard<std::mutex> lock(_registry->error_mtx);
     if (event.message.empty()) {
       event.message = unpackErrorTypeName(event.type);
     }
-    _last_error = event.message;
-    cb = _on_error;
+    _registry->last_error = event.message;
+    cb = _registry->on_error;
   }
   if (cb) {
     cb(event);
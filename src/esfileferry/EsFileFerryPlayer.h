@@ -1,13 +1,20 @@
 ﻿#pragma once
 
+#include "EsFileFec.h"
 #include "EsFilePayloadProtocol.h"
+#include "EsFileRangeSet.h"
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+class EsFileFerrySink;
+
 struct EsTaskDataEvent {
     // 协议包类型
     EsFilePacketType type = EsFilePacketType::Unknown;
@@ -29,7 +36,7 @@ struct EsTaskDataEvent {
     double progress = 0;
     // 是否已完成
     bool completed = false;
-    // 原始负载
+    // 原始负载；task 绑定了 EsFileFerrySink 时 FileChunk 负载已直接写盘，此处为空
     std::vector<uint8_t> payload;
     // 文本状态
     std::string status;
@@ -41,6 +48,9 @@ enum class EsFileUnpackErrorType {
     RawPacketDecodeFailed,
     BufferedPacketInvalid,
     MissingTask,
+    PayloadChecksumMismatch,
+    SinkWriteFailed,
+    PayloadDecompressFailed,
 };
 
 struct EsFileUnpackErrorEvent {
@@ -55,14 +65,52 @@ struct EsFileUnpackErrorEvent {
     size_t frame_size = 0;
 };
 
+struct EsFileUnpackTaskStats {
+    // 匹配到的协议包数量
+    uint64_t matched_packet_count = 0;
+    // 匹配到的有效载荷总字节数
+    uint64_t matched_bytes = 0;
+    // 当前已接收文件字节数
+    uint64_t received_size = 0;
+    // 已接收区间覆盖的去重字节数
+    uint64_t received_bytes = 0;
+    // 文件总大小
+    uint64_t file_size = 0;
+    // 是否已完成
+    bool completed = false;
+    // 重复序号计数
+    uint64_t duplicate_seq_count = 0;
+    // 乱序序号计数
+    uint64_t out_of_order_seq_count = 0;
+    // 携带 CRC32C 并完成校验的包数量（含校验失败）
+    uint64_t crc_checked_count = 0;
+    // CRC32C 校验失败被丢弃的包数量
+    uint64_t crc_error_count = 0;
+    // 压缩发送并解压成功的包数量
+    uint64_t decompressed_count = 0;
+    // 解压失败被丢弃的包数量（数据损坏或本端未编译对应算法）
+    uint64_t decompress_error_count = 0;
+    // 由 FileParity 还原的 FileChunk 数量
+    uint64_t fec_recovered_count = 0;
+    // 校验组内丢失过多或缓存缺失而无法还原的 FileChunk 数量
+    uint64_t fec_unrecoverable_count = 0;
+};
+
 class EsFileFerryUnPacker {
 public:
+    using Ptr = std::shared_ptr<EsFileFerryUnPacker>;
     using OnTaskData = std::function<void(const EsTaskDataEvent &)>;
     using OnError = std::function<void(const EsFileUnpackErrorEvent &)>;
     using LegacyOnError = std::function<void(const std::string &)>;
 
-    // 单例入口
+    // 条带任务暂存 FileEnd 的默认最长等待时间
+    static constexpr uint32_t kDefaultPendingEndTimeoutMs = 5000;
+
+    // 单例入口，兼容旧用法
     static EsFileFerryUnPacker &Instance();
+    // 创建独立实例：每路承载流一个，拥有独立的解析缓冲，可在不同线程并行 inputFrame；
+    // task 回调、运行态与错误回调在所有实例（含单例）间共享，按 task_id 分片加锁
+    static Ptr create();
 
     // 注册/更新 task 数据回调，cb 为空表示移除
     void setTaskCallback(const std::string &task_id, OnTaskData cb);
@@ -70,10 +118,24 @@ public:
     void removeTask(const std::string &task_id);
     // 清空所有任务回调与运行态
     void clearTasks();
+    // 为已注册的 task 绑定落盘 sink，FileChunk 负载按 data_offset 直接写盘；sink 为空表示解绑。
+    // task 未注册时返回 false
+    bool setTaskSink(const std::string &task_id, std::shared_ptr<EsFileFerrySink> sink);
     // 获取当前已注册 task_id 列表
     std::vector<std::string> getTaskIds() const;
     // 获取最近一次错误信息
     std::string getLastError() const;
+    // 获取 task 接收统计，task 未注册时返回 false
+    bool getTaskStats(const std::string &task_id, EsFileUnpackTaskStats &stats) const;
+    // 获取 task 在 [0, file_size) 内尚未收到的区间 [begin, end)，用于发送端续传/补发；task 未注册时返回 false
+    bool getTaskMissingRanges(const std::string &task_id, std::vector<EsFileRangeSet::Range> &ranges) const;
+    // 设置条带任务暂存 FileEnd/FileParity 的最长等待时间（所有实例共享），0 表示一直等待；默认 kDefaultPendingEndTimeoutMs
+    void setPendingEndTimeout(uint32_t timeout_ms);
+    // 分发等待超时的暂存包：先按丢失处理暂存的 FileParity（组内恰缺一个分片时还原），
+    // 仍未收齐的 FileEnd 按未完成分发：completed 为 false，status 为 file_end_incomplete，
+    // 缺失区间可通过 getTaskMissingRanges 获取。需由调用方定期调用，filter 非空时只处理其返回 true 的 task；
+    // 返回分发的暂存包个数
+    size_t flushExpiredPendingPackets(const std::function<bool(const std::string &)> &filter = nullptr);
 
     // 输入原始帧数据
     bool inputFrame(const uint8_t *data, size_t size);
@@ -84,6 +146,13 @@ public:
     void setOnError(LegacyOnError cb);
 
 private:
+    // 条带任务暂存的 FileParity：同组分片可能仍在其他载体上传输
+    struct PendingParity {
+        EsFilePacket packet;
+        std::vector<EsFileFecMember> members;
+        std::chrono::steady_clock::time_point since;
+    };
+
     struct TaskRuntimeState {
         // 匹配到的协议包数量
         uint64_t matched_packet_count = 0;
@@ -103,6 +172,57 @@ private:
         uint64_t duplicate_seq_count = 0;
         // 乱序序号计数
         uint64_t out_of_order_seq_count = 0;
+        // CRC32C 校验包数量
+        uint64_t crc_checked_count = 0;
+        // CRC32C 校验失败包数量
+        uint64_t crc_error_count = 0;
+        // 解压成功/失败包数量
+        uint64_t decompressed_count = 0;
+        uint64_t decompress_error_count = 0;
+        // FEC 还原成功的 FileChunk 数量
+        uint64_t fec_recovered_count = 0;
+        // FEC 无法还原的 FileChunk 数量
+        uint64_t fec_unrecoverable_count = 0;
+        // 已接收的 FileChunk 区间；续传 FileInfo 不清空
+        EsFileRangeSet received_ranges;
+        // 带 FecProtected 标记的 FileChunk 负载缓存，data_offset -> 负载，
+        // 等待本组 FileParity 到达后释放，超过 kMaxFecCacheBytes 时从最小偏移淘汰
+        std::map<uint64_t, std::vector<uint8_t>> fec_cache;
+        size_t fec_cache_bytes = 0;
+        // 落盘 sink，为空时 FileChunk 负载随事件回调
+        std::shared_ptr<EsFileFerrySink> sink;
+        // 是否已收到过 FileInfo；条带任务的分片可能先于 FileInfo 从其他载体到达
+        bool info_seen = false;
+        // 条带任务的 FileEnd 先于部分分片到达时暂存，区间收齐或等待超时后再分发
+        bool end_pending = false;
+        EsFilePacket pending_end;
+        std::chrono::steady_clock::time_point end_pending_since;
+        // 条带任务的 FileParity 先于同组部分分片到达时暂存，组内收齐后丢弃，等待超时后再按丢失还原
+        std::vector<PendingParity> pending_parities;
+    };
+
+    static constexpr size_t kTaskShardCount = 16;
+    static constexpr size_t kMaxFecCacheBytes = 16 * 1024 * 1024;
+
+    struct TaskShard {
+        std::mutex mtx;
+        // task_id -> 数据回调
+        std::unordered_map<std::string, OnTaskData> callbacks;
+        // task_id -> 运行态状态
+        std::unordered_map<std::string, TaskRuntimeState> states;
+    };
+
+    struct TaskRegistry {
+        TaskShard shards[kTaskShardCount];
+        std::mutex error_mtx;
+        // 最近一次错误信息
+        std::string last_error;
+        // 错误回调
+        OnError on_error;
+        // 绑定了 sink 的 task 数量，为 0 时解析不走直写路径
+        std::atomic<size_t> sink_count{0};
+        // 条带任务暂存 FileEnd 的最长等待时间，0 表示一直等待
+        std::atomic<uint32_t> pending_end_timeout_ms{kDefaultPendingEndTimeoutMs};
     };
 
     EsFileFerryUnPacker();
@@ -111,21 +231,44 @@ private:
 
     // 循环解析缓冲区中的完整协议包
     void parseBuffer(const uint8_t *data, size_t size);
-    // 从内部缓冲区解析一个完整协议包
-    bool parseOnePacket(EsFilePacket &packet);
+    // 从内部缓冲区解析一个完整协议包，skipped 为 true 表示跳过了一个校验失败的包，可继续解析
+    bool parseOnePacket(EsFilePacket &packet, bool &skipped);
     // 从外部原始字节解析一个完整协议包（不修改内部缓冲）
-    bool parseOnePacketFromRaw(const uint8_t *data, size_t size, EsFilePacket &packet, size_t &consumed);
+    // 返回 false 且 consumed 为整包长度时表示校验失败，decompress_failed 为 true 表示解压失败
+    bool parseOnePacketFromRaw(const uint8_t *data, size_t size, EsFilePacket &packet, size_t &consumed, bool &decompress_failed);
     // 分发协议包到对应 task 回调并更新运行态
-    void dispatchPacket(EsFilePacket packet,const uint8_t *data, size_t size);
+    // recovered 为 true 表示 FEC 还原出的 FileChunk 或条带任务补发的暂存 FileEnd，不计入匹配与序号统计
+    void dispatchPacket(EsFilePacket packet,const uint8_t *data, size_t size, bool recovered = false);
     // 更新最近错误信息
     void setLastError(const std::string &err);
     // 触发错误回调
     void emitError(EsFileUnpackErrorEvent event);
+    // 统计校验失败的包并触发错误回调
+    void onPayloadChecksumMismatch(const EsFilePacket &packet);
+    // 统计解压失败的包并触发错误回调
+    void onPayloadDecompressFailed(const EsFilePacket &packet);
+    // FileChunk 负载视图：task 绑定了 sink 时直接写盘，否则拷贝到 packet.payload；写盘失败返回 false
+    bool routeChunkPayload(EsFilePacket &packet, const uint8_t *data, size_t size, std::string &err);
+    // 触发写盘失败错误回调
+    void onSinkWriteFailed(const EsFilePacket &packet, const std::string &err);
+    // 缓存受 FEC 保护的 FileChunk 负载
+    static void cacheFecChunkLocked(TaskRuntimeState &state, uint64_t offset, const uint8_t *data, size_t size);
+    // 处理 FileParity：组内恰好缺失一个 FileChunk 时还原到 recovered，返回是否还原成功；
+    // hold 为 true 且组内有未收到的分片时暂存该包（条带任务的分片可能仍在途），不计丢失
+    static bool recoverFecChunkLocked(TaskRuntimeState &state, const EsFilePacket &packet, EsFilePacket &recovered, bool hold);
+    // 丢弃组内分片已全部收到的暂存 FileParity 并释放其负载缓存
+    static void releaseReceivedParitiesLocked(TaskRuntimeState &state);
+    // 释放组成员的负载缓存
+    static void releaseFecMembersLocked(TaskRuntimeState &state, const std::vector<EsFileFecMember> &members);
 
 private:
     void appendToBufferLocked(const uint8_t *data, size_t size);
     void resetBufferIfFullyConsumedLocked();
     void compactBufferLocked();
+    TaskShard &getShard(const std::string &task_id) const;
+    // 从运行态中移除 task，维护 sink 计数
+    void eraseTaskLocked(TaskShard &shard, const std::string &task_id);
+    static std::shared_ptr<TaskRegistry> defaultRegistry();
 
 private:
     static constexpr size_t kMaxPacketSize = 2 * 1024 * 1024;
@@ -134,18 +277,12 @@ private:
     // 控制流 task_id
     static constexpr const char *kBootstrapTaskId = "__bootstrap__";
 
-    // 全局互斥锁
+    // 解析缓冲互斥锁
     mutable std::mutex _mtx;
-    // 最近一次错误信息
-    std::string _last_error;
     // 待解析字节缓冲区
     std::vector<uint8_t> _buffer;
     size_t _buffer_start = 0;
-    // task_id -> 数据回调
-    std::unordered_map<std::string, OnTaskData> _task_callbacks;
-    // task_id -> 运行态状态
-    std::unordered_map<std::string, TaskRuntimeState> _task_states;
-    // 错误回调
-    OnError _on_error;
+    // 所有实例共享的 task 表
+    std::shared_ptr<TaskRegistry> _registry;
 
 };
@@ -2,13 +2,19 @@
 #include "EsFileFerryPlayer.h"
 #include "Common/config.h"
 #include "Thread/WorkThreadPool.h"
+#include <algorithm>
+#include <chrono>
 
 using namespace mediakit;
 using namespace toolkit;
 
 namespace {
 constexpr size_t kPendingFrameCountWarnThreshold = 2000;
+// 解包工作线程数上限，实际取 min(cpu 核数, 该值)
+constexpr size_t kMaxUnpackWorkerCount = 8;
 constexpr const char *kUnknownTaskBucketKey = "__unknown__";
+// 解包线程检查条带任务暂存 FileEnd/FileParity 是否等待超时的间隔
+constexpr auto kPendingEndCheckInterval = std::chrono::seconds(1);
 
 struct FramePacketMeta {
     bool valid = false;
@@ -62,6 +68,11 @@ std::string bucketKeyForMeta(const EsFileFerryPuller::PendingFrameMeta &meta) {
     }
     return kUnknownTaskBucketKey;
 }
+
+size_t unpackWorkerCount() {
+    const size_t cores = std::thread::hardware_concurrency();
+    return std::max<size_t>(1, std::min(cores, kMaxUnpackWorkerCount));
+}
 }
 
 EsFileFerryPuller &EsFileFerryPuller::Instance() {
@@ -71,7 +82,13 @@ EsFileFerryPuller &EsFileFerryPuller::Instance() {
 }
 
 bool EsFileFerryPuller::startPull(const std::string &url, int rtp_type) {
-  if (url.empty()) {
+  return startPull(std::vector<std::string>{url}, rtp_type);
+}
+
+bool EsFileFerryPuller::startPull(const std::vector<std::string> &urls, int rtp_type) {
+  const auto empty_it = std::find_if(urls.begin(), urls.end(),
+                                     [](const std::string &url) { return url.empty(); });
+  if (urls.empty() || empty_it != urls.end()) {
     OnError cb;
     {
       std::lock_guard<std::mutex> lock(_mtx);
@@ -85,13 +102,55 @@ bool EsFileFerryPuller::startPull(const std::string &url, int rtp_type) {
   }
 
   stopPull();
-  startUnpackWorker();
-  DebugL << "startPull, url:" << url << " rtp_type:" << rtp_type;
+  startUnpackWorker(urls.size());
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    _carriers.clear();
+    _carriers.resize(urls.size());
+    for (size_t i = 0; i < urls.size(); ++i) {
+      _carriers[i].url = urls[i];
+    }
+    _rtp_type = rtp_type;
+    _last_error.clear();
+  }
+  for (size_t i = 0; i < urls.size(); ++i) {
+    if (!startCarrier(i)) {
+      stopPull();
+      return false;
+    }
+  }
+  _running = true;
+  return true;
+}
+
+bool EsFileFerryPuller::startCarrier(size_t carrier) {
+  std::string url;
+  MediaPlayer::Ptr old_player;
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (carrier >= _carriers.size()) {
+      return false;
+    }
+    url = _carriers[carrier].url;
+    old_player = _carriers[carrier].player;
+  }
+  // 单路重连只替换本路播放器，其余载体继续收流
+  if (old_player) {
+    clearTrackDelegates(carrier);
+    old_player->teardown();
+  }
+
+  const auto rtp_type = _rtp_type.load();
+  DebugL << "startPull, url:" << url << " carrier:" << carrier << " rtp_type:" << rtp_type;
   //auto poller = WorkThreadPool::Instance().getPoller();
   MediaPlayer::Ptr player = std::make_shared<MediaPlayer>();
   std::weak_ptr<MediaPlayer> weak_player = player;
-  player->setOnPlayResult([this](const SockException &ex) { onPlayResult(ex); });
-  player->setOnShutdown([this](const SockException &ex) { onShutdown(ex); });
+  player->setOnPlayResult([this, carrier, weak_player](const SockException &ex) {
+    onPlayResult(carrier, weak_player, ex);
+  });
+  player->setOnShutdown([this, carrier, weak_player](const SockException &ex) {
+    onShutdown(carrier, weak_player, ex);
+  });
   (*player)[Client::kRtpType] = rtp_type;
   (*player)[Client::kWaitTrackReady] = false;
   (*player)[Client::kTimeoutMS] = 15000;
@@ -99,11 +158,11 @@ bool EsFileFerryPuller::startPull(const std::string &url, int rtp_type) {
 
   {
     std::lock_guard<std::mutex> lock(_mtx);
-    _player = player;
-    _retry_timer.reset();
-    _rtp_type = rtp_type;
-    _stream_url = url;
-    _last_error.clear();
+    if (carrier >= _carriers.size()) {
+      return false;
+    }
+    _carriers[carrier].player = player;
+    _carriers[carrier].retry_timer.reset();
   }
 
   if (!weak_player.lock()) {
@@ -116,33 +175,32 @@ bool EsFileFerryPuller::startPull(const std::string &url, int rtp_type) {
     if (cb) {
       cb("player create failed");
     }
-    stopUnpackWorker();
     return false;
   }
   player->play(url);
-  _running = true;
   return true;
 }
 
 void EsFileFerryPuller::stopPull() {
-    MediaPlayer::Ptr player;
+    std::vector<MediaPlayer::Ptr> players;
     {
         std::lock_guard<std::mutex> lock(_mtx);
-        player = _player;
-        _retry_timer.reset();
+        for (auto &item : _carriers) {
+            players.emplace_back(item.player);
+            item.retry_timer.reset();
+        }
     }
 
-    if (player) {
-        clearTrackDelegates();
-        player->teardown();
+    for (size_t i = 0; i < players.size(); ++i) {
+        if (players[i]) {
+            clearTrackDelegates(i);
+            players[i]->teardown();
+        }
     }
 
     {
         std::lock_guard<std::mutex> lock(_mtx);
-        _player.reset();
-        _retry_timer.reset();
-        _track_delegates.clear();
-        _stream_url.clear();
+        _carriers.clear();
     }
     stopUnpackWorker();
     _running = false;
@@ -157,17 +215,27 @@ void EsFileFerryPuller::removeTaskFrames(const std::string &task_id) {
         size_t removed_frames = 0;
         size_t removed_bytes = 0;
         PendingTaskBucket removed_bucket;
+        std::shared_ptr<UnpackWorker> worker;
         {
             std::lock_guard<std::mutex> lock(_mtx);
-            auto it = _task_buckets.find(task_id);
-            if (it == _task_buckets.end()) {
+            if (_unpack_workers.empty()) {
+                return;
+            }
+            worker = _unpack_workers[std::hash<std::string>()(task_id) % _unpack_workers.size()];
+        }
+        {
+            std::lock_guard<std::mutex> lock(worker->mtx);
+            auto it = worker->task_buckets.find(task_id);
+            if (it == worker->task_buckets.end()) {
                 return;
             }
             removed_frames = it->second.frames.size();
             removed_bytes = it->second.buffered_bytes;
+            worker->buffered_frames -= removed_frames;
+            worker->buffered_bytes -= removed_bytes;
             removed_bucket = std::move(it->second);
-            _task_buckets.erase(it);
-            _ready_task_ids.erase(std::remove(_ready_task_ids.begin(), _ready_task_ids.end(), task_id), _ready_task_ids.end());
+            worker->task_buckets.erase(it);
+            worker->ready_task_ids.erase(std::remove(worker->ready_task_ids.begin(), worker->ready_task_ids.end(), task_id), worker->ready_task_ids.end());
         }
         if (removed_frames > 0 || removed_bytes > 0) {
             InfoL << "remove puller task bucket, task_id:" << task_id << " removed_frames:" << removed_frames << " removed_bytes:" << removed_bytes;
@@ -177,7 +245,17 @@ void EsFileFerryPuller::removeTaskFrames(const std::string &task_id) {
 
 std::string EsFileFerryPuller::getStreamUrl() const {
     std::lock_guard<std::mutex> lock(_mtx);
-    return _stream_url;
+    return _carriers.empty() ? std::string() : _carriers.front().url;
+}
+
+std::vector<std::string> EsFileFerryPuller::getStreamUrls() const {
+    std::lock_guard<std::mutex> lock(_mtx);
+    std::vector<std::string> urls;
+    urls.reserve(_carriers.size());
+    for (const auto &item : _carriers) {
+        urls.emplace_back(item.url);
+    }
+    return urls;
 }
 
 std::string EsFileFerryPuller::getLastError() const {
@@ -190,35 +268,54 @@ void EsFileFerryPuller::setOnError(OnError cb) {
     _on_error = std::move(cb);
 }
 
-void EsFileFerryPuller::onPlayResult(const SockException &ex) {
+bool EsFileFerryPuller::isCurrentPlayerLocked(size_t carrier, const std::weak_ptr<MediaPlayer> &player) const {
+    // 已被替换或停止的播放器迟到的回调不再触发重连
+    auto strong = player.lock();
+    return strong && carrier < _carriers.size() && _carriers[carrier].player == strong;
+}
+
+void EsFileFerryPuller::onPlayResult(size_t carrier, const std::weak_ptr<MediaPlayer> &player, const SockException &ex) {
     if (ex) {
-        _running = false;
         OnError cb;
         auto should_retry = false;
         {
             std::lock_guard<std::mutex> lock(_mtx);
+            if (!isCurrentPlayerLocked(carrier, player)) {
+                return;
+            }
             cb = _on_error;
             _last_error = ex.what();
-            should_retry = !_stream_url.empty();
+            should_retry = !_carriers[carrier].url.empty();
         }
+        _running = false;
         if (cb) {
             cb(ex.what());
         }
         if (should_retry) {
-            scheduleRetry();
+            scheduleRetry(carrier);
         }
         return;
     }
     {
         std::lock_guard<std::mutex> lock(_mtx);
-        _retry_timer.reset();
+        if (!isCurrentPlayerLocked(carrier, player)) {
+            return;
+        }
+        _carriers[carrier].retry_timer.reset();
     }
-    attachTrackDelegates();
+    _running = true;
+    attachTrackDelegates(carrier);
 }
 
-void EsFileFerryPuller::onShutdown(const SockException &ex) {
+void EsFileFerryPuller::onShutdown(size_t carrier, const std::weak_ptr<MediaPlayer> &player, const SockException &ex) {
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (!isCurrentPlayerLocked(carrier, player)) {
+            return;
+        }
+    }
     _running = false;
-    clearTrackDelegates();
+    clearTrackDelegates(carrier);
     if (!ex) {
         return;
     }
@@ -231,132 +328,170 @@ void EsFileFerryPuller::onShutdown(const SockException &ex) {
     if (cb) {
         cb(ex.what());
     }
-    scheduleRetry();
+    scheduleRetry(carrier);
 }
 
-void EsFileFerryPuller::scheduleRetry() {
+void EsFileFerryPuller::scheduleRetry(size_t carrier) {
     std::lock_guard<std::mutex> lock(_mtx);
-    if (_stream_url.empty() || _retry_timer) {
+    if (carrier >= _carriers.size() || _carriers[carrier].url.empty() ||
+        _carriers[carrier].retry_timer) {
         return;
     }
-    _retry_timer = std::make_shared<toolkit::Timer>(
+    _carriers[carrier].retry_timer = std::make_shared<toolkit::Timer>(
         1.0f,
-        [this]() {
-            std::string url;
-            int rtp_type = 0;
+        [this, carrier]() {
             {
                 std::lock_guard<std::mutex> lock(_mtx);
-                if (_stream_url.empty()) {
-                    _retry_timer.reset();
+                if (carrier >= _carriers.size()) {
                     return false;
                 }
-                url = _stream_url;
-                rtp_type = _rtp_type.load();
-                _retry_timer.reset();
+                _carriers[carrier].retry_timer.reset();
             }
-            startPull(url, rtp_type);
+            startCarrier(carrier);
             return false;
         },
         nullptr);
 }
 
-void EsFileFerryPuller::startUnpackWorker() {
+void EsFileFerryPuller::startUnpackWorker(size_t carrier_count) {
     std::lock_guard<std::mutex> lock(_mtx);
-    if (_unpack_thread.joinable()) {
+    if (!_unpack_workers.empty()) {
         return;
     }
-    _task_buckets.clear();
-    _ready_task_ids.clear();
-    _unpack_stop = false;
-    _unpack_thread = std::thread([this]() { unpackWorkerLoop(); });
+    const auto count = unpackWorkerCount();
+    for (size_t i = 0; i < count; ++i) {
+        auto worker = std::make_shared<UnpackWorker>();
+        worker->index = i;
+        worker->count = count;
+        for (size_t j = 0; j < carrier_count; ++j) {
+            worker->unpackers.emplace_back(EsFileFerryUnPacker::create());
+        }
+        auto *raw_worker = worker.get();
+        worker->thread = std::thread([this, raw_worker]() { unpackWorkerLoop(*raw_worker); });
+        _unpack_workers.emplace_back(std::move(worker));
+    }
+    DebugL << "start unpack workers, count:" << count << " carrier_count:" << carrier_count;
 }
 
 void EsFileFerryPuller::stopUnpackWorker() {
-    std::thread join_thread;
+    std::vector<std::shared_ptr<UnpackWorker>> workers;
     {
         std::lock_guard<std::mutex> lock(_mtx);
-        _unpack_stop = true;
-        _task_buckets.clear();
-        _ready_task_ids.clear();
-        if (_unpack_thread.joinable()) {
-            join_thread = std::move(_unpack_thread);
+        workers.swap(_unpack_workers);
+    }
+    for (auto &worker : workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mtx);
+            worker->stop = true;
+            worker->task_buckets.clear();
+            worker->ready_task_ids.clear();
+            worker->buffered_bytes = 0;
+            worker->buffered_frames = 0;
         }
+        worker->frame_cv.notify_all();
     }
-    _frame_cv.notify_all();
-    if (join_thread.joinable()) {
-        join_thread.join();
+    for (auto &worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
     }
 }
 
-bool EsFileFerryPuller::enqueueFrame(const Frame::Ptr &frame) {
+bool EsFileFerryPuller::enqueueFrame(size_t carrier, const Frame::Ptr &frame) {
     if (!frame || !frame->data() || frame->size() == 0) {
         return true;
     }
     PendingFrame pending;
     pending.frame = frame;
     pending.size = static_cast<size_t>(frame->size());
+    pending.carrier = carrier;
     const auto decodedIncomingMeta = tryDecodeFramePacketMeta(frame);
     pending.meta.valid = decodedIncomingMeta.valid;
     pending.meta.task_id = decodedIncomingMeta.task_id;
     pending.meta.packet_type = static_cast<int>(decodedIncomingMeta.type);
     pending.meta.seq = decodedIncomingMeta.seq;
 
+    const auto task_key = bucketKeyForMeta(pending.meta);
+    std::shared_ptr<UnpackWorker> worker;
+    size_t worker_index = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (_unpack_workers.empty()) {
+            return false;
+        }
+        worker_index = std::hash<std::string>()(task_key) % _unpack_workers.size();
+        worker = _unpack_workers[worker_index];
+    }
+
     size_t pending_bytes = 0;
     size_t pending_frames = 0;
     {
-        std::unique_lock<std::mutex> lock(_mtx);
-        if (_unpack_stop) {
+        std::lock_guard<std::mutex> lock(worker->mtx);
+        if (worker->stop) {
             return false;
         }
-        const auto task_key = bucketKeyForMeta(pending.meta);
-        auto &bucket = _task_buckets[task_key];
+        auto &bucket = worker->task_buckets[task_key];
         if (!bucket.in_ready_queue) {
-            _ready_task_ids.emplace_back(task_key);
+            worker->ready_task_ids.emplace_back(task_key);
             bucket.in_ready_queue = true;
         }
         bucket.buffered_bytes += pending.size;
         bucket.frames.emplace_back(std::move(pending));
-        for (const auto &entry : _task_buckets) {
-            pending_bytes += entry.second.buffered_bytes;
-            pending_frames += entry.second.frames.size();
-        }
+        worker->buffered_bytes += bucket.frames.back().size;
+        worker->buffered_frames += 1;
+        pending_bytes = worker->buffered_bytes;
+        pending_frames = worker->buffered_frames;
     }
     if (pending_frames > kPendingFrameCountWarnThreshold) {
         static std::atomic<size_t> s_overflow_count{0};
         const auto overflow_count = ++s_overflow_count;
         if (overflow_count <= 5 || overflow_count % 100 == 0) {
-            WarnL << "puller unpack queue frame count over threshold, frame_size:" << pending.size
+            WarnL << "puller unpack queue frame count over threshold, frame_size:" << frame->size()
                   << " task_id:" << (decodedIncomingMeta.valid ? decodedIncomingMeta.task_id : std::string("unknown"))
+                  << " worker:" << worker_index
                   << " pending_frames:" << pending_frames
                   << " pending_bytes:" << pending_bytes
                   << " threshold:" << kPendingFrameCountWarnThreshold
                   << " overflow_count:" << overflow_count;
         }
     }
-    _frame_cv.notify_one();
+    worker->frame_cv.notify_one();
     return true;
 }
 
-void EsFileFerryPuller::unpackWorkerLoop() {
+void EsFileFerryPuller::unpackWorkerLoop(UnpackWorker &worker) {
+    auto last_end_check = std::chrono::steady_clock::now();
     while (true) {
+        // 某路载体上的分片丢失时，暂存的 FileParity/FileEnd 不会再被后续分片触发，
+        // 定期按丢失还原或按未完成分发；只处理哈希到本线程的 task，保证同一 task 的事件仍由同一线程按序回调
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_end_check >= kPendingEndCheckInterval && !worker.unpackers.empty()) {
+            last_end_check = now;
+            worker.unpackers.front()->flushExpiredPendingPackets([&worker](const std::string &task_id) {
+                return std::hash<std::string>()(task_id) % worker.count == worker.index;
+            });
+        }
         PendingFrame pending;
         {
-            std::unique_lock<std::mutex> lock(_mtx);
-            _frame_cv.wait(lock, [this]() {
-                return _unpack_stop || !_ready_task_ids.empty();
+            std::unique_lock<std::mutex> lock(worker.mtx);
+            const auto has_frame = worker.frame_cv.wait_for(lock, kPendingEndCheckInterval, [&worker]() {
+                return worker.stop || !worker.ready_task_ids.empty();
             });
-            if (_unpack_stop && _ready_task_ids.empty()) {
+            if (!has_frame) {
+                continue;
+            }
+            if (worker.stop && worker.ready_task_ids.empty()) {
                 break;
             }
-            const auto task_key = std::move(_ready_task_ids.front());
-            _ready_task_ids.pop_front();
-            auto bucket_it = _task_buckets.find(task_key);
-            if (bucket_it == _task_buckets.end()) {
+            const auto task_key = std::move(worker.ready_task_ids.front());
+            worker.ready_task_ids.pop_front();
+            auto bucket_it = worker.task_buckets.find(task_key);
+            if (bucket_it == worker.task_buckets.end()) {
                 continue;
             }
             bucket_it->second.in_ready_queue = false;
             if (bucket_it->second.frames.empty()) {
-                _task_buckets.erase(bucket_it);
+                worker.task_buckets.erase(bucket_it);
                 continue;
             }
             pending = std::move(bucket_it->second.frames.front());
@@ -366,14 +501,17 @@ void EsFileFerryPuller::unpackWorkerLoop() {
             } else {
                 bucket_it->second.buffered_bytes = 0;
             }
+            worker.buffered_bytes -= std::min(worker.buffered_bytes, pending.size);
+            worker.buffered_frames -= std::min<size_t>(worker.buffered_frames, 1);
             if (!bucket_it->second.frames.empty()) {
-                _ready_task_ids.emplace_back(task_key);
+                worker.ready_task_ids.emplace_back(task_key);
                 bucket_it->second.in_ready_queue = true;
             } else {
-                _task_buckets.erase(bucket_it);
+                worker.task_buckets.erase(bucket_it);
             }
         }
-        if (pending.frame && pending.frame->data() && pending.frame->size() > 0) {
+        if (pending.frame && pending.frame->data() && pending.frame->size() > 0 &&
+            pending.carrier < worker.unpackers.size()) {
             //uint8_t tembuf[]
             //    = { 00,   0x00, 0x00, 0x01, 0x61, 0x47, 0x54, 0x46, 0x59, 0x01, 0x01, 0x00, 0x17, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
             //        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x16, 0x14, 0x37, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x00,
@@ -390,22 +528,24 @@ void EsFileFerryPuller::unpackWorkerLoop() {
             //        0x68, 0x3a, 0x2f, 0x2c, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x3a, 0x2c, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x3a,
             //        0x32, 0x30, 0x32, 0x36, 0x2d, 0x30, 0x34, 0x2d, 0x32, 0x30, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x30, 0x3a, 0x31, 0x38, 0x29, 0x0a };
             //EsFileFerryUnPacker::Instance().inputFrame(tembuf, sizeof(tembuf));
-            EsFileFerryUnPacker::Instance().inputFrame(reinterpret_cast<const uint8_t *>(pending.frame->data()), static_cast<size_t>(pending.frame->size()));
+            worker.unpackers[pending.carrier]->inputFrame(reinterpret_cast<const uint8_t *>(pending.frame->data()), static_cast<size_t>(pending.frame->size()));
         }
     }
 }
 
-void EsFileFerryPuller::attachTrackDelegates() {
+void EsFileFerryPuller::attachTrackDelegates(size_t carrier) {
     MediaPlayer::Ptr player;
     {
         std::lock_guard<std::mutex> lock(_mtx);
-        player = _player;
+        if (carrier < _carriers.size()) {
+            player = _carriers[carrier].player;
+        }
     }
     if (!player) {
         return;
     }
 
-    clearTrackDelegates();
+    clearTrackDelegates(carrier);
 
     auto tracks = player->getTracks(false);
     std::vector<std::pair<std::weak_ptr<Track>, FrameWriterInterface *>> delegates;
@@ -414,28 +554,43 @@ void EsFileFerryPuller::attachTrackDelegates() {
         if (!track) {
             continue;
         }
-        auto ptr = track->addDelegate([this](const Frame::Ptr &frame) {
+        auto ptr = track->addDelegate([this, carrier](const Frame::Ptr &frame) {
             if (!frame || !frame->data() || frame->size() == 0) {
                 return true;
             }
             if (frame->getTrackType() == TrackType::TrackAudio) {
                 return true;
             }
-            enqueueFrame(frame);
+            enqueueFrame(carrier, frame);
             return true;
         });
         delegates.emplace_back(track, ptr);
     }
 
-    std::lock_guard<std::mutex> lock(_mtx);
-    _track_delegates = std::move(delegates);
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (carrier < _carriers.size() && _carriers[carrier].player == player) {
+            _carriers[carrier].track_delegates = std::move(delegates);
+            return;
+        }
+    }
+    // 挂载期间本路已被替换或停止，撤回刚挂上的代理
+    for (auto &item : delegates) {
+        auto track = item.first.lock();
+        if (track && item.second) {
+            track->delDelegate(item.second);
+        }
+    }
 }
 
-void EsFileFerryPuller::clearTrackDelegates() {
+void EsFileFerryPuller::clearTrackDelegates(size_t carrier) {
     std::vector<std::pair<std::weak_ptr<Track>, FrameWriterInterface *>> delegates;
     {
         std::lock_guard<std::mutex> lock(_mtx);
-        delegates.swap(_track_delegates);
+        if (carrier >= _carriers.size()) {
+            return;
+        }
+        delegates.swap(_carriers[carrier].track_delegates);
     }
     for (auto &item : delegates) {
         auto track = item.first.lock();
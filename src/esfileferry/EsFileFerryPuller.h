@@ -15,6 +15,8 @@
 #include <utility>
 #include <vector>
 
+class EsFileFerryUnPacker;
+
 class EsFileFerryPuller {
 public:
     using OnError = std::function<void(const std::string &)>;
@@ -28,9 +30,13 @@ public:
     static EsFileFerryPuller &Instance();
 
     bool startPull(const std::string &url, int rtp_type = 0);
+    // 同时拉取多路载体流，发送端按条带把同一任务分发到这些流上，各路独立断线重连
+    bool startPull(const std::vector<std::string> &urls, int rtp_type = 0);
     void stopPull();
     void removeTaskFrames(const std::string &task_id);
+    // 返回第一路载体流地址
     std::string getStreamUrl() const;
+    std::vector<std::string> getStreamUrls() const;
     std::string getLastError() const;
     void setOnError(OnError cb);
 
@@ -39,20 +45,26 @@ private:
     EsFileFerryPuller(const EsFileFerryPuller &) = delete;
     EsFileFerryPuller &operator=(const EsFileFerryPuller &) = delete;
 
-    void onPlayResult(const toolkit::SockException &ex);
-    void onShutdown(const toolkit::SockException &ex);
-    void attachTrackDelegates();
-    void clearTrackDelegates();
-    void scheduleRetry();
-    void startUnpackWorker();
+    bool startCarrier(size_t carrier);
+    bool isCurrentPlayerLocked(size_t carrier, const std::weak_ptr<mediakit::MediaPlayer> &player) const;
+    void onPlayResult(size_t carrier, const std::weak_ptr<mediakit::MediaPlayer> &player, const toolkit::SockException &ex);
+    void onShutdown(size_t carrier, const std::weak_ptr<mediakit::MediaPlayer> &player, const toolkit::SockException &ex);
+    void attachTrackDelegates(size_t carrier);
+    void clearTrackDelegates(size_t carrier);
+    void scheduleRetry(size_t carrier);
+
+    struct UnpackWorker;
+    void startUnpackWorker(size_t carrier_count);
     void stopUnpackWorker();
-    bool enqueueFrame(const mediakit::Frame::Ptr &frame);
-    void unpackWorkerLoop();
+    bool enqueueFrame(size_t carrier, const mediakit::Frame::Ptr &frame);
+    void unpackWorkerLoop(UnpackWorker &worker);
 
 private:
     struct PendingFrame {
         mediakit::Frame::Ptr frame;
         size_t size = 0;
+        // 来源载体下标
+        size_t carrier = 0;
         PendingFrameMeta meta;
     };
 
@@ -62,17 +74,36 @@ private:
         bool in_ready_queue = false;
     };
 
+    // 解包工作线程，按 task_id 哈希分片：同一 task 的帧始终由同一线程按序解包，
+    // 各线程使用独立的 UnPacker 实例与解析缓冲，互不争抢；
+    // 每路载体再各用一个实例，避免不同流的半包在同一解析缓冲里拼接
+    struct UnpackWorker {
+        std::mutex mtx;
+        std::condition_variable frame_cv;
+        std::unordered_map<std::string, PendingTaskBucket> task_buckets;
+        std::deque<std::string> ready_task_ids;
+        size_t buffered_bytes = 0;
+        size_t buffered_frames = 0;
+        bool stop = false;
+        std::vector<std::shared_ptr<EsFileFerryUnPacker>> unpackers;
+        // 本线程下标与线程总数，用于判断 task 是否哈希到本线程
+        size_t index = 0;
+        size_t count = 1;
+        std::thread thread;
+    };
+
+    // 单路载体流的播放器与重连状态
+    struct CarrierStream {
+        std::string url;
+        mediakit::MediaPlayer::Ptr player;
+        std::shared_ptr<toolkit::Timer> retry_timer;
+        std::vector<std::pair<std::weak_ptr<mediakit::Track>, mediakit::FrameWriterInterface *>> track_delegates;
+    };
+
     mutable std::mutex _mtx;
-    mediakit::MediaPlayer::Ptr _player;
-    std::shared_ptr<toolkit::Timer> _retry_timer;
-    std::string _stream_url;
+    std::vector<CarrierStream> _carriers;
     std::string _last_error;
-    std::vector<std::pair<std::weak_ptr<mediakit::Track>, mediakit::FrameWriterInterface *>> _track_delegates;
-    std::unordered_map<std::string, PendingTaskBucket> _task_buckets;
-    std::deque<std::string> _ready_task_ids;
-    std::condition_variable _frame_cv;
-    std::thread _unpack_thread;
-    bool _unpack_stop = true;
+    std::vector<std::shared_ptr<UnpackWorker>> _unpack_workers;
     std::atomic<bool> _running = {false};
     std::atomic<int> _rtp_type = {0};
     OnError _on_error;
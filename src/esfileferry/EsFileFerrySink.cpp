@@ -0,0 +1,196 @@
+﻿#include "EsFileFerrySink.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+std::string lastSystemError(const char *op) {
+  return std::string(op) + " failed: " + std::strerror(errno);
+}
+
+int openForWrite(const std::string &path) {
+#if defined(_WIN32)
+  int fd = -1;
+  _sopen_s(&fd, path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+           _SH_DENYNO, _S_IREAD | _S_IWRITE);
+  return fd;
+#else
+  return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+}
+
+void closeFd(int fd) {
+#if defined(_WIN32)
+  _close(fd);
+#else
+  ::close(fd);
+#endif
+}
+
+bool preallocate(int fd, uint64_t size) {
+#if defined(_WIN32)
+  return _chsize_s(fd, static_cast<__int64>(size)) == 0;
+#else
+#if defined(__linux__)
+  // 优先真正分配块，减少写入时的碎片与元数据更新；文件系统不支持时退回 ftruncate
+  if (posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0) {
+    return true;
+  }
+#endif
+  return ::ftruncate(fd, static_cast<off_t>(size)) == 0;
+#endif
+}
+
+bool writeFullAt(int fd, uint64_t offset, const uint8_t *data, size_t size) {
+#if defined(_WIN32)
+  // Windows CRT 没有 pwrite，调用方已持锁保证 seek + write 原子
+  if (_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0) {
+    return false;
+  }
+  while (size > 0) {
+    const auto chunk = static_cast<unsigned int>(size > 0x40000000 ? 0x40000000 : size);
+    const auto ret = _write(fd, data, chunk);
+    if (ret <= 0) {
+      return false;
+    }
+    data += ret;
+    size -= static_cast<size_t>(ret);
+  }
+  return true;
+#else
+  while (size > 0) {
+    const auto ret = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (ret == 0) {
+      errno = EIO;
+      return false;
+    }
+    data += ret;
+    offset += static_cast<uint64_t>(ret);
+    size -= static_cast<size_t>(ret);
+  }
+  return true;
+#endif
+}
+} // namespace
+
+EsFileFerrySink::Ptr EsFileFerrySink::create(const std::string &path,
+                                             std::string *err) {
+  const auto fd = openForWrite(path);
+  if (fd < 0) {
+    if (err) {
+      *err = lastSystemError("open");
+    }
+    return nullptr;
+  }
+  Ptr sink(new EsFileFerrySink());
+  sink->_path = path;
+  sink->_fd = fd;
+  return sink;
+}
+
+EsFileFerrySink::~EsFileFerrySink() {
+  if (_fd >= 0) {
+    closeFd(_fd);
+  }
+}
+
+void EsFileFerrySink::setOnComplete(OnComplete cb) {
+  std::lock_guard<std::mutex> lock(_mtx);
+  _on_complete = std::move(cb);
+}
+
+bool EsFileFerrySink::onFileInfo(uint64_t file_size, bool resume) {
+  std::lock_guard<std::mutex> lock(_mtx);
+  _file_size = file_size;
+  if (!resume) {
+    _ranges.clear();
+  }
+  _finished = false;
+  if (file_size > 0 && !preallocate(_fd, file_size)) {
+    setErrorLocked(lastSystemError("preallocate"));
+    return false;
+  }
+  return true;
+}
+
+bool EsFileFerrySink::writeAt(uint64_t offset, const uint8_t *data,
+                              size_t size) {
+  if (size == 0) {
+    return true;
+  }
+#if defined(_WIN32)
+  std::lock_guard<std::mutex> lock(_mtx);
+  const auto ok = writeFullAt(_fd, offset, data, size);
+#else
+  // pwrite 自带偏移，不同区间可并发写入，只有区间表需要加锁
+  const auto ok = writeFullAt(_fd, offset, data, size);
+  std::lock_guard<std::mutex> lock(_mtx);
+#endif
+  if (!ok) {
+    setErrorLocked(lastSystemError("pwrite"));
+    return false;
+  }
+  _ranges.add(offset, offset + size);
+  return true;
+}
+
+void EsFileFerrySink::onFileEnd(uint64_t file_size) {
+  Result result;
+  OnComplete cb;
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_finished) {
+      return;
+    }
+    _finished = true;
+    if (file_size > 0) {
+      _file_size = file_size;
+    }
+    result.path = _path;
+    result.file_size = _file_size;
+    result.received_bytes = _ranges.coveredBytes();
+    result.complete = _error.empty() && _ranges.covers(0, _file_size);
+    result.error = _error;
+    cb = _on_complete;
+  }
+  if (cb) {
+    cb(result);
+  }
+}
+
+uint64_t EsFileFerrySink::getReceivedBytes() const {
+  std::lock_guard<std::mutex> lock(_mtx);
+  return _ranges.coveredBytes();
+}
+
+std::vector<std::pair<uint64_t, uint64_t>>
+EsFileFerrySink::getMissingRanges() const {
+  std::lock_guard<std::mutex> lock(_mtx);
+  return _ranges.missing(_file_size);
+}
+
+std::string EsFileFerrySink::getLastError() const {
+  std::lock_guard<std::mutex> lock(_mtx);
+  return _error;
+}
+
+void EsFileFerrySink::setErrorLocked(const std::string &err) {
+  if (_error.empty()) {
+    _error = err;
+  }
+}
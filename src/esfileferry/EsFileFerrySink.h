@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include "EsFileRangeSet.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 接收侧落盘：FileChunk 负载按 data_offset 定位写入（pwrite），乱序到达无需在内存中重排。
+// 通过 EsFileFerryUnPacker::setTaskSink 绑定到 task 后，FileChunk 负载直接从解析缓冲写盘，
+// 不再拷贝到 EsTaskDataEvent::payload。
+class EsFileFerrySink {
+public:
+    using Ptr = std::shared_ptr<EsFileFerrySink>;
+
+    struct Result {
+        // 文件路径
+        std::string path;
+        // FileInfo/FileEnd 声明的文件大小
+        uint64_t file_size = 0;
+        // 已写入的去重字节数
+        uint64_t received_bytes = 0;
+        // [0, file_size) 是否全部写入
+        bool complete = false;
+        // 首个写盘错误，为空表示无错误
+        std::string error;
+    };
+
+    using OnComplete = std::function<void(const Result &)>;
+
+    // 创建并打开（截断）目标文件，失败返回 nullptr，err 为错误描述
+    static Ptr create(const std::string &path, std::string *err = nullptr);
+    ~EsFileFerrySink();
+
+    // FileEnd 到达后回调一次
+    void setOnComplete(OnComplete cb);
+
+    // FileInfo：按 file_size 预分配空间；resume 为 false 时清空已接收区间，续传时保留
+    bool onFileInfo(uint64_t file_size, bool resume = false);
+    // FileChunk：在 offset 处写入 size 字节，并记录已接收区间
+    bool writeAt(uint64_t offset, const uint8_t *data, size_t size);
+    // FileEnd：校验区间完整性并回调结果
+    void onFileEnd(uint64_t file_size);
+
+    const std::string &getPath() const { return _path; }
+    // 已写入的去重字节数
+    uint64_t getReceivedBytes() const;
+    // [0, file_size) 内尚未收到的区间，元素为 [begin, end)
+    std::vector<std::pair<uint64_t, uint64_t>> getMissingRanges() const;
+    // 首个写盘错误
+    std::string getLastError() const;
+
+private:
+    EsFileFerrySink() = default;
+    EsFileFerrySink(const EsFileFerrySink &) = delete;
+    EsFileFerrySink &operator=(const EsFileFerrySink &) = delete;
+
+    void setErrorLocked(const std::string &err);
+
+private:
+    std::string _path;
+    int _fd = -1;
+    mutable std::mutex _mtx;
+    uint64_t _file_size = 0;
+    // 已写入区间
+    EsFileRangeSet _ranges;
+    std::string _error;
+    bool _finished = false;
+    OnComplete _on_complete;
+};
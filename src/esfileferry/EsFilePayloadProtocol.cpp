@@ -6,6 +6,12 @@ const size_t kEsFileFixedHeaderSize = 48;
 const uint16_t kEsFileFlagFileInfoHasHttpResponseHeaders = 0x0001;
 const uint16_t kEsFileFlagPayloadEscaped = 0x0002;
 const uint16_t kEsFileFlagFileInfoPayloadBase64 = 0x0004;
+const uint16_t kEsFileFlagPayloadCrc32c = 0x0008;
+const uint16_t kEsFileFlagFileInfoResume = 0x0010;
+const uint16_t kEsFileFlagFecProtected = 0x0020;
+const uint16_t kEsFileFlagPayloadLz4 = 0x0040;
+const uint16_t kEsFileFlagPayloadZstd = 0x0080;
+const uint16_t kEsFileFlagStriped = 0x0100;
 const uint8_t kEsFileCarrierNalHeader = 0x61;
 const size_t kEsFileCarrierPrefixSize = 5;
 const size_t kEsFileCarrierShortPrefixSize = 4;
@@ -110,6 +116,50 @@ void AppendEsFilePacketHeader(std::vector<uint8_t> &out,
     WriteEsFileU32BE(out, header.reserved);
 }
 
+static uint8_t *PutEsFileU16BE(uint8_t *out, uint16_t value) {
+    out[0] = static_cast<uint8_t>((value >> 8) & 0xFF);
+    out[1] = static_cast<uint8_t>(value & 0xFF);
+    return out + 2;
+}
+
+static uint8_t *PutEsFileU32BE(uint8_t *out, uint32_t value) {
+    out[0] = static_cast<uint8_t>((value >> 24) & 0xFF);
+    out[1] = static_cast<uint8_t>((value >> 16) & 0xFF);
+    out[2] = static_cast<uint8_t>((value >> 8) & 0xFF);
+    out[3] = static_cast<uint8_t>(value & 0xFF);
+    return out + 4;
+}
+
+static uint8_t *PutEsFileU64BE(uint8_t *out, uint64_t value) {
+    out = PutEsFileU32BE(out, static_cast<uint32_t>(value >> 32));
+    return PutEsFileU32BE(out, static_cast<uint32_t>(value & 0xFFFFFFFF));
+}
+
+uint8_t *WriteEsFileCarrierPrefix(uint8_t *out) {
+    out[0] = 0x00;
+    out[1] = 0x00;
+    out[2] = 0x00;
+    out[3] = 0x01;
+    out[4] = kEsFileCarrierNalHeader;
+    return out + kEsFileCarrierPrefixSize;
+}
+
+uint8_t *WriteEsFilePacketHeader(uint8_t *out, const EsFilePacketHeader &header) {
+    out = PutEsFileU32BE(out, header.magic);
+    *out++ = header.version;
+    *out++ = static_cast<uint8_t>(header.type);
+    out = PutEsFileU16BE(out, header.task_id_len);
+    out = PutEsFileU16BE(out, header.file_name_len);
+    out = PutEsFileU16BE(out, header.flags);
+    out = PutEsFileU32BE(out, header.seq);
+    out = PutEsFileU64BE(out, header.data_offset);
+    out = PutEsFileU32BE(out, header.payload_len);
+    out = PutEsFileU64BE(out, header.file_size);
+    out = PutEsFileU32BE(out, header.crc32);
+    out = PutEsFileU32BE(out, header.total_len);
+    return PutEsFileU32BE(out, header.reserved);
+}
+
 bool DecodeEsFilePacketHeader(const uint8_t *data, size_t size,
                               EsFilePacketHeader &header) {
     if (!data || size < kEsFileFixedHeaderSize) {
@@ -138,6 +188,7 @@ bool IsEsFilePacketTypeKnown(EsFilePacketType type) {
     case EsFilePacketType::FileChunk:
     case EsFilePacketType::FileEnd:
     case EsFilePacketType::TaskStatus:
+    case EsFilePacketType::FileParity:
         return true;
     default:
         return false;
@@ -156,6 +207,8 @@ std::string EsFilePacketTypeToString(EsFilePacketType type){
             return "FileEnd";
         case EsFilePacketType::TaskStatus:
             return "TaskStatus";
+        case EsFilePacketType::FileParity:
+            return "FileParity";
         default:
             return "Unknown";
     }
@@ -16,7 +16,9 @@ enum class EsFilePacketType : uint8_t {
     // 文件结束包
     FileEnd = 3,
     // 任务状态包
-    TaskStatus = 4
+    TaskStatus = 4,
+    // FileChunk 异或校验包
+    FileParity = 5
 };
 
 // 固定头逻辑模型（线协议固定为 48 字节，整数字段均为大端）。
@@ -68,6 +70,12 @@ extern const size_t kEsFileFixedHeaderSize;
 extern const uint16_t kEsFileFlagFileInfoHasHttpResponseHeaders;
 extern const uint16_t kEsFileFlagPayloadEscaped;
 extern const uint16_t kEsFileFlagFileInfoPayloadBase64;
+extern const uint16_t kEsFileFlagPayloadCrc32c;
+extern const uint16_t kEsFileFlagFileInfoResume;
+extern const uint16_t kEsFileFlagFecProtected;
+extern const uint16_t kEsFileFlagPayloadLz4;
+extern const uint16_t kEsFileFlagPayloadZstd;
+extern const uint16_t kEsFileFlagStriped;
 extern const uint8_t kEsFileCarrierNalHeader;
 extern const size_t kEsFileCarrierPrefixSize;
 extern const size_t kEsFileCarrierShortPrefixSize;
@@ -86,6 +94,9 @@ bool DetectEsFileCarrierPrefixSize(const uint8_t *data, size_t size,
 bool HasEsFileCarrierPrefix(const uint8_t *data, size_t size);
 void AppendEsFilePacketHeader(std::vector<uint8_t> &out,
                               const EsFilePacketHeader &header);
+// 直接写入调用方预分配的缓冲，返回写入后的位置
+uint8_t *WriteEsFileCarrierPrefix(uint8_t *out);
+uint8_t *WriteEsFilePacketHeader(uint8_t *out, const EsFilePacketHeader &header);
 bool DecodeEsFilePacketHeader(const uint8_t *data, size_t size,
                               EsFilePacketHeader &header);
 bool IsEsFilePacketTypeKnown(EsFilePacketType type);
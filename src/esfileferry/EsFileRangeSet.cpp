@@ -0,0 +1,69 @@
+﻿#include "EsFileRangeSet.h"
+
+#include <algorithm>
+#include <iterator>
+
+uint64_t EsFileRangeSet::add(uint64_t begin, uint64_t end) {
+  if (begin >= end) {
+    return 0;
+  }
+  // 从第一个可能与 [begin, end) 重叠或相邻的区间开始依次合并
+  auto it = _ranges.upper_bound(begin);
+  if (it != _ranges.begin()) {
+    auto prev = std::prev(it);
+    if (prev->second >= begin) {
+      it = prev;
+    }
+  }
+  uint64_t merged_bytes = 0;
+  while (it != _ranges.end() && it->first <= end) {
+    merged_bytes += it->second - it->first;
+    begin = std::min(begin, it->first);
+    end = std::max(end, it->second);
+    it = _ranges.erase(it);
+  }
+  _ranges.emplace(begin, end);
+  const auto added = (end - begin) - merged_bytes;
+  _covered_bytes += added;
+  return added;
+}
+
+void EsFileRangeSet::clear() {
+  _ranges.clear();
+  _covered_bytes = 0;
+}
+
+bool EsFileRangeSet::covers(uint64_t begin, uint64_t end) const {
+  if (begin >= end) {
+    return true;
+  }
+  auto it = _ranges.upper_bound(begin);
+  if (it == _ranges.begin()) {
+    return false;
+  }
+  --it;
+  return it->first <= begin && it->second >= end;
+}
+
+std::vector<EsFileRangeSet::Range> EsFileRangeSet::ranges() const {
+  return std::vector<Range>(_ranges.begin(), _ranges.end());
+}
+
+std::vector<EsFileRangeSet::Range>
+EsFileRangeSet::missing(uint64_t file_size) const {
+  std::vector<Range> result;
+  uint64_t cursor = 0;
+  for (const auto &range : _ranges) {
+    if (range.first >= file_size) {
+      break;
+    }
+    if (range.first > cursor) {
+      result.emplace_back(cursor, range.first);
+    }
+    cursor = std::max(cursor, range.second);
+  }
+  if (cursor < file_size) {
+    result.emplace_back(cursor, file_size);
+  }
+  return result;
+}
@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+// 字节区间集合，元素为 [begin, end)，相邻/重叠区间自动合并。
+// 接收侧用于记录已收到的区间并计算缺失区间，发送侧用于规整续传/补发区间；非线程安全，由调用方加锁。
+class EsFileRangeSet {
+public:
+    using Range = std::pair<uint64_t, uint64_t>;
+
+    // 加入 [begin, end)，返回其中新增覆盖的字节数
+    uint64_t add(uint64_t begin, uint64_t end);
+    void clear();
+
+    bool empty() const { return _ranges.empty(); }
+    // 已覆盖的字节数
+    uint64_t coveredBytes() const { return _covered_bytes; }
+    // [begin, end) 是否已被完全覆盖
+    bool covers(uint64_t begin, uint64_t end) const;
+    // 已合并的区间，按起始偏移升序
+    std::vector<Range> ranges() const;
+    // [0, file_size) 内未覆盖的区间
+    std::vector<Range> missing(uint64_t file_size) const;
+
+private:
+    std::map<uint64_t, uint64_t> _ranges;
+    uint64_t _covered_bytes = 0;
+};
@@ -5,6 +5,7 @@
 #include <curl/curl.h>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -13,6 +14,9 @@ namespace {
 constexpr float kDefaultHttpStreamTimeoutSec = 0.0f;
 constexpr long kDefaultHttpConnectTimeoutMs = 30 * 1000;
 constexpr long kDefaultCurlBufferSize = 512 * 1024;
+// 存在暂停的传输时的重试间隔，与消费方腾出空间的粒度相当
+constexpr int kPausedTransferRetryMs = 20;
+constexpr int kIdlePollMs = 1000;
 
 std::string toLowerCopy(std::string value) {
   std::transform(value.begin(), value.end(), value.begin(),
@@ -264,6 +268,59 @@ bool setupCurlRequest(CURL *curl, const std::string &url,
   return false;
 }
 
+bool finishCurlRequest(CURL *curl, CURLcode code, CurlRequestContext &ctx,
+                       HttpStreamFetcher::HttpHeaders *response_headers,
+                       uint32_t *response_status_code, std::string &err,
+                       HttpStreamFetcher::TransferDiagnostics *diagnostics) {
+  long response_code = 0;
+  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+  if (response_code > 0 && ctx.pending_status_code == 0) {
+    ctx.pending_status_code = static_cast<uint32_t>(response_code);
+  }
+  ctx.emitHeadersIfReady();
+  if (ctx.status_code == 0 && response_code > 0) {
+    ctx.status_code = static_cast<uint32_t>(response_code);
+  }
+
+  if (response_status_code) {
+    *response_status_code = ctx.status_code;
+  }
+  if (response_headers) {
+    *response_headers = ctx.response_headers;
+  }
+  if (diagnostics) {
+    diagnostics->status_code = ctx.status_code;
+    diagnostics->headers_emitted = ctx.headers_emitted;
+    diagnostics->name_lookup_ms = getCurlTimeMs(curl, CURLINFO_NAMELOOKUP_TIME);
+    diagnostics->connect_ms = getCurlTimeMs(curl, CURLINFO_CONNECT_TIME);
+    diagnostics->app_connect_ms = getCurlTimeMs(curl, CURLINFO_APPCONNECT_TIME);
+    diagnostics->pretransfer_ms = getCurlTimeMs(curl, CURLINFO_PRETRANSFER_TIME);
+    diagnostics->starttransfer_ms = getCurlTimeMs(curl, CURLINFO_STARTTRANSFER_TIME);
+    diagnostics->total_ms = getCurlTimeMs(curl, CURLINFO_TOTAL_TIME);
+    diagnostics->download_bytes =
+        getCurlDoubleInfo(curl, CURLINFO_SIZE_DOWNLOAD);
+    diagnostics->content_length_bytes =
+        getCurlDoubleInfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD);
+    diagnostics->download_speed_bytes_per_sec =
+        getCurlDoubleInfo(curl, CURLINFO_SPEED_DOWNLOAD);
+  }
+
+  if (!ctx.consumer_ok) {
+    err = ctx.consumer_err.empty() ? "consume http payload failed"
+                                   : ctx.consumer_err;
+    return false;
+  }
+  if (code != CURLE_OK) {
+    err = mapCurlError(code, ctx);
+    return false;
+  }
+  if (ctx.status_code < 200 || ctx.status_code >= 300) {
+    err = "http status " + std::to_string(ctx.status_code);
+    return false;
+  }
+  return true;
+}
+
 } // namespace
 
 bool HttpStreamFetcher::stream(const std::string &url,
@@ -304,54 +361,256 @@ bool HttpStreamFetcher::stream(const std::string &url,
   }
 
   const auto code = curl_easy_perform(curl);
-  long response_code = 0;
-  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
-  if (response_code > 0 && ctx.pending_status_code == 0) {
-    ctx.pending_status_code = static_cast<uint32_t>(response_code);
+  const auto ok = finishCurlRequest(curl, code, ctx, response_headers,
+                                    response_status_code, err, diagnostics);
+  curl_slist_free_all(request_headers);
+  curl_easy_cleanup(curl);
+  return ok;
+}
+
+struct HttpFetchEngine::Transfer {
+  CURL *curl = nullptr;
+  curl_slist *request_headers = nullptr;
+  // POSTFIELDS 不拷贝请求体，需与传输同生命周期
+  std::string body;
+  CurlRequestContext ctx;
+  OnData on_data;
+  OnComplete on_complete;
+  // 消费方尚未接收的数据，非空时传输处于暂停状态
+  std::string staged;
+  size_t staged_offset = 0;
+  bool paused = false;
+
+  ~Transfer() {
+    curl_slist_free_all(request_headers);
+    if (curl) {
+      curl_easy_cleanup(curl);
+    }
   }
-  ctx.emitHeadersIfReady();
-  if (ctx.status_code == 0 && response_code > 0) {
-    ctx.status_code = static_cast<uint32_t>(response_code);
+
+  void complete(CURLcode code, const char *override_err = nullptr) {
+    HttpHeaders response_headers;
+    uint32_t status_code = 0;
+    std::string err;
+    HttpStreamFetcher::TransferDiagnostics diagnostics;
+    auto ok = finishCurlRequest(curl, code, ctx, &response_headers,
+                                &status_code, err, &diagnostics);
+    if (override_err) {
+      ok = false;
+      err = override_err;
+    }
+    if (on_complete) {
+      on_complete(ok, status_code, response_headers, err, diagnostics);
+    }
   }
+};
 
-  if (response_status_code) {
-    *response_status_code = ctx.status_code;
+HttpFetchEngine::HttpFetchEngine() {
+  ensureCurlGlobalInit();
+  _multi = curl_multi_init();
+  if (_multi) {
+    _thread = std::thread([this]() { run(); });
   }
-  if (response_headers) {
-    *response_headers = ctx.response_headers;
+}
+
+HttpFetchEngine::~HttpFetchEngine() {
+  shutdown();
+  if (_multi) {
+    curl_multi_cleanup(static_cast<CURLM *>(_multi));
   }
-  if (diagnostics) {
-    diagnostics->status_code = ctx.status_code;
-    diagnostics->headers_emitted = ctx.headers_emitted;
-    diagnostics->name_lookup_ms = getCurlTimeMs(curl, CURLINFO_NAMELOOKUP_TIME);
-    diagnostics->connect_ms = getCurlTimeMs(curl, CURLINFO_CONNECT_TIME);
-    diagnostics->app_connect_ms = getCurlTimeMs(curl, CURLINFO_APPCONNECT_TIME);
-    diagnostics->pretransfer_ms = getCurlTimeMs(curl, CURLINFO_PRETRANSFER_TIME);
-    diagnostics->starttransfer_ms = getCurlTimeMs(curl, CURLINFO_STARTTRANSFER_TIME);
-    diagnostics->total_ms = getCurlTimeMs(curl, CURLINFO_TOTAL_TIME);
-    diagnostics->download_bytes =
-        getCurlDoubleInfo(curl, CURLINFO_SIZE_DOWNLOAD);
-    diagnostics->content_length_bytes =
-        getCurlDoubleInfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD);
-    diagnostics->download_speed_bytes_per_sec =
-        getCurlDoubleInfo(curl, CURLINFO_SPEED_DOWNLOAD);
+}
+
+bool HttpFetchEngine::start(const std::string &url,
+                            const std::string &method,
+                            const HttpHeaders &headers,
+                            const std::string &body,
+                            OnData on_data,
+                            OnHeaders on_headers,
+                            OnComplete on_complete,
+                            std::string &err) {
+  err.clear();
+  if (!_multi) {
+    err = "curl_multi_init failed";
+    return false;
   }
 
-  curl_slist_free_all(request_headers);
-  curl_easy_cleanup(curl);
+  std::unique_ptr<Transfer> transfer(new Transfer());
+  transfer->body = body;
+  transfer->on_data = std::move(on_data);
+  transfer->on_complete = std::move(on_complete);
+  transfer->ctx.on_headers = std::move(on_headers);
+  auto *raw = transfer.get();
+  transfer->ctx.on_chunk = [raw](const uint8_t *data, size_t size) {
+    if (raw->paused) {
+      // 暂停生效前 curl 仍可能继续投递已缓存的数据，追加到暂存区以保证顺序
+      raw->staged.append(reinterpret_cast<const char *>(data), size);
+      return true;
+    }
+    const auto consumed = raw->on_data(data, size);
+    if (consumed < 0) {
+      return false;
+    }
+    if (static_cast<uint64_t>(consumed) < size) {
+      // curl 写回调不能只接收部分数据，剩余部分暂存后暂停接收
+      raw->staged.assign(reinterpret_cast<const char *>(data) + consumed,
+                         size - static_cast<size_t>(consumed));
+      raw->staged_offset = 0;
+      raw->paused = true;
+      curl_easy_pause(raw->curl, CURLPAUSE_RECV);
+    }
+    return true;
+  };
 
-  if (!ctx.consumer_ok) {
-    err = ctx.consumer_err.empty() ? "consume http payload failed"
-                                   : ctx.consumer_err;
+  transfer->curl = curl_easy_init();
+  if (!transfer->curl) {
+    err = "curl_easy_init failed";
     return false;
   }
-  if (code != CURLE_OK) {
-    err = mapCurlError(code, ctx);
+  const auto effective_headers = makeEffectiveHeaders(headers);
+  transfer->request_headers = buildCurlHeaderList(effective_headers);
+  if (!effective_headers.empty() && !transfer->request_headers) {
+    err = "build curl headers failed";
     return false;
   }
-  if (ctx.status_code < 200 || ctx.status_code >= 300) {
-    err = "http status " + std::to_string(ctx.status_code);
+  if (!setupCurlRequest(transfer->curl, url, method, transfer->body,
+                        transfer->request_headers, &transfer->ctx, err)) {
     return false;
   }
+
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_exit) {
+      err = "http fetch engine stopped";
+      return false;
+    }
+    _incoming.emplace_back(std::move(transfer));
+  }
+  curl_multi_wakeup(static_cast<CURLM *>(_multi));
+  return true;
+}
+
+void HttpFetchEngine::wakeup() {
+  if (!_multi || _wakeup_pending.exchange(true)) {
+    return;
+  }
+  curl_multi_wakeup(static_cast<CURLM *>(_multi));
+}
+
+void HttpFetchEngine::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_exit) {
+      return;
+    }
+    _exit = true;
+  }
+  if (_multi) {
+    curl_multi_wakeup(static_cast<CURLM *>(_multi));
+  }
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+}
+
+bool HttpFetchEngine::resumeTransfer(Transfer &transfer) {
+  while (transfer.staged_offset < transfer.staged.size()) {
+    const auto remain = transfer.staged.size() - transfer.staged_offset;
+    const auto consumed = transfer.on_data(
+        reinterpret_cast<const uint8_t *>(transfer.staged.data()) +
+            transfer.staged_offset,
+        remain);
+    if (consumed < 0) {
+      transfer.ctx.consumer_ok = false;
+      transfer.ctx.consumer_err = "consume http payload failed";
+      return false;
+    }
+    if (consumed == 0) {
+      return true;
+    }
+    transfer.staged_offset +=
+        std::min<size_t>(static_cast<size_t>(consumed), remain);
+  }
+  transfer.staged.clear();
+  transfer.staged_offset = 0;
+  transfer.paused = false;
+  // 恢复时 curl 可能同步回调写函数，并再次暂停
+  curl_easy_pause(transfer.curl, CURLPAUSE_CONT);
   return true;
 }
+
+void HttpFetchEngine::run() {
+  auto *multi = static_cast<CURLM *>(_multi);
+  std::unordered_map<CURL *, std::unique_ptr<Transfer>> running;
+  auto finish = [&](CURL *curl, CURLcode code, const char *override_err) {
+    auto it = running.find(curl);
+    if (it == running.end()) {
+      return;
+    }
+    auto transfer = std::move(it->second);
+    running.erase(it);
+    curl_multi_remove_handle(multi, curl);
+    transfer->complete(code, override_err);
+  };
+
+  while (true) {
+    std::vector<std::unique_ptr<Transfer>> incoming;
+    bool exit = false;
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      incoming.swap(_incoming);
+      exit = _exit;
+    }
+    for (auto &transfer : incoming) {
+      auto *curl = transfer->curl;
+      if (exit || curl_multi_add_handle(multi, curl) != CURLM_OK) {
+        transfer->complete(CURLE_FAILED_INIT,
+                           exit ? "http fetch engine stopped"
+                                : "curl_multi_add_handle failed");
+        continue;
+      }
+      running.emplace(curl, std::move(transfer));
+    }
+    if (exit) {
+      while (!running.empty()) {
+        finish(running.begin()->first, CURLE_ABORTED_BY_CALLBACK,
+               "http fetch engine stopped");
+      }
+      break;
+    }
+
+    // 先清除标记再重试，之后的 wakeup() 会打断下一次 poll
+    _wakeup_pending.store(false);
+    std::vector<CURL *> aborted;
+    for (auto &item : running) {
+      if (item.second->paused && !resumeTransfer(*item.second)) {
+        aborted.emplace_back(item.first);
+      }
+    }
+    for (auto *curl : aborted) {
+      finish(curl, CURLE_WRITE_ERROR, nullptr);
+    }
+
+    int still_running = 0;
+    curl_multi_perform(multi, &still_running);
+    int msgs_left = 0;
+    while (auto *msg = curl_multi_info_read(multi, &msgs_left)) {
+      if (msg->msg != CURLMSG_DONE) {
+        continue;
+      }
+      // remove_handle 后 msg 失效，先取出结果
+      auto *curl = msg->easy_handle;
+      const auto code = msg->data.result;
+      finish(curl, code, nullptr);
+    }
+
+    bool has_paused = false;
+    for (const auto &item : running) {
+      if (item.second->paused) {
+        has_paused = true;
+        break;
+      }
+    }
+    curl_multi_poll(multi, nullptr, 0,
+                    has_paused ? kPausedTransferRetryMs : kIdlePollMs, nullptr);
+  }
+}
@@ -1,8 +1,12 @@
 ﻿#pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -37,3 +41,53 @@ public:
                        std::string &err,
                        TransferDiagnostics *diagnostics = nullptr);
 };
+
+// 基于 curl multi 的 HTTP 拉取引擎，由单个线程驱动全部传输。
+// 消费回调不可阻塞：消费不完的数据由引擎暂存并暂停该传输，
+// 之后周期性或在 wakeup() 后重试，直到消费方腾出空间。
+class HttpFetchEngine {
+public:
+    using HttpHeaders = HttpStreamFetcher::HttpHeaders;
+    // 返回本次消费的字节数，小于 size 时暂停该传输，小于 0 时中止该传输
+    using OnData = std::function<int64_t(const uint8_t *, size_t)>;
+    using OnHeaders = HttpStreamFetcher::OnHeaders;
+    using OnComplete = std::function<void(
+        bool ok, uint32_t status_code, const HttpHeaders &response_headers,
+        const std::string &err,
+        const HttpStreamFetcher::TransferDiagnostics &diagnostics)>;
+
+    HttpFetchEngine();
+    ~HttpFetchEngine();
+
+    // 提交一个传输，回调均在引擎线程触发；返回 false 时不会触发 on_complete
+    bool start(const std::string &url,
+               const std::string &method,
+               const HttpHeaders &headers,
+               const std::string &body,
+               OnData on_data,
+               OnHeaders on_headers,
+               OnComplete on_complete,
+               std::string &err);
+    // 消费方腾出空间后调用，立即重试已暂停的传输，可在任意线程调用
+    void wakeup();
+    // 停止引擎线程，未完成的传输以失败结束
+    void shutdown();
+
+private:
+    struct Transfer;
+
+    HttpFetchEngine(const HttpFetchEngine &) = delete;
+    HttpFetchEngine &operator=(const HttpFetchEngine &) = delete;
+
+    void run();
+    // 重新投递暂存数据并恢复传输，返回 false 表示消费方要求中止
+    bool resumeTransfer(Transfer &transfer);
+
+private:
+    void *_multi = nullptr;
+    std::mutex _mtx;
+    bool _exit = false;
+    std::atomic_bool _wakeup_pending{false};
+    std::vector<std::unique_ptr<Transfer>> _incoming;
+    std::thread _thread;
+};
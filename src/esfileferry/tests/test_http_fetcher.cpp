@@ -1,5 +1,6 @@
 ﻿#include "../HttpStreamFetcher.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cctype>
@@ -188,5 +189,79 @@ int main() {
     assert(post_text.find("\"request_size\":8192") != std::string::npos);
     assert(post_text.size() > 1024 * 1024);
 
+    // curl multi 引擎：消费方只接收部分数据或暂不接收时，传输暂停后续传且数据不丢失、不乱序
+    HttpFetchEngine engine;
+    std::atomic<int> engine_done{0};
+    std::string engine_text;
+    size_t engine_calls = 0;
+    bool engine_ok = false;
+    uint32_t engine_status = 0;
+    std::string engine_err;
+    std::string start_err;
+    bool started = engine.start(
+        http_base + "/large", "GET", {}, "",
+        [&engine_text, &engine_calls](const uint8_t *data, size_t size) -> int64_t {
+            if (++engine_calls % 2 == 0) {
+                return 0;
+            }
+            const auto accept = std::min<size_t>(size, 64 * 1024);
+            engine_text.append(reinterpret_cast<const char *>(data), accept);
+            return static_cast<int64_t>(accept);
+        },
+        nullptr,
+        [&](bool ok, uint32_t code, const HttpStreamFetcher::HttpHeaders &,
+            const std::string &fetch_err, const HttpStreamFetcher::TransferDiagnostics &) {
+            engine_ok = ok;
+            engine_status = code;
+            engine_err = fetch_err;
+            ++engine_done;
+        },
+        start_err);
+    assert(started);
+    while (engine_done.load() == 0) {
+        engine.wakeup();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    assert(engine_ok);
+    assert(engine_err.empty());
+    assert(engine_status == 200);
+    assert(engine_text == std::string(2 * 1024 * 1024, 'L'));
+
+    std::string abort_err;
+    started = engine.start(
+        http_base + "/large", "GET", {}, "",
+        [](const uint8_t *, size_t) -> int64_t { return -1; },
+        nullptr,
+        [&](bool ok, uint32_t, const HttpStreamFetcher::HttpHeaders &,
+            const std::string &fetch_err, const HttpStreamFetcher::TransferDiagnostics &) {
+            assert(!ok);
+            abort_err = fetch_err;
+            ++engine_done;
+        },
+        start_err);
+    assert(started);
+    while (engine_done.load() == 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    assert(abort_err == "consume http payload failed");
+
+    std::string stop_err;
+    started = engine.start(
+        http_base + "/large", "GET", {}, "",
+        [](const uint8_t *, size_t) -> int64_t { return 0; },
+        nullptr,
+        [&](bool ok, uint32_t, const HttpStreamFetcher::HttpHeaders &,
+            const std::string &fetch_err, const HttpStreamFetcher::TransferDiagnostics &) {
+            assert(!ok);
+            stop_err = fetch_err;
+            ++engine_done;
+        },
+        start_err);
+    assert(started);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    engine.shutdown();
+    assert(engine_done.load() == 3);
+    assert(stop_err == "http fetch engine stopped");
+
     return 0;
 }
@@ -1,5 +1,7 @@
 ﻿#include "../EsFileFerryPacker.h"
 #include "../EsFilePayloadProtocol.h"
+#include "../EsFileAnnexBEscape.h"
+#include "../EsFileCrc32c.h"
 #include <algorithm>
 #include <atomic>
 #include <cassert>
@@ -10,6 +12,7 @@
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -109,6 +112,154 @@ void writeFile(const std::string &path, char fill, size_t size) {
     ofs.flush();
 }
 
+std::vector<uint8_t> unescapeAnnexB(const uint8_t *data, size_t size) {
+    std::vector<uint8_t> out;
+    out.reserve(size);
+    int zero_count = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (zero_count >= 2 && data[i] == 0x03) {
+            zero_count = 0;
+            continue;
+        }
+        out.push_back(data[i]);
+        zero_count = data[i] == 0x00 ? zero_count + 1 : 0;
+    }
+    return out;
+}
+
+std::vector<uint8_t> escapeAnnexBReference(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    out.reserve(data.size() + data.size() / 2);
+    int zero_count = 0;
+    for (const auto byte : data) {
+        if (zero_count >= 2 && byte <= 0x03) {
+            out.push_back(0x03);
+            zero_count = 0;
+        }
+        out.push_back(byte);
+        zero_count = byte == 0x00 ? zero_count + 1 : 0;
+    }
+    return out;
+}
+
+// zero_percent 为 0x00 所占百分比，其余字节中一半取 0x01~0x03 以触发转义
+std::vector<uint8_t> makeAnnexBPayload(size_t size, uint32_t zero_percent,
+                                       std::mt19937 &rng) {
+    std::vector<uint8_t> out(size);
+    for (auto &byte : out) {
+        const auto roll = rng() % 100;
+        if (roll < zero_percent) {
+            byte = 0x00;
+        } else if (zero_percent > 0 && roll % 2 == 0) {
+            byte = static_cast<uint8_t>(1 + rng() % 3);
+        } else {
+            byte = static_cast<uint8_t>(rng());
+        }
+    }
+    return out;
+}
+
+// 转义内核与逐字节参考实现逐字节比对，并输出随机/高 0x00 负载下的吞吐
+void runAnnexBEscapeTests() {
+    std::mt19937 rng(20240601);
+    const uint32_t zero_percents[] = {0, 10, 50, 90};
+    for (size_t round = 0; round < 4000; ++round) {
+        const auto payload = makeAnnexBPayload(
+            rng() % 300, zero_percents[round % 4], rng);
+        const auto expected = escapeAnnexBReference(payload);
+        // 随机切分输入，覆盖跨段延续的转义状态
+        EsFileAnnexBEscapeState scan_state;
+        EsFileAnnexBEscapeState escape_state;
+        size_t inserted = 0;
+        std::vector<uint8_t> escaped(payload.size() * 2 + 1);
+        auto *out = escaped.data();
+        size_t offset = 0;
+        while (offset < payload.size()) {
+            const auto step = std::min<size_t>(payload.size() - offset, 1 + rng() % 70);
+            inserted += ScanEsFileAnnexBEscape(payload.data() + offset, step, scan_state);
+            out = EscapeEsFileAnnexB(payload.data() + offset, step, out, escape_state);
+            offset += step;
+        }
+        escaped.resize(static_cast<size_t>(out - escaped.data()));
+        assert(inserted + payload.size() == expected.size());
+        assert(escaped == expected);
+    }
+
+    const size_t bench_bytes = 32 * 1024 * 1024;
+    for (const auto zero_percent : {0u, 50u}) {
+        const auto payload = makeAnnexBPayload(bench_bytes, zero_percent, rng);
+        std::vector<uint8_t> escaped(payload.size() * 2);
+        const auto begin = std::chrono::steady_clock::now();
+        EsFileAnnexBEscapeState scan_state;
+        const auto inserted = ScanEsFileAnnexBEscape(payload.data(), payload.size(), scan_state);
+        EsFileAnnexBEscapeState escape_state;
+        auto *out = EscapeEsFileAnnexB(payload.data(), payload.size(), escaped.data(), escape_state);
+        const auto kernel_cost = std::chrono::steady_clock::now() - begin;
+        assert(static_cast<size_t>(out - escaped.data()) == payload.size() + inserted);
+        const auto reference_begin = std::chrono::steady_clock::now();
+        const auto expected = escapeAnnexBReference(payload);
+        const auto reference_cost = std::chrono::steady_clock::now() - reference_begin;
+        assert(expected.size() == payload.size() + inserted);
+        assert(std::equal(expected.begin(), expected.end(), escaped.begin()));
+        const auto mbps = [&](std::chrono::steady_clock::duration cost) {
+            return static_cast<double>(bench_bytes) / (1024 * 1024) /
+                   std::max(std::chrono::duration<double>(cost).count(), 1e-9);
+        };
+        std::printf("annexb escape zero_percent:%u scan+escape:%.0fMB/s reference:%.0fMB/s\n",
+                    zero_percent, mbps(kernel_cost), mbps(reference_cost));
+    }
+}
+
+uint32_t crc32cReference(const uint8_t *data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78 : 0);
+        }
+    }
+    return ~crc;
+}
+
+void runCrc32cTests() {
+    const std::string check = "123456789";
+    assert(UpdateEsFileCrc32c(0, reinterpret_cast<const uint8_t *>(check.data()), check.size()) ==
+           0xE3069283);
+    assert(UpdateEsFileCrc32c(0, nullptr, 0) == 0);
+    // RFC 3720 B.4：32 字节全 0 / 全 0xFF
+    const std::vector<uint8_t> zeros(32, 0x00);
+    const std::vector<uint8_t> ones(32, 0xFF);
+    assert(UpdateEsFileCrc32c(0, zeros.data(), zeros.size()) == 0x8A9136AA);
+    assert(UpdateEsFileCrc32c(0, ones.data(), ones.size()) == 0x62A8AB43);
+
+    // 随机起始地址与切分，覆盖未对齐头部、8 字节主循环与尾部
+    std::mt19937 rng(20240715);
+    std::vector<uint8_t> data(4096 + 64);
+    for (auto &byte : data) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    for (size_t round = 0; round < 2000; ++round) {
+        const auto begin = rng() % 64;
+        const auto size = rng() % 4096;
+        const auto split = size == 0 ? 0 : rng() % size;
+        auto crc = UpdateEsFileCrc32c(0, data.data() + begin, split);
+        crc = UpdateEsFileCrc32c(crc, data.data() + begin + split, size - split);
+        assert(crc == crc32cReference(data.data() + begin, size));
+    }
+
+    const size_t bench_bytes = 64 * 1024 * 1024;
+    std::vector<uint8_t> payload(bench_bytes);
+    for (auto &byte : payload) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    const auto crc = UpdateEsFileCrc32c(0, payload.data(), payload.size());
+    const auto cost = std::chrono::steady_clock::now() - begin;
+    std::printf("crc32c bench crc:%08x speed:%.0fMB/s\n", crc,
+                static_cast<double>(bench_bytes) / (1024 * 1024) /
+                    std::max(std::chrono::duration<double>(cost).count(), 1e-9));
+}
+
 std::string makeTempFilePath() {
     const auto unique_name =
         "esfileferry_packer_test_" +
@@ -125,6 +276,8 @@ int main() {
     // 启动异步日志线程  [AUTO-TRANSLATED:c93cc6f4]
     // Start asynchronous log thread
     Logger::Instance().setWriter(std::make_shared<AsyncLogWriter>());
+    runAnnexBEscapeTests();
+    runCrc32cTests();
     // 启动一个http server主要是为了测试 api或者是mp4文件用
     auto rtspSrv = std::make_shared<toolkit::TcpServer>();
     rtspSrv->start<mediakit::HttpSession>(0, "127.0.0.1");
@@ -706,6 +859,61 @@ int main() {
     packer.setGlobalOptions(EsFileGlobalOptions{});
     clearCollectedPackets();
 
+    // 零拷贝回调：包取自缓冲池，转义与 PacketCallback 一致
+    std::vector<std::vector<uint8_t>> zero_copy_packets;
+    std::atomic<bool> zero_copy_end{false};
+    packer.setPacketBufferCallback([&](const std::string &task_id,
+                                       const toolkit::Buffer::Ptr &packet,
+                                       const EsFilePacketHeader &header) {
+        if (task_id != "zero_copy_task") {
+            return;
+        }
+        assert(packet);
+        const auto *data = reinterpret_cast<const uint8_t *>(packet->data());
+        std::lock_guard<std::mutex> lock(mtx);
+        zero_copy_packets.emplace_back(data, data + packet->size());
+        if (header.type == EsFilePacketType::FileEnd) {
+            zero_copy_end = true;
+        }
+    });
+    std::string zero_copy_payload;
+    for (size_t i = 0; i < 64 * 1024; ++i) {
+        zero_copy_payload.append(i % 2 ? std::string("\x00\x00\x01", 3) : std::string("zl"));
+    }
+    const std::string zero_copy_file = makeTempFilePath();
+    {
+        std::ofstream ofs(zero_copy_file, std::ios::binary);
+        ofs.write(zero_copy_payload.data(), static_cast<std::streamsize>(zero_copy_payload.size()));
+    }
+    assert(packer.addFileTask("zero_copy_task", zero_copy_file, "zero_copy.bin"));
+    assert(waitUntil(std::chrono::milliseconds(5000), [&]() { return zero_copy_end.load(); }));
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::string rebuilt;
+        for (const auto &raw : zero_copy_packets) {
+            assert(HasEsFileCarrierPrefix(raw.data(), raw.size()));
+            EsFilePacketHeader header;
+            assert(DecodeEsFilePacketHeader(raw.data() + kEsFileCarrierPrefixSize,
+                                            raw.size() - kEsFileCarrierPrefixSize, header));
+            if (header.type != EsFilePacketType::FileChunk) {
+                continue;
+            }
+            assert((header.flags & kEsFileFlagPayloadEscaped) != 0);
+            const auto payload_pos = kEsFileCarrierPrefixSize + kEsFileFixedHeaderSize +
+                                     header.task_id_len + header.file_name_len;
+            // 头部长度为转义前长度，包体长度包含插入的转义字节
+            assert(raw.size() > payload_pos + header.payload_len);
+            const auto payload = unescapeAnnexB(raw.data() + payload_pos, raw.size() - payload_pos);
+            assert(payload.size() == header.payload_len);
+            assert(header.data_offset == rebuilt.size());
+            rebuilt.append(payload.begin(), payload.end());
+        }
+        assert(rebuilt == zero_copy_payload);
+    }
+    packer.clearTasks();
+    packer.setPacketCallback(packet_collector);
+    File::delete_file(zero_copy_file, false);
+
     const std::string tmp_file = makeTempFilePath();
     writeFile(tmp_file, 'x', 400);
 
@@ -721,6 +929,11 @@ int main() {
     assert(!packer.addHttpTask("bad_api_task", http_base + "/path", "PUT", headers, "{\"a\":1}", "bad_api.txt"));
     assert(!packer.getLastError().empty());
     assert(packer.addHttpTask("api_task", http_base + "/path", "POST", headers, "{\"a\":1}", "api.txt"));
+    // 续传/补发会按区间重放请求，POST 源直接拒绝
+    assert(!packer.addResumeTask("bad_resume_task", http_base + "/path", 100, "POST", headers, "{\"a\":1}", "api.txt"));
+    assert(!packer.getLastError().empty());
+    assert(!packer.addRangeTask("bad_range_task", http_base + "/path", {{0, 10}, {20, 30}}, "POST", headers, "{\"a\":1}", "api.txt"));
+    assert(!packer.getLastError().empty());
     assert(packer.addHttpTask("http_file_task", http_base + "/test/1.mp4", "GET", {}, "", "1.mp4"));
     EsFileFerryPacker::HttpHeaders doc_headers = {{"Sec-Fetch-Dest", "document"}, {"Accept", "text/html,*/*;q=0.8"}};
     assert(packer.addHttpTask("http_file_document_task", http_base + "/test/1.mp4", "GET", doc_headers, "", "1.mp4"));
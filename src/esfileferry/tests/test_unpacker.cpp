@@ -1,21 +1,105 @@
 ﻿#include "../EsFileFerryPacker.h"
 #include "../EsFileFerryPlayer.h"
+#include "../EsFileFerrySink.h"
+#include "../EsFileAnnexBEscape.h"
+#include "../EsFileCompress.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
 #include <curl/curl.h>
 #include <iostream>
+#include <iterator>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <mutex>
+#include <random>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "Util/File.h"
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
 namespace {
+// 最小 HTTP 源站：每个连接读完请求头后返回同一份 body 并关闭，仅供本测试的 HTTP 任务使用
+class LocalHttpServer {
+public:
+    explicit LocalHttpServer(std::string body) : _body(std::move(body)) {
+        _fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        assert(_fd >= 0);
+        int reuse = 1;
+        ::setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        assert(::bind(_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0);
+        assert(::listen(_fd, 16) == 0);
+        socklen_t len = sizeof(addr);
+        assert(::getsockname(_fd, reinterpret_cast<sockaddr *>(&addr), &len) == 0);
+        _port = ntohs(addr.sin_port);
+        _thread = std::thread([this]() { run(); });
+    }
+
+    ~LocalHttpServer() {
+        _exit = true;
+        ::shutdown(_fd, SHUT_RDWR);
+        ::close(_fd);
+        _thread.join();
+    }
+
+    std::string url(const std::string &path) const {
+        return "http://127.0.0.1:" + std::to_string(_port) + path;
+    }
+
+private:
+    void run() {
+        while (!_exit) {
+            const int conn = ::accept(_fd, nullptr, nullptr);
+            if (conn < 0) {
+                continue;
+            }
+            std::string request;
+            char buf[1024];
+            while (request.find("\r\n\r\n") == std::string::npos) {
+                const auto n = ::recv(conn, buf, sizeof(buf), 0);
+                if (n <= 0) {
+                    break;
+                }
+                request.append(buf, static_cast<size_t>(n));
+            }
+            const std::string response =
+                "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                std::to_string(_body.size()) + "\r\nConnection: close\r\n\r\n" + _body;
+            size_t sent = 0;
+            while (sent < response.size()) {
+                const auto n = ::send(conn, response.data() + sent, response.size() - sent,
+                                      MSG_NOSIGNAL);
+                if (n <= 0) {
+                    break;
+                }
+                sent += static_cast<size_t>(n);
+            }
+            ::close(conn);
+        }
+    }
+
+private:
+    int _fd = -1;
+    uint16_t _port = 0;
+    std::atomic<bool> _exit{false};
+    std::string _body;
+    std::thread _thread;
+};
+
 size_t onHttpWrite(char *ptr, size_t size, size_t nmemb, void *userdata) {
     const auto bytes = size * nmemb;
     auto *out = static_cast<std::string *>(userdata);
@@ -71,6 +155,102 @@ HttpCallResult doHttpCall(const std::string &url,
     return result;
 }
 
+std::vector<uint8_t> unescapeAnnexBReference(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    out.reserve(data.size());
+    int zero_count = 0;
+    for (const auto byte : data) {
+        if (zero_count >= 2 && byte == 0x03) {
+            zero_count = 0;
+            continue;
+        }
+        out.push_back(byte);
+        zero_count = byte == 0x00 ? zero_count + 1 : 0;
+    }
+    return out;
+}
+
+std::vector<uint8_t> escapeAnnexB(const std::vector<uint8_t> &data) {
+    EsFileAnnexBEscapeState scan_state;
+    const auto inserted = ScanEsFileAnnexBEscape(data.data(), data.size(), scan_state);
+    std::vector<uint8_t> out(data.size() + inserted);
+    EsFileAnnexBEscapeState escape_state;
+    EscapeEsFileAnnexB(data.data(), data.size(), out.data(), escape_state);
+    return out;
+}
+
+// zero_percent 为 0x00 所占百分比，其余字节中一半取 0x01~0x03 以触发转义
+std::vector<uint8_t> makeAnnexBPayload(size_t size, uint32_t zero_percent,
+                                       std::mt19937 &rng) {
+    std::vector<uint8_t> out(size);
+    for (auto &byte : out) {
+        const auto roll = rng() % 100;
+        if (roll < zero_percent) {
+            byte = 0x00;
+        } else if (zero_percent > 0 && roll % 2 == 0) {
+            byte = static_cast<uint8_t>(1 + rng() % 3);
+        } else {
+            byte = static_cast<uint8_t>(rng());
+        }
+    }
+    return out;
+}
+
+// 反转义内核与逐字节参考实现比对（含输入不足），并输出随机/高 0x00 负载下的吞吐
+void runAnnexBUnescapeTests() {
+    std::mt19937 rng(20240602);
+    const uint32_t zero_percents[] = {0, 10, 50, 90};
+    for (size_t round = 0; round < 4000; ++round) {
+        const auto payload = makeAnnexBPayload(
+            rng() % 300, zero_percents[round % 4], rng);
+        auto escaped = escapeAnnexB(payload);
+        const auto escaped_size = escaped.size();
+        assert(unescapeAnnexBReference(escaped) == payload);
+        // 包尾之后的字节不能被消耗
+        escaped.push_back(0x03);
+        std::vector<uint8_t> restored(payload.size());
+        size_t consumed = 0;
+        const bool ok = UnescapeEsFileAnnexB(escaped.data(), escaped.size(),
+                                             restored.data(), restored.size(), consumed);
+        assert(ok);
+        assert(consumed == escaped_size);
+        assert(restored == payload);
+        if (!payload.empty()) {
+            // 缺少最后一个原始字节时需要更多数据
+            const bool truncated_ok = UnescapeEsFileAnnexB(
+                escaped.data(), escaped_size - 1, restored.data(), restored.size(), consumed);
+            assert(!truncated_ok);
+        }
+    }
+
+    const size_t bench_bytes = 32 * 1024 * 1024;
+    for (const auto zero_percent : {0u, 50u}) {
+        const auto payload = makeAnnexBPayload(bench_bytes, zero_percent, rng);
+        const auto escaped = escapeAnnexB(payload);
+        std::vector<uint8_t> restored(payload.size());
+        size_t consumed = 0;
+        const auto begin = std::chrono::steady_clock::now();
+        const bool ok = UnescapeEsFileAnnexB(escaped.data(), escaped.size(),
+                                             restored.data(), restored.size(), consumed);
+        const auto kernel_cost = std::chrono::steady_clock::now() - begin;
+        assert(ok);
+        assert(consumed == escaped.size());
+        const auto reference_begin = std::chrono::steady_clock::now();
+        const auto expected = unescapeAnnexBReference(escaped);
+        const auto reference_cost = std::chrono::steady_clock::now() - reference_begin;
+        assert(expected == restored);
+        assert(restored == payload);
+        const auto mbps = [&](std::chrono::steady_clock::duration cost) {
+            return static_cast<double>(bench_bytes) / (1024 * 1024) /
+                   std::max(std::chrono::duration<double>(cost).count(), 1e-9);
+        };
+        std::cout << "annexb unescape zero_percent:" << zero_percent
+                  << " unescape:" << static_cast<uint64_t>(mbps(kernel_cost))
+                  << "MB/s reference:" << static_cast<uint64_t>(mbps(reference_cost))
+                  << "MB/s" << std::endl;
+    }
+}
+
 bool hasVersionShape(const std::string &body) {
     return body.find("\"code\"") != std::string::npos &&
            body.find("\"msg\"") != std::string::npos &&
@@ -84,6 +264,7 @@ std::string makeTempFilePath(const std::string &name) {
 
 int main() {
     curl_global_init(CURL_GLOBAL_DEFAULT);
+    runAnnexBUnescapeTests();
     auto &packer = EsFileFerryPacker::Instance();
     auto &unpacker = EsFileFerryUnPacker::Instance();
     packer.setPacketCallback(nullptr);
@@ -91,13 +272,16 @@ int main() {
     unpacker.clearTasks();
     packer.setChunkSize(4096);
 
+    // 发包线程持有回调副本，置空回调后仍可能在途，退出前需等其结束
+    std::atomic<int> bridge_inflight{0};
     auto bridge_packets_to_unpacker =
-        [&unpacker](const std::string &task_id,
-                    std::vector<uint8_t> &&packet,
-                    const EsFilePacketHeader &) {
+        [&unpacker, &bridge_inflight](const std::string &task_id,
+                                      std::vector<uint8_t> &&packet,
+                                      const EsFilePacketHeader &) {
         if (task_id == EsFileFerryPacker::kBootstrapTaskId || packet.empty()) {
             return;
         }
+        ++bridge_inflight;
         size_t offset = 0;
         while (offset < packet.size()) {
             const auto remain = packet.size() - offset;
@@ -106,6 +290,7 @@ int main() {
             unpacker.inputFrame(packet.data() + offset, step);
             offset += step;
         }
+        --bridge_inflight;
     };
     packer.setPacketCallback(bridge_packets_to_unpacker);
 
@@ -293,6 +478,984 @@ int main() {
         packer.setPacketCallback(bridge_packets_to_unpacker);
     }
 
+    {
+        const std::string task_id = "crc32c_corrupt_task";
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool captured_end = false;
+        std::vector<std::vector<uint8_t>> captured_packets;
+        std::vector<EsFilePacketHeader> captured_headers;
+
+        packer.setChunkSize(7);
+        packer.setPacketCallback([&](const std::string &event_task_id,
+                                     std::vector<uint8_t> &&packet,
+                                     const EsFilePacketHeader &header) {
+            if (event_task_id != task_id) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            if (header.payload_len > 0) {
+                assert((header.flags & kEsFileFlagPayloadCrc32c) != 0);
+            }
+            captured_packets.emplace_back(std::move(packet));
+            captured_headers.push_back(header);
+            if (header.type == EsFilePacketType::FileEnd) {
+                captured_end = true;
+                cv.notify_all();
+            }
+        });
+        assert(packer.addFileTask(task_id, file_path_small, "crc.bin"));
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            const bool ok = cv.wait_for(lock, std::chrono::seconds(3),
+                                        [&]() { return captured_end; });
+            assert(ok);
+        }
+        packer.clearTasks();
+
+        std::vector<uint8_t> received_data;
+        size_t error_count = 0;
+        unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+            if (event.type == EsFilePacketType::FileChunk) {
+                received_data.insert(received_data.end(), event.payload.begin(),
+                                     event.payload.end());
+            }
+        });
+        unpacker.setOnError([&](const EsFileUnpackErrorEvent &event) {
+            if (event.type == EsFileUnpackErrorType::PayloadChecksumMismatch) {
+                assert(event.task_id == task_id);
+                ++error_count;
+            }
+        });
+        // 破坏第 1、3 个 FileChunk 的负载末字节，分别走整帧快路径与逐字节缓冲路径
+        std::vector<uint8_t> expected_data;
+        size_t chunk_index = 0;
+        size_t payload_packet_count = 0;
+        for (size_t i = 0; i < captured_packets.size(); ++i) {
+            auto &packet = captured_packets[i];
+            const auto &header = captured_headers[i];
+            if (header.payload_len > 0) {
+                ++payload_packet_count;
+            }
+            bool corrupt = false;
+            if (header.type == EsFilePacketType::FileChunk) {
+                corrupt = chunk_index == 0 || chunk_index == 2;
+                ++chunk_index;
+                if (!corrupt) {
+                    expected_data.insert(
+                        expected_data.end(),
+                        source_data_small.begin() + header.data_offset,
+                        source_data_small.begin() + header.data_offset +
+                            header.payload_len);
+                }
+            }
+            if (corrupt) {
+                packet.back() = packet.back() == 0x55 ? 0x56 : 0x55;
+            }
+            if (corrupt && chunk_index == 3) {
+                for (size_t j = 0; j < packet.size(); ++j) {
+                    unpacker.inputFrame(packet.data() + j, 1);
+                }
+            } else {
+                unpacker.inputFrame(packet.data(), packet.size());
+            }
+        }
+        assert(chunk_index >= 3);
+        assert(received_data == expected_data);
+        assert(error_count == 2);
+        EsFileUnpackTaskStats stats;
+        assert(unpacker.getTaskStats(task_id, stats));
+        assert(stats.crc_checked_count == payload_packet_count);
+        assert(stats.crc_error_count == 2);
+
+        unpacker.setOnError(EsFileFerryUnPacker::OnError{});
+        unpacker.removeTask(task_id);
+        packer.setChunkSize(4096);
+        packer.setPacketCallback(bridge_packets_to_unpacker);
+    }
+
+    {
+        // 多实例并行解包：每路承载流一个实例与线程，task 表由所有实例共享
+        const size_t stream_count = 4;
+        std::mutex mtx;
+        std::condition_variable cv;
+        size_t captured_end_count = 0;
+        std::unordered_map<std::string, std::vector<std::vector<uint8_t>>> stream_packets;
+        std::vector<std::string> task_ids;
+        for (size_t i = 0; i < stream_count; ++i) {
+            task_ids.emplace_back("multi_instance_task_" + std::to_string(i));
+        }
+
+        packer.setChunkSize(4096);
+        packer.setPacketCallback([&](const std::string &event_task_id,
+                                     std::vector<uint8_t> &&packet,
+                                     const EsFilePacketHeader &header) {
+            if (event_task_id == EsFileFerryPacker::kBootstrapTaskId) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            stream_packets[event_task_id].emplace_back(std::move(packet));
+            if (header.type == EsFilePacketType::FileEnd) {
+                ++captured_end_count;
+                cv.notify_all();
+            }
+        });
+        for (const auto &task_id : task_ids) {
+            assert(packer.addFileTask(task_id, file_path_large, "multi.bin"));
+        }
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            const bool ok = cv.wait_for(lock, std::chrono::seconds(8), [&]() {
+                return captured_end_count == stream_count;
+            });
+            assert(ok);
+        }
+        packer.clearTasks();
+
+        std::unordered_map<std::string, std::vector<uint8_t>> received;
+        std::unordered_map<std::string, bool> completed;
+        for (const auto &task_id : task_ids) {
+            received[task_id].clear();
+            completed[task_id] = false;
+            // 回调在各解包线程中并发执行，每个 task 只会被一个线程回调
+            auto *task_received = &received[task_id];
+            auto *task_completed = &completed[task_id];
+            unpacker.setTaskCallback(task_id, [task_received, task_completed](const EsTaskDataEvent &event) {
+                if (event.type == EsFilePacketType::FileChunk) {
+                    task_received->insert(task_received->end(), event.payload.begin(),
+                                          event.payload.end());
+                } else if (event.type == EsFilePacketType::FileEnd) {
+                    *task_completed = true;
+                }
+            });
+        }
+
+        std::vector<std::thread> threads;
+        const auto begin = std::chrono::steady_clock::now();
+        for (const auto &task_id : task_ids) {
+            const auto &packets = stream_packets[task_id];
+            threads.emplace_back([&packets]() {
+                auto stream_unpacker = EsFileFerryUnPacker::create();
+                for (const auto &packet : packets) {
+                    // 各实例独立拆包，互不影响解析缓冲
+                    size_t offset = 0;
+                    while (offset < packet.size()) {
+                        const auto step = std::min<size_t>(packet.size() - offset, 1000);
+                        stream_unpacker->inputFrame(packet.data() + offset, step);
+                        offset += step;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        const auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        for (const auto &task_id : task_ids) {
+            assert(completed[task_id]);
+            assert(received[task_id] == source_data_large);
+            unpacker.removeTask(task_id);
+        }
+        std::cout << "multi instance unpack streams:" << stream_count << " bytes:"
+                  << source_data_large.size() * stream_count << " cost:" << cost << "s"
+                  << std::endl;
+        packer.setPacketCallback(bridge_packets_to_unpacker);
+    }
+
+    {
+        // 落盘 sink：FileChunk 逆序到达，交替整帧与拆分输入，含大量 0 以覆盖转义负载
+        const std::string task_id = "sink_task";
+        const std::string source_path = makeTempFilePath("esfile_sink_source.bin");
+        const std::string sink_path = makeTempFilePath("esfile_sink_output.bin");
+        std::vector<uint8_t> source_data(300000);
+        for (size_t i = 0; i < source_data.size(); ++i) {
+            source_data[i] = (i / 1000) % 2 == 0 ? 0 : static_cast<uint8_t>((i * 31 + 7) % 253);
+        }
+        {
+            std::ofstream ofs(source_path, std::ios::binary);
+            ofs.write(reinterpret_cast<const char *>(source_data.data()),
+                      static_cast<std::streamsize>(source_data.size()));
+        }
+
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool captured_end = false;
+        std::vector<std::vector<uint8_t>> captured_packets;
+        std::vector<EsFilePacketHeader> captured_headers;
+        packer.setChunkSize(4096);
+        packer.setPacketCallback([&](const std::string &event_task_id,
+                                     std::vector<uint8_t> &&packet,
+                                     const EsFilePacketHeader &header) {
+            if (event_task_id != task_id) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            captured_packets.emplace_back(std::move(packet));
+            captured_headers.push_back(header);
+            if (header.type == EsFilePacketType::FileEnd) {
+                captured_end = true;
+                cv.notify_all();
+            }
+        });
+        assert(packer.addFileTask(task_id, source_path, "sink.bin"));
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            const bool ok = cv.wait_for(lock, std::chrono::seconds(3),
+                                        [&]() { return captured_end; });
+            assert(ok);
+        }
+        packer.clearTasks();
+
+        std::vector<size_t> chunk_indexes;
+        size_t info_index = captured_packets.size();
+        size_t end_index = captured_packets.size();
+        bool has_escaped_chunk = false;
+        for (size_t i = 0; i < captured_headers.size(); ++i) {
+            const auto &header = captured_headers[i];
+            if (header.type == EsFilePacketType::FileInfo) {
+                info_index = i;
+            } else if (header.type == EsFilePacketType::FileChunk) {
+                chunk_indexes.push_back(i);
+                has_escaped_chunk |= (header.flags & kEsFileFlagPayloadEscaped) != 0;
+            } else if (header.type == EsFilePacketType::FileEnd) {
+                end_index = i;
+            }
+        }
+        assert(info_index < captured_packets.size());
+        assert(end_index < captured_packets.size());
+        assert(chunk_indexes.size() > 2);
+        assert(has_escaped_chunk);
+        std::reverse(chunk_indexes.begin(), chunk_indexes.end());
+
+        size_t chunk_event_count = 0;
+        bool chunk_payload_empty = true;
+        unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+            if (event.type == EsFilePacketType::FileChunk) {
+                ++chunk_event_count;
+                chunk_payload_empty &= event.payload.empty();
+            }
+        });
+        std::string err;
+        auto sink = EsFileFerrySink::create(sink_path, &err);
+        assert(sink);
+        bool sink_done = false;
+        EsFileFerrySink::Result sink_result;
+        sink->setOnComplete([&](const EsFileFerrySink::Result &result) {
+            sink_done = true;
+            sink_result = result;
+        });
+        assert(!unpacker.setTaskSink("sink_unknown_task", sink));
+        assert(unpacker.setTaskSink(task_id, sink));
+
+        auto feed = [&](const std::vector<uint8_t> &packet, bool split) {
+            if (!split) {
+                unpacker.inputFrame(packet.data(), packet.size());
+                return;
+            }
+            size_t offset = 0;
+            while (offset < packet.size()) {
+                const auto step = std::min<size_t>(packet.size() - offset, 1000);
+                unpacker.inputFrame(packet.data() + offset, step);
+                offset += step;
+            }
+        };
+        feed(captured_packets[info_index], false);
+        for (size_t i = 0; i < chunk_indexes.size(); ++i) {
+            feed(captured_packets[chunk_indexes[i]], i % 2 == 1);
+            if (i == 0) {
+                assert(sink->getMissingRanges().size() == 1);
+            }
+        }
+        feed(captured_packets[end_index], false);
+
+        assert(sink_done);
+        assert(sink_result.complete);
+        assert(sink_result.error.empty());
+        assert(sink_result.file_size == source_data.size());
+        assert(sink_result.received_bytes == source_data.size());
+        assert(sink->getMissingRanges().empty());
+        assert(chunk_event_count == chunk_indexes.size());
+        assert(chunk_payload_empty);
+        unpacker.removeTask(task_id);
+        sink.reset();
+        {
+            std::ifstream ifs(sink_path, std::ios::binary);
+            std::vector<uint8_t> written((std::istreambuf_iterator<char>(ifs)),
+                                         std::istreambuf_iterator<char>());
+            assert(written == source_data);
+        }
+
+        toolkit::File::delete_file(source_path, false);
+        toolkit::File::delete_file(sink_path, false);
+        packer.setPacketCallback(bridge_packets_to_unpacker);
+    }
+
+    {
+        // 续传与补发：首轮丢弃部分 FileChunk，按接收端缺失区间补发，再从偏移续传
+        const std::string task_id = "resume_task";
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool captured_end = false;
+        std::vector<std::vector<uint8_t>> captured_packets;
+        std::vector<EsFilePacketHeader> captured_headers;
+        packer.setChunkSize(4096);
+        packer.setPacketCallback([&](const std::string &event_task_id,
+                                     std::vector<uint8_t> &&packet,
+                                     const EsFilePacketHeader &header) {
+            if (event_task_id != task_id) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            captured_packets.emplace_back(std::move(packet));
+            captured_headers.push_back(header);
+            if (header.type == EsFilePacketType::FileEnd) {
+                captured_end = true;
+                cv.notify_all();
+            }
+        });
+        auto capture_round = [&](const std::function<bool()> &add_task) {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                captured_end = false;
+                captured_packets.clear();
+                captured_headers.clear();
+            }
+            assert(add_task());
+            std::unique_lock<std::mutex> lock(mtx);
+            const bool ok = cv.wait_for(lock, std::chrono::seconds(5),
+                                        [&]() { return captured_end; });
+            assert(ok);
+            lock.unlock();
+            packer.removeTask(task_id);
+        };
+
+        std::vector<uint8_t> received_data(source_data_large.size());
+        unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+            if (event.type == EsFilePacketType::FileChunk) {
+                assert(event.offset + event.payload.size() <= received_data.size());
+                std::copy(event.payload.begin(), event.payload.end(),
+                          received_data.begin() + event.offset);
+            }
+        });
+
+        // 首轮：丢弃每 7 个 FileChunk 中的 1 个
+        capture_round([&]() {
+            return packer.addFileTask(task_id, file_path_large, "resume.bin");
+        });
+        size_t chunk_index = 0;
+        for (size_t i = 0; i < captured_packets.size(); ++i) {
+            if (captured_headers[i].type == EsFilePacketType::FileChunk &&
+                chunk_index++ % 7 == 3) {
+                continue;
+            }
+            unpacker.inputFrame(captured_packets[i].data(), captured_packets[i].size());
+        }
+        std::vector<EsFileRangeSet::Range> missing;
+        assert(unpacker.getTaskMissingRanges(task_id, missing));
+        assert(!missing.empty());
+        uint64_t missing_bytes = 0;
+        for (const auto &range : missing) {
+            missing_bytes += range.second - range.first;
+        }
+        EsFileUnpackTaskStats stats;
+        assert(unpacker.getTaskStats(task_id, stats));
+        assert(stats.received_bytes + missing_bytes == source_data_large.size());
+
+        // 补发：只应发送缺失区间，FileInfo 携带续传标记
+        std::vector<EsFileFerryPacker::ByteRange> resend_ranges(missing.begin(), missing.end());
+        capture_round([&]() {
+            return packer.addRangeTask(task_id, file_path_large, resend_ranges, "GET", {}, "", "resume.bin");
+        });
+        uint64_t resent_bytes = 0;
+        for (size_t i = 0; i < captured_packets.size(); ++i) {
+            const auto &header = captured_headers[i];
+            if (header.type == EsFilePacketType::FileInfo) {
+                assert((header.flags & kEsFileFlagFileInfoResume) != 0);
+            } else if (header.type == EsFilePacketType::FileChunk) {
+                bool inside = false;
+                for (const auto &range : missing) {
+                    inside |= header.data_offset >= range.first &&
+                              header.data_offset + header.payload_len <= range.second;
+                }
+                assert(inside);
+                resent_bytes += header.payload_len;
+            }
+            unpacker.inputFrame(captured_packets[i].data(), captured_packets[i].size());
+        }
+        assert(resent_bytes == missing_bytes);
+        assert(unpacker.getTaskMissingRanges(task_id, missing));
+        assert(missing.empty());
+        assert(unpacker.getTaskStats(task_id, stats));
+        assert(stats.completed);
+        assert(stats.received_bytes == source_data_large.size());
+        assert(received_data == source_data_large);
+
+        // 从偏移续传：首个 FileChunk 从 start_offset 开始，越界偏移只发送 FileInfo/FileEnd
+        const uint64_t start_offset = source_data_large.size() - 10000;
+        capture_round([&]() {
+            return packer.addResumeTask(task_id, file_path_large, start_offset, "GET", {}, "", "resume.bin");
+        });
+        uint64_t expected_offset = start_offset;
+        for (const auto &header : captured_headers) {
+            if (header.type == EsFilePacketType::FileChunk) {
+                assert(header.data_offset == expected_offset);
+                expected_offset += header.payload_len;
+            }
+        }
+        assert(expected_offset == source_data_large.size());
+        capture_round([&]() {
+            return packer.addResumeTask(task_id, file_path_large, source_data_large.size() + 1);
+        });
+        for (const auto &header : captured_headers) {
+            assert(header.type != EsFilePacketType::FileChunk);
+        }
+
+        unpacker.removeTask(task_id);
+        packer.setPacketCallback(bridge_packets_to_unpacker);
+    }
+
+    {
+        // FEC 丢包注入：每 8 个 FileChunk 追加一个 FileParity，按 1%~5% 随机丢弃 FileChunk，
+        // 校验还原/不可还原计数，并输出有效吞吐（接收端可用字节 / 发送端发出的全部字节）
+        const std::string task_id = "fec_task";
+        const size_t group_size = 8;
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool captured_end = false;
+        std::vector<std::vector<uint8_t>> captured_packets;
+        std::vector<EsFilePacketHeader> captured_headers;
+        EsFileGlobalOptions fec_options;
+        fec_options.packet_chunk_bytes = 4096;
+        fec_options.fec_group_size = group_size;
+        packer.setGlobalOptions(fec_options);
+        packer.setPacketCallback([&](const std::string &event_task_id,
+                                     std::vector<uint8_t> &&packet,
+                                     const EsFilePacketHeader &header) {
+            if (event_task_id != task_id) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            captured_packets.emplace_back(std::move(packet));
+            captured_headers.push_back(header);
+            if (header.type == EsFilePacketType::FileEnd) {
+                captured_end = true;
+                cv.notify_all();
+            }
+        });
+        assert(packer.addFileTask(task_id, file_path_large, "fec.bin"));
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            const bool ok = cv.wait_for(lock, std::chrono::seconds(5),
+                                        [&]() { return captured_end; });
+            assert(ok);
+        }
+        packer.removeTask(task_id);
+        fec_options.fec_group_size = 0;
+        packer.setGlobalOptions(fec_options);
+
+        size_t chunk_count = 0;
+        size_t parity_count = 0;
+        uint64_t parity_bytes = 0;
+        uint64_t sent_bytes = 0;
+        for (const auto &packet : captured_packets) {
+            sent_bytes += packet.size();
+        }
+        for (const auto &header : captured_headers) {
+            if (header.type == EsFilePacketType::FileChunk) {
+                assert((header.flags & kEsFileFlagFecProtected) != 0);
+                ++chunk_count;
+            } else if (header.type == EsFilePacketType::FileParity) {
+                ++parity_count;
+                parity_bytes += header.payload_len;
+            }
+        }
+        const size_t group_count = (chunk_count + group_size - 1) / group_size;
+        assert(parity_count == group_count);
+        std::cout << "fec group:" << group_size << " chunks:" << chunk_count
+                  << " parity_packets:" << parity_count
+                  << " parity_bytes:" << parity_bytes << std::endl;
+
+        // drop(chunk_index) 返回 true 表示丢弃该 FileChunk
+        auto run_loss_case = [&](const std::function<bool(size_t)> &drop,
+                                 size_t &dropped, size_t &single_loss_groups) {
+            std::vector<uint8_t> received_data(source_data_large.size(), 0);
+            unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+                if (event.type == EsFilePacketType::FileChunk) {
+                    assert(event.offset + event.payload.size() <= received_data.size());
+                    std::copy(event.payload.begin(), event.payload.end(),
+                              received_data.begin() + event.offset);
+                }
+            });
+            std::vector<size_t> group_losses(group_count, 0);
+            dropped = 0;
+            size_t chunk_index = 0;
+            for (size_t i = 0; i < captured_packets.size(); ++i) {
+                if (captured_headers[i].type == EsFilePacketType::FileChunk) {
+                    const auto index = chunk_index++;
+                    if (drop(index)) {
+                        ++dropped;
+                        ++group_losses[index / group_size];
+                        continue;
+                    }
+                }
+                unpacker.inputFrame(captured_packets[i].data(), captured_packets[i].size());
+            }
+            single_loss_groups = static_cast<size_t>(
+                std::count(group_losses.begin(), group_losses.end(), 1));
+
+            EsFileUnpackTaskStats stats;
+            assert(unpacker.getTaskStats(task_id, stats));
+            assert(stats.fec_recovered_count == single_loss_groups);
+            assert(stats.fec_recovered_count + stats.fec_unrecoverable_count == dropped);
+            // 已覆盖区间内容必须与源一致，未覆盖区间保持为 0
+            std::vector<EsFileRangeSet::Range> missing;
+            assert(unpacker.getTaskMissingRanges(task_id, missing));
+            auto expected = source_data_large;
+            for (const auto &range : missing) {
+                std::fill(expected.begin() + range.first,
+                          expected.begin() + range.second, 0);
+            }
+            assert(received_data == expected);
+            unpacker.removeTask(task_id);
+            return stats.received_bytes;
+        };
+
+        {
+            // 每组固定丢一个，必须全部还原
+            size_t dropped = 0;
+            size_t single_loss_groups = 0;
+            const auto received_bytes = run_loss_case(
+                [&](size_t index) { return index % group_size == 3; },
+                dropped, single_loss_groups);
+            assert(dropped == single_loss_groups);
+            assert(received_bytes == source_data_large.size());
+        }
+        for (uint32_t loss_percent = 1; loss_percent <= 5; ++loss_percent) {
+            std::mt19937 rng(loss_percent * 7919);
+            size_t dropped = 0;
+            size_t single_loss_groups = 0;
+            const auto received_bytes = run_loss_case(
+                [&](size_t) { return rng() % 100 < loss_percent; },
+                dropped, single_loss_groups);
+            const uint64_t lost_bytes = source_data_large.size() - received_bytes;
+            std::cout << "fec loss:" << loss_percent << "% dropped:" << dropped
+                      << " recovered:" << single_loss_groups
+                      << " unrecoverable:" << (dropped - single_loss_groups)
+                      << " lost_bytes:" << lost_bytes
+                      << " goodput:"
+                      << static_cast<double>(received_bytes) /
+                             static_cast<double>(sent_bytes)
+                      << std::endl;
+        }
+
+        packer.setPacketCallback(bridge_packets_to_unpacker);
+    }
+
+    {
+        // 负载压缩：类 JSON 文本应压缩发送且线上字节明显减少，随机数据应退避为原样发送；
+        // 两种数据都必须逐字节还原
+        std::string text;
+        for (size_t i = 0; text.size() < 1024 * 1024; ++i) {
+            text += "{\"id\":" + std::to_string(i) + ",\"name\":\"item_" + std::to_string(i % 97) +
+                    "\",\"tags\":[\"alpha\",\"beta\"],\"enabled\":true},\n";
+        }
+        const std::vector<uint8_t> text_data(text.begin(), text.end());
+        std::vector<uint8_t> random_data(1024 * 1024);
+        std::mt19937 rng(20240601);
+        for (auto &byte : random_data) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        const std::string text_path = makeTempFilePath("esfileferry_compress_text.json");
+        const std::string random_path = makeTempFilePath("esfileferry_compress_random.bin");
+        auto write_source = [](const std::string &path, const std::vector<uint8_t> &data) {
+            std::ofstream ofs(path, std::ios::binary);
+            assert(ofs.is_open());
+            ofs.write(reinterpret_cast<const char *>(data.data()),
+                      static_cast<std::streamsize>(data.size()));
+        };
+        write_source(text_path, text_data);
+        write_source(random_path, random_data);
+
+        auto run_compress_case = [&](EsFileCompressCodec codec, const std::string &path,
+                                     const std::vector<uint8_t> &source,
+                                     EsFilePackTaskInfo &info) {
+            const std::string task_id =
+                std::string("compress_task_") + EsFileCompressCodecName(codec);
+            std::mutex mtx;
+            std::condition_variable cv;
+            bool completed = false;
+            std::vector<uint8_t> received(source.size());
+            unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (event.type == EsFilePacketType::FileChunk) {
+                    assert(event.offset + event.payload.size() <= received.size());
+                    std::copy(event.payload.begin(), event.payload.end(),
+                              received.begin() + event.offset);
+                } else if (event.type == EsFilePacketType::FileEnd) {
+                    completed = true;
+                    cv.notify_all();
+                }
+            });
+            assert(packer.addFileTask(task_id, path, "compress.bin"));
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                const bool ok = cv.wait_for(lock, std::chrono::seconds(5),
+                                            [&]() { return completed; });
+                assert(ok);
+            }
+            for (const auto &item : packer.getTaskInfos()) {
+                if (item.task_id == task_id) {
+                    info = item;
+                }
+            }
+            EsFileUnpackTaskStats stats;
+            assert(unpacker.getTaskStats(task_id, stats));
+            assert(stats.decompress_error_count == 0);
+            assert(stats.decompressed_count == info.compressed_chunk_count);
+            assert(stats.received_bytes == source.size());
+            assert(received == source);
+            packer.removeTask(task_id);
+            unpacker.removeTask(task_id);
+        };
+
+        EsFileGlobalOptions compress_options;
+        compress_options.packet_chunk_bytes = 64 * 1024;
+        for (const auto codec : {EsFileCompressCodec::Lz4, EsFileCompressCodec::Zstd}) {
+            if (!IsEsFileCompressCodecAvailable(codec)) {
+                std::cerr << "skip " << EsFileCompressCodecName(codec)
+                          << " compression test, codec not compiled" << std::endl;
+                continue;
+            }
+            compress_options.payload_compression = codec;
+            packer.setGlobalOptions(compress_options);
+            EsFilePackTaskInfo text_info;
+            run_compress_case(codec, text_path, text_data, text_info);
+            assert(text_info.compressed_chunk_count > 0);
+            assert(text_info.wire_payload_bytes * 2 < text_data.size());
+            EsFilePackTaskInfo random_info;
+            run_compress_case(codec, random_path, random_data, random_info);
+            assert(random_info.compressed_chunk_count == 0);
+            assert(random_info.wire_payload_bytes == random_data.size());
+            std::cout << "compress " << EsFileCompressCodecName(codec)
+                      << " text ratio:"
+                      << static_cast<double>(text_data.size()) /
+                             static_cast<double>(text_info.wire_payload_bytes)
+                      << " random ratio:"
+                      << static_cast<double>(random_data.size()) /
+                             static_cast<double>(random_info.wire_payload_bytes)
+                      << std::endl;
+        }
+        // HTTP 源开启压缩时，另一线程持续增删任务：组包在锁外进行，
+        // 增删任务与拉取线程写缓冲不被压缩阻塞，HTTP 数据仍须逐字节还原
+        for (const auto codec : {EsFileCompressCodec::Lz4, EsFileCompressCodec::Zstd}) {
+            if (!IsEsFileCompressCodecAvailable(codec)) {
+                continue;
+            }
+            compress_options.payload_compression = codec;
+            packer.setGlobalOptions(compress_options);
+            LocalHttpServer http_server(text);
+            const std::string task_id =
+                std::string("compress_http_task_") + EsFileCompressCodecName(codec);
+            std::mutex mtx;
+            std::condition_variable cv;
+            bool completed = false;
+            std::vector<uint8_t> received(text_data.size());
+            unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (event.type == EsFilePacketType::FileChunk) {
+                    assert(event.offset + event.payload.size() <= received.size());
+                    std::copy(event.payload.begin(), event.payload.end(),
+                              received.begin() + event.offset);
+                } else if (event.type == EsFilePacketType::FileEnd) {
+                    completed = true;
+                    cv.notify_all();
+                }
+            });
+
+            std::atomic<bool> churn_exit{false};
+            std::atomic<size_t> churn_count{0};
+            std::thread churn([&]() {
+                size_t index = 0;
+                while (!churn_exit) {
+                    const auto churn_id = "compress_churn_" + std::to_string(index++ % 4);
+                    if (packer.addFileTask(churn_id, random_path, "churn.bin")) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        packer.removeTask(churn_id);
+                        unpacker.removeTask(churn_id);
+                        ++churn_count;
+                    }
+                }
+            });
+            assert(packer.addHttpTask(task_id, http_server.url("/compress.json"), "GET", {}, "",
+                                      "compress.json"));
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                const bool ok = cv.wait_for(lock, std::chrono::seconds(10),
+                                            [&]() { return completed; });
+                assert(ok);
+            }
+            churn_exit = true;
+            churn.join();
+
+            EsFilePackTaskInfo info;
+            for (const auto &item : packer.getTaskInfos()) {
+                if (item.task_id == task_id) {
+                    info = item;
+                }
+            }
+            EsFileUnpackTaskStats stats;
+            assert(unpacker.getTaskStats(task_id, stats));
+            assert(info.compressed_chunk_count > 0);
+            assert(stats.decompress_error_count == 0);
+            assert(stats.decompressed_count == info.compressed_chunk_count);
+            assert(stats.received_bytes == text_data.size());
+            assert(received == text_data);
+            assert(churn_count > 0);
+            std::cout << "compress http " << EsFileCompressCodecName(codec)
+                      << " churn tasks:" << churn_count
+                      << " ratio:"
+                      << static_cast<double>(text_data.size()) /
+                             static_cast<double>(info.wire_payload_bytes)
+                      << std::endl;
+            packer.removeTask(task_id);
+            unpacker.removeTask(task_id);
+        }
+
+        compress_options.payload_compression = EsFileCompressCodec::None;
+        packer.setGlobalOptions(compress_options);
+        packer.setChunkSize(4096);
+        toolkit::File::delete_file(text_path, false);
+        toolkit::File::delete_file(random_path, false);
+    }
+
+    {
+        // 多路载体条带：3 路零拷贝回调各自缓存，FileChunk 按 seq 轮转分布；
+        // 接收端按载体交错喂入，FileInfo 晚于其他载体的分片、FileEnd 早于部分分片，
+        // 数据必须完整还原且完成事件在最后；被标记拥塞的载体不再分到 FileChunk；
+        // 丢弃一个分片且无 FEC 时，暂存的 FileEnd 等待超时后按未完成分发并给出缺失区间；
+        // 开启 FEC 时 FileParity 同样轮转、可能先于同组其他载体的分片到达，不得误判丢失，
+        // 丢弃的分片在超时后由暂存的 FileParity 还原，FileEnd 按完成分发
+        const std::string task_id = "stripe_task";
+        const size_t stripe_count = 3;
+        struct StripeCapture {
+            std::mutex mtx;
+            std::condition_variable cv;
+            bool captured_end = false;
+            std::vector<std::vector<std::vector<uint8_t>>> packets;
+            std::vector<std::vector<EsFilePacketHeader>> headers;
+        };
+        // 回调由发包线程持有副本，捕获共享状态而非局部引用
+        auto capture = std::make_shared<StripeCapture>();
+        std::vector<EsFileFerryPacker::PacketBufferCallback> stripe_cbs;
+        for (size_t i = 0; i < stripe_count; ++i) {
+            stripe_cbs.emplace_back([capture, i](const std::string &event_task_id,
+                                                 const toolkit::Buffer::Ptr &packet,
+                                                 const EsFilePacketHeader &header) {
+                if (event_task_id != "stripe_task" || !packet) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(capture->mtx);
+                capture->packets[i].emplace_back(packet->data(), packet->data() + packet->size());
+                capture->headers[i].push_back(header);
+                if (header.type == EsFilePacketType::FileEnd) {
+                    capture->captured_end = true;
+                    capture->cv.notify_all();
+                }
+            });
+        }
+        EsFileGlobalOptions stripe_options;
+        stripe_options.packet_chunk_bytes = 4096;
+        stripe_options.stripe_min_file_bytes = 0;
+        packer.setGlobalOptions(stripe_options);
+
+        auto run_stripe_case = [&](bool with_congested_stripe, bool drop_chunk, bool with_fec) {
+            stripe_options.fec_group_size = with_fec ? 8 : 0;
+            packer.setGlobalOptions(stripe_options);
+            {
+                std::lock_guard<std::mutex> lock(capture->mtx);
+                capture->captured_end = false;
+                capture->packets.assign(stripe_count, {});
+                capture->headers.assign(stripe_count, {});
+            }
+            packer.setStripePacketCallbacks(stripe_cbs);
+            // 控制面固定走 task_id 哈希到的载体，拥塞注入选另一路
+            const size_t control_stripe = std::hash<std::string>()(task_id) % stripe_count;
+            const size_t congested_stripe = (control_stripe + 1) % stripe_count;
+            if (with_congested_stripe) {
+                packer.setStripeCongested(congested_stripe, true);
+            }
+            assert(packer.addFileTask(task_id, file_path_large, "stripe.bin"));
+            {
+                std::unique_lock<std::mutex> lock(capture->mtx);
+                const bool ok = capture->cv.wait_for(lock, std::chrono::seconds(5),
+                                                     [&]() { return capture->captured_end; });
+                assert(ok);
+            }
+            bool task_striped = false;
+            for (const auto &info : packer.getTaskInfos()) {
+                if (info.task_id == task_id) {
+                    task_striped = info.striped;
+                }
+            }
+            assert(task_striped);
+            packer.removeTask(task_id);
+            packer.setStripePacketCallbacks({});
+
+            std::vector<std::vector<std::vector<uint8_t>>> packets;
+            std::vector<std::vector<EsFilePacketHeader>> headers;
+            {
+                std::lock_guard<std::mutex> lock(capture->mtx);
+                packets = capture->packets;
+                headers = capture->headers;
+            }
+            std::vector<size_t> chunk_counts(stripe_count, 0);
+            for (size_t stripe = 0; stripe < stripe_count; ++stripe) {
+                for (const auto &header : headers[stripe]) {
+                    assert((header.flags & kEsFileFlagStriped) != 0);
+                    if (header.type == EsFilePacketType::FileChunk) {
+                        assert(((header.flags & kEsFileFlagFecProtected) != 0) == with_fec);
+                        ++chunk_counts[stripe];
+                    } else if (header.type != EsFilePacketType::FileParity) {
+                        assert(stripe == control_stripe);
+                    } else {
+                        assert(with_fec);
+                    }
+                }
+            }
+            assert(headers[control_stripe].front().type == EsFilePacketType::FileInfo);
+            assert(headers[control_stripe].back().type == EsFilePacketType::FileEnd);
+            const auto max_count = *std::max_element(chunk_counts.begin(), chunk_counts.end());
+            if (with_congested_stripe) {
+                assert(chunk_counts[congested_stripe] == 0);
+                packer.setStripeCongested(congested_stripe, false);
+            } else if (!with_fec) {
+                const auto min_count = *std::min_element(chunk_counts.begin(), chunk_counts.end());
+                assert(max_count - min_count <= 1);
+            }
+
+            std::vector<uint8_t> received_data(source_data_large.size(), 0);
+            size_t chunk_events = 0;
+            size_t chunk_events_at_end = 0;
+            size_t end_events = 0;
+            bool end_completed = false;
+            std::string end_status;
+            unpacker.setTaskCallback(task_id, [&](const EsTaskDataEvent &event) {
+                if (event.type == EsFilePacketType::FileChunk) {
+                    assert(event.offset + event.payload.size() <= received_data.size());
+                    std::copy(event.payload.begin(), event.payload.end(),
+                              received_data.begin() + event.offset);
+                    ++chunk_events;
+                } else if (event.type == EsFilePacketType::FileEnd) {
+                    end_completed = event.completed;
+                    end_status = event.status;
+                    chunk_events_at_end = chunk_events;
+                    ++end_events;
+                }
+            });
+            // 丢弃非控制载体上的第一个分片
+            const size_t drop_stripe = (control_stripe + 2) % stripe_count;
+            EsFilePacketHeader dropped_header;
+            if (drop_chunk) {
+                assert(!packets[drop_stripe].empty());
+                dropped_header = headers[drop_stripe].front();
+                assert(dropped_header.type == EsFilePacketType::FileChunk);
+            }
+            // 先喂其他载体的前半，再喂整条控制载体，最后喂其他载体的后半
+            auto feed = [&](size_t stripe, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (drop_chunk && stripe == drop_stripe && i == 0) {
+                        continue;
+                    }
+                    unpacker.inputFrame(packets[stripe][i].data(), packets[stripe][i].size());
+                }
+            };
+            for (size_t stripe = 0; stripe < stripe_count; ++stripe) {
+                if (stripe != control_stripe) {
+                    feed(stripe, 0, packets[stripe].size() / 2);
+                }
+            }
+            feed(control_stripe, 0, packets[control_stripe].size());
+            for (size_t stripe = 0; stripe < stripe_count; ++stripe) {
+                if (stripe != control_stripe) {
+                    feed(stripe, packets[stripe].size() / 2, packets[stripe].size());
+                }
+            }
+
+            EsFileUnpackTaskStats stats;
+            if (with_fec) {
+                // 先到的 FileParity 已暂存，在途分片不计丢失
+                assert(unpacker.getTaskStats(task_id, stats));
+                assert(stats.fec_unrecoverable_count == 0);
+                assert(stats.fec_recovered_count == 0);
+                assert(end_events == (drop_chunk ? 0u : 1u));
+                // 组内收齐的 FileParity 已释放，超时后无可分发的暂存包；丢弃分片所在组的 FileParity 超时后还原
+                unpacker.setPendingEndTimeout(50);
+                std::this_thread::sleep_for(std::chrono::milliseconds(80));
+                assert(unpacker.flushExpiredPendingPackets() == (drop_chunk ? 1u : 0u));
+                assert(unpacker.flushExpiredPendingPackets() == 0);
+                unpacker.setPendingEndTimeout(EsFileFerryUnPacker::kDefaultPendingEndTimeoutMs);
+                assert(unpacker.getTaskStats(task_id, stats));
+                assert(stats.fec_unrecoverable_count == 0);
+                assert(stats.fec_recovered_count == (drop_chunk ? 1u : 0u));
+                assert(stats.completed);
+                assert(stats.received_bytes == source_data_large.size());
+                assert(end_events == 1);
+                assert(end_completed);
+                assert(end_status == "file_end");
+                assert(received_data == source_data_large);
+            } else if (drop_chunk) {
+                // 区间收不齐，FileEnd 仍暂存；超时前不分发，超时后按未完成分发一次
+                assert(end_events == 0);
+                unpacker.setPendingEndTimeout(50);
+                assert(unpacker.flushExpiredPendingPackets() == 0);
+                std::this_thread::sleep_for(std::chrono::milliseconds(80));
+                assert(unpacker.flushExpiredPendingPackets([&](const std::string &id) { return id != task_id; }) == 0);
+                assert(unpacker.flushExpiredPendingPackets() == 1);
+                assert(unpacker.flushExpiredPendingPackets() == 0);
+                unpacker.setPendingEndTimeout(EsFileFerryUnPacker::kDefaultPendingEndTimeoutMs);
+                assert(end_events == 1);
+                assert(!end_completed);
+                assert(end_status == "file_end_incomplete");
+                assert(unpacker.getTaskStats(task_id, stats));
+                assert(!stats.completed);
+                assert(stats.received_bytes == source_data_large.size() - dropped_header.payload_len);
+                std::vector<EsFileRangeSet::Range> missing;
+                assert(unpacker.getTaskMissingRanges(task_id, missing));
+                assert(missing.size() == 1);
+                assert(missing[0].first == dropped_header.data_offset);
+                assert(missing[0].second == dropped_header.data_offset + dropped_header.payload_len);
+            } else {
+                assert(unpacker.getTaskStats(task_id, stats));
+                assert(stats.completed);
+                assert(stats.received_bytes == source_data_large.size());
+                assert(end_events == 1);
+                assert(end_completed);
+                assert(end_status == "file_end");
+                assert(received_data == source_data_large);
+            }
+            assert(chunk_events_at_end == chunk_events);
+            unpacker.removeTask(task_id);
+            std::cout << "stripe carriers:" << stripe_count
+                      << " congested:" << with_congested_stripe << " drop_chunk:" << drop_chunk
+                      << " fec:" << with_fec << " chunks:";
+            for (size_t stripe = 0; stripe < stripe_count; ++stripe) {
+                std::cout << (stripe == 0 ? "" : "/") << chunk_counts[stripe];
+            }
+            std::cout << std::endl;
+        };
+
+        run_stripe_case(false, false, false);
+        run_stripe_case(true, false, false);
+        run_stripe_case(false, true, false);
+        run_stripe_case(false, false, true);
+        run_stripe_case(false, true, true);
+
+        stripe_options.stripe_min_file_bytes = EsFileGlobalOptions().stripe_min_file_bytes;
+        stripe_options.fec_group_size = EsFileGlobalOptions().fec_group_size;
+        packer.setGlobalOptions(stripe_options);
+        packer.setPacketCallback(bridge_packets_to_unpacker);
+    }
+
     const auto version_get =
         doHttpCall("http://localhost:7080/index/api/version", "GET");
     const auto version_post =
@@ -379,6 +1542,9 @@ int main() {
     unpacker.clearTasks();
     packer.clearTasks();
     packer.setPacketCallback(nullptr);
+    while (bridge_inflight.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
     toolkit::File::delete_file(file_path_large, false);
     toolkit::File::delete_file(file_path_small, false);
     toolkit::File::delete_file(file_path_empty, false);
@@ -0,0 +1,440 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <sys/resource.h>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include "Util/util.h"
+#include "Util/logger.h"
+#include "Util/CMD.h"
+#include "Util/TimeTicker.h"
+#include "Network/TcpServer.h"
+#include "Common/config.h"
+#include "Common/Device.h"
+#include "Rtsp/RtspSession.h"
+#include "Rtmp/RtmpSession.h"
+#include "Http/HttpSession.h"
+#include "Http/HttpClientImp.h"
+#include "Player/MediaPlayer.h"
+#include "Thread/WorkThreadPool.h"
+
+using namespace std;
+using namespace toolkit;
+using namespace mediakit;
+
+// 进程内回环扇出性能测试：录制的h264裸流输入MultiMediaSourceMuxer，每种协议通过回环网络挂载N个进程内播放器，
+// 输出json格式的帧率、每个播放器cpu占用与每帧内存分配字节数，用于性能回归跟踪
+// 说明：cpu与内存分配统计包含进程内播放器自身的开销；webrtc缺少进程内客户端(ice/dtls握手)，暂不支持
+// In-process loopback fan-out benchmark: the recorded h264 elementary stream is input into MultiMediaSourceMuxer,
+// N in-process players are attached per protocol through loopback sockets, the frame rate, cpu usage per player
+// and allocated bytes per frame are output as json for performance regression tracking
+// Note: the cpu and allocation statistics include the cost of the in-process players themselves;
+// webrtc lacks an in-process client (ice/dtls handshake), so it is not supported yet
+
+static atomic<uint64_t> s_alloc_bytes { 0 };
+static atomic<uint64_t> s_alloc_count { 0 };
+
+void *operator new(size_t size) {
+    s_alloc_bytes.fetch_add(size, memory_order_relaxed);
+    s_alloc_count.fetch_add(1, memory_order_relaxed);
+    if (auto ptr = malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+class CMD_main : public CMD {
+public:
+    CMD_main() {
+        _parser.reset(new OptionParser(nullptr));
+        (*_parser) << Option('i', "in", Option::ArgRequired, nullptr, true, "h264裸流文件路径(annexb格式)", nullptr);
+        (*_parser) << Option('c', "count", Option::ArgRequired, "50", false, "每种协议的播放器个数", nullptr);
+        (*_parser) << Option('f', "frames", Option::ArgRequired, "3000", false, "每种协议输入的视频帧数，文件不够时循环输入", nullptr);
+        (*_parser) << Option('r', "realtime", Option::ArgRequired, "1", false, "是否按dts实时输入帧，为0时尽快输入", nullptr);
+        (*_parser) << Option('w', "wait", Option::ArgRequired, "10", false, "等待播放器就绪的超时秒数", nullptr);
+        (*_parser) << Option('p', "protocol", Option::ArgRequired, "rtsp,rtmp,flv,ts,fmp4,hls", false, "测试的协议，以逗号分隔", nullptr);
+        (*_parser) << Option('t', "threads", Option::ArgRequired, to_string(thread::hardware_concurrency()).data(), false, "启动事件触发线程数", nullptr);
+        (*_parser) << Option('l', "level", Option::ArgRequired, to_string(LWarn).data(), false, "日志等级,LTrace~LError(0~4)", nullptr);
+    }
+
+    ~CMD_main() override {}
+
+    const char *description() const override { return "进程内回环扇出性能测试"; }
+};
+
+/**
+ * 统计http流接收字节数的播放器，用于http-flv/http-ts/fmp4
+ * Player counting the received bytes of http stream, used for http-flv/http-ts/fmp4
+ */
+class HttpStreamReader : public HttpClientImp {
+public:
+    using Ptr = std::shared_ptr<HttpStreamReader>;
+
+    atomic<uint64_t> bytes { 0 };
+    atomic<bool> alive { true };
+
+protected:
+    void onResponseHeader(const string &status, const HttpHeader &headers) override {
+        if (status != "200") {
+            alive = false;
+        }
+    }
+
+    void onResponseBody(const char *buf, size_t size) override { bytes += size; }
+
+    void onResponseCompleted(const SockException &ex) override { alive = false; }
+};
+
+struct Ports {
+    uint16_t rtsp;
+    uint16_t rtmp;
+    uint16_t http;
+};
+
+struct BenchProtocol {
+    const char *name;
+    // 是否使用http字节流播放器
+    // Whether to use the http byte stream player
+    bool http_reader;
+    std::function<void(ProtocolOption &)> enable;
+    std::function<string(const Ports &, const string &stream)> url;
+};
+
+static vector<BenchProtocol> getProtocols() {
+    return {
+        { "rtsp", false, [](ProtocolOption &option) { option.enable_rtsp = true; },
+          [](const Ports &ports, const string &stream) { return "rtsp://127.0.0.1:" + to_string(ports.rtsp) + "/bench/" + stream; } },
+        { "rtmp", false, [](ProtocolOption &option) { option.enable_rtmp = true; },
+          [](const Ports &ports, const string &stream) { return "rtmp://127.0.0.1:" + to_string(ports.rtmp) + "/bench/" + stream; } },
+        { "flv", true, [](ProtocolOption &option) { option.enable_rtmp = true; },
+          [](const Ports &ports, const string &stream) { return "http://127.0.0.1:" + to_string(ports.http) + "/bench/" + stream + ".live.flv"; } },
+        { "ts", true, [](ProtocolOption &option) { option.enable_ts = true; },
+          [](const Ports &ports, const string &stream) { return "http://127.0.0.1:" + to_string(ports.http) + "/bench/" + stream + ".live.ts"; } },
+        { "fmp4", true, [](ProtocolOption &option) { option.enable_fmp4 = true; },
+          [](const Ports &ports, const string &stream) { return "http://127.0.0.1:" + to_string(ports.http) + "/bench/" + stream + ".live.mp4"; } },
+        { "hls", false, [](ProtocolOption &option) { option.enable_hls = true; },
+          [](const Ports &ports, const string &stream) { return "http://127.0.0.1:" + to_string(ports.http) + "/bench/" + stream + "/hls.m3u8"; } },
+    };
+}
+
+/**
+ * 按起始码切割h264裸流为nalu，包含起始码
+ * Split the h264 elementary stream into nalus by start code, including the start code
+ */
+static vector<string> loadNalus(const string &path) {
+    ifstream file(path, ios::binary);
+    string data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    vector<string> ret;
+    auto is_start_code = [&](size_t pos) {
+        return pos + 3 <= data.size() && data[pos] == 0 && data[pos + 1] == 0 && data[pos + 2] == 1;
+    };
+    size_t start = string::npos;
+    for (size_t pos = 0; pos + 3 <= data.size(); ++pos) {
+        if (!is_start_code(pos)) {
+            continue;
+        }
+        // 4字节起始码
+        // 4 bytes start code
+        auto begin = pos > 0 && data[pos - 1] == 0 ? pos - 1 : pos;
+        if (start != string::npos) {
+            ret.emplace_back(data.substr(start, begin - start));
+        }
+        start = begin;
+        pos += 2;
+    }
+    if (start != string::npos) {
+        ret.emplace_back(data.substr(start));
+    }
+    return ret;
+}
+
+static uint64_t getCpuUs() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ULL + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+/**
+ * 监听观看人数变化，用于等待播放器就绪
+ * Listen for reader count changes, used to wait for the players to be ready
+ */
+class ReaderWatcher : public MediaSourceEvent {
+public:
+    using Ptr = std::shared_ptr<ReaderWatcher>;
+
+    void onReaderChanged(MediaSource &sender, int size) override {
+        {
+            lock_guard<mutex> lck(_mtx);
+            _readers = size;
+        }
+        _cv.notify_all();
+    }
+
+    /**
+     * 等待观看人数达到count，超时返回false
+     * Wait for the reader count to reach count, return false on timeout
+     */
+    bool waitReaders(int count, int timeout_sec) {
+        unique_lock<mutex> lck(_mtx);
+        return _cv.wait_for(lck, chrono::seconds(timeout_sec), [&]() { return _readers >= count; });
+    }
+
+private:
+    int _readers = 0;
+    mutex _mtx;
+    condition_variable _cv;
+};
+
+/**
+ * 向所有poller线程投递任务并等待其执行完毕，返回时此前已投递的分发、发送与接收任务均已处理
+ * Post a task to all poller threads and wait for them to be executed, when returned,
+ * the dispatching, sending and receiving tasks posted before have all been processed
+ */
+static void waitPollers() {
+    mutex mtx;
+    condition_variable cv;
+    size_t left = EventPollerPool::Instance().getExecutorSize();
+    EventPollerPool::Instance().for_each([&](const TaskExecutor::Ptr &executor) {
+        executor->async([&]() {
+            lock_guard<mutex> lck(mtx);
+            if (--left == 0) {
+                cv.notify_all();
+            }
+        }, false);
+    });
+    unique_lock<mutex> lck(mtx);
+    cv.wait(lck, [&]() { return left == 0; });
+}
+
+class NaluFeeder {
+public:
+    NaluFeeder(const vector<string> &nalus) : _nalus(nalus) {}
+
+    /**
+     * 输入一帧视频，假定每帧只有一个slice，返回输入的字节数
+     * Input one video frame, assuming one slice per frame, return the input bytes
+     */
+    size_t inputFrame(DevChannel &channel) {
+        size_t bytes = 0;
+        while (true) {
+            auto &nalu = _nalus[_index++ % _nalus.size()];
+            auto prefix = nalu[2] == 1 ? 3 : 4;
+            auto type = nalu.size() > (size_t)prefix ? nalu[prefix] & 0x1F : 0;
+            channel.inputH264(nalu.data(), (int)nalu.size(), _dts);
+            bytes += nalu.size();
+            // 非idr/非idr slice之外的nalu(sps/pps/sei等)与下一帧一起输入
+            // Nalus other than idr/non-idr slice (sps/pps/sei, etc.) are input together with the next frame
+            if (type == 1 || type == 5) {
+                // 25fps
+                _dts += 40;
+                return bytes;
+            }
+        }
+    }
+
+    uint64_t dts() const { return _dts; }
+
+private:
+    size_t _index = 0;
+    uint64_t _dts = 40;
+    const vector<string> &_nalus;
+};
+
+static string runBench(const BenchProtocol &protocol, const vector<string> &nalus, const Ports &ports, int reader_count, int frame_count,
+                       bool realtime, int wait_sec) {
+    ProtocolOption option;
+    option.enable_rtsp = option.enable_rtmp = option.enable_ts = option.enable_fmp4 = false;
+    option.enable_hls = option.enable_hls_fmp4 = option.enable_mp4 = false;
+    option.enable_audio = false;
+    protocol.enable(option);
+
+    MediaTuple tuple;
+    tuple.vhost = DEFAULT_VHOST;
+    tuple.app = "bench";
+    tuple.stream = protocol.name;
+    auto channel = std::make_shared<DevChannel>(tuple, 0, option);
+    VideoInfo info;
+    info.codecId = CodecH264;
+    info.iWidth = 1920;
+    info.iHeight = 1080;
+    info.iFrameRate = 25;
+    channel->initVideo(info);
+    channel->addTrackCompleted();
+    auto watcher = std::make_shared<ReaderWatcher>();
+    channel->setMediaListener(watcher);
+
+    // 先输入一个gop使流注册
+    // Input a gop first to make the stream registered
+    NaluFeeder feeder(nalus);
+    for (int i = 0; i < 50; ++i) {
+        feeder.inputFrame(*channel);
+    }
+
+    vector<MediaPlayer::Ptr> players;
+    vector<HttpStreamReader::Ptr> readers;
+    auto url = protocol.url(ports, protocol.name);
+    for (int i = 0; i < reader_count; ++i) {
+        if (protocol.http_reader) {
+            auto reader = std::make_shared<HttpStreamReader>();
+            reader->sendRequest(url);
+            readers.emplace_back(std::move(reader));
+            continue;
+        }
+        auto player = std::make_shared<MediaPlayer>();
+        (*player)[Client::kBenchmarkMode] = true;
+        (*player)[Client::kWaitTrackReady] = false;
+        (*player)[Client::kRtpType] = Rtsp::RTP_TCP;
+        player->play(url);
+        players.emplace_back(std::move(player));
+    }
+    // 等待播放器连接完成，超时后以实际就绪的播放器继续测试
+    // Wait for the players to be connected, continue with the players actually ready after timeout
+    watcher->waitReaders(reader_count, wait_sec);
+    auto readers_ready = channel->totalReaderCount();
+
+    auto alloc_bytes = s_alloc_bytes.load();
+    auto alloc_count = s_alloc_count.load();
+    auto cpu_us = getCpuUs();
+    size_t input_bytes = 0;
+    Ticker ticker;
+    auto start_dts = feeder.dts();
+    for (int i = 0; i < frame_count; ++i) {
+        if (realtime) {
+            // 按dts节拍输入，与真实推流一致
+            // Input at the pace of dts, consistent with real pushing
+            auto wait_ms = (int64_t)(feeder.dts() - start_dts) - (int64_t)ticker.elapsedTime();
+            if (wait_ms > 0) {
+                this_thread::sleep_for(chrono::milliseconds(wait_ms));
+            }
+        }
+        input_bytes += feeder.inputFrame(*channel);
+    }
+    auto feed_ms = MAX(ticker.elapsedTime(), (uint64_t)1);
+    // 等待播放器把数据读完：所有poller线程处理完已投递的任务，且http播放器接收字节数不再增长
+    // Wait for the players to read up the data: all poller threads have processed the posted tasks,
+    // and the received bytes of the http players no longer grow
+    auto total_recv_bytes = [&]() {
+        uint64_t ret = 0;
+        for (auto &reader : readers) {
+            ret += reader->bytes;
+        }
+        return ret;
+    };
+    waitPollers();
+    uint64_t last_bytes;
+    do {
+        last_bytes = total_recv_bytes();
+        waitPollers();
+    } while (last_bytes != total_recv_bytes());
+    auto cost_cpu_us = getCpuUs() - cpu_us;
+    alloc_bytes = s_alloc_bytes.load() - alloc_bytes;
+    alloc_count = s_alloc_count.load() - alloc_count;
+
+    auto recv_bytes = total_recv_bytes();
+    size_t alive = players.size();
+    for (auto &reader : readers) {
+        alive += reader->alive ? 1 : 0;
+    }
+    auto readers_connected = channel->totalReaderCount();
+
+    players.clear();
+    readers.clear();
+    channel = nullptr;
+
+    stringstream printer;
+    printer << "{\"protocol\":\"" << protocol.name << "\""
+            << ",\"readers\":" << reader_count
+            << ",\"readers_ready\":" << readers_ready
+            << ",\"readers_connected\":" << readers_connected
+            << ",\"readers_alive\":" << alive
+            << ",\"frames\":" << frame_count
+            << ",\"paced\":" << (realtime ? "true" : "false")
+            << ",\"input_bytes\":" << input_bytes
+            << ",\"feed_ms\":" << feed_ms
+            << ",\"fps\":" << frame_count * 1000.0 / feed_ms
+            << ",\"cpu_ms\":" << cost_cpu_us / 1000.0
+            << ",\"cpu_us_per_reader_frame\":" << (double)cost_cpu_us / MAX(reader_count, 1) / MAX(frame_count, 1)
+            << ",\"alloc_bytes_per_frame\":" << (double)alloc_bytes / MAX(frame_count, 1)
+            << ",\"allocs_per_frame\":" << (double)alloc_count / MAX(frame_count, 1);
+    if (protocol.http_reader) {
+        printer << ",\"recv_bytes\":" << recv_bytes;
+    }
+    printer << "}";
+    return printer.str();
+}
+
+int main(int argc, char *argv[]) {
+    CMD_main cmd_main;
+    try {
+        cmd_main.operator()(argc, argv);
+    } catch (ExitException &) {
+        return 0;
+    } catch (std::exception &ex) {
+        cout << ex.what() << endl;
+        return -1;
+    }
+
+    LogLevel level = (LogLevel)cmd_main["level"].as<int>();
+    level = MIN(MAX(level, LTrace), LError);
+    Logger::Instance().add(std::make_shared<ConsoleChannel>("ConsoleChannel", level));
+    EventPollerPool::setPoolSize(cmd_main["threads"].as<int>());
+    WorkThreadPool::setPoolSize(cmd_main["threads"].as<int>());
+
+    auto nalus = loadNalus(cmd_main["in"]);
+    auto has_slice = any_of(nalus.begin(), nalus.end(), [](const string &nalu) {
+        auto prefix = nalu[2] == 1 ? 3 : 4;
+        auto type = nalu.size() > (size_t)prefix ? nalu[prefix] & 0x1F : 0;
+        return type == 1 || type == 5;
+    });
+    if (!has_slice) {
+        cout << "open or parse h264 file failed: " << cmd_main["in"] << endl;
+        return -1;
+    }
+
+    // 监听随机端口，仅限回环网卡
+    // Listen on random ports, loopback only
+    auto rtsp_server = std::make_shared<TcpServer>();
+    auto rtmp_server = std::make_shared<TcpServer>();
+    auto http_server = std::make_shared<TcpServer>();
+    rtsp_server->start<RtspSession>(0, "127.0.0.1");
+    rtmp_server->start<RtmpSession>(0, "127.0.0.1");
+    http_server->start<HttpSession>(0, "127.0.0.1");
+    Ports ports { rtsp_server->getPort(), rtmp_server->getPort(), http_server->getPort() };
+
+    auto reader_count = cmd_main["count"].as<int>();
+    auto frame_count = cmd_main["frames"].as<int>();
+    auto realtime = cmd_main["realtime"].as<bool>();
+    auto wait_sec = cmd_main["wait"].as<int>();
+    auto enabled = split(cmd_main["protocol"], ",");
+
+    // 输出一个json对象，results为各协议的测试结果
+    // Output a json object, results are the test results of each protocol
+    cout << "{\"readers_per_protocol\":" << reader_count << ",\"results\":[";
+    bool first = true;
+    for (auto &protocol : getProtocols()) {
+        if (find(enabled.begin(), enabled.end(), protocol.name) == enabled.end()) {
+            continue;
+        }
+        cout << (first ? "" : ",") << runBench(protocol, nalus, ports, reader_count, frame_count, realtime, wait_sec) << flush;
+        first = false;
+    }
+    cout << "]}" << endl;
+    return 0;
+}
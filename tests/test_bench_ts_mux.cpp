@@ -0,0 +1,117 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <iostream>
+#include "Util/util.h"
+#include "Util/logger.h"
+#include "Util/TimeTicker.h"
+#include "Common/config.h"
+#include "Extension/Factory.h"
+#include "Record/MPEG.h"
+
+using namespace std;
+using namespace toolkit;
+using namespace mediakit;
+
+// 单线程mpeg-ts封装吞吐量测试，对比media-server的mpeg_muxer与内置零拷贝打包器
+// Single thread mpeg-ts muxing throughput benchmark, comparing media-server's mpeg_muxer with the built-in zero-copy packetizer
+
+#if defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
+
+class TsMuxerBench : public MpegMuxer {
+public:
+    size_t bytes = 0;
+
+protected:
+    void onWrite(std::shared_ptr<Buffer> buffer, uint64_t timestamp, bool key_pos) override {
+        if (buffer) {
+            bytes += buffer->size();
+        }
+    }
+};
+
+struct BenchProfile {
+    const char *name;
+    // I帧与P帧大小，25fps，gop为50
+    // I frame and P frame size, 25fps, gop is 50
+    size_t key_size;
+    size_t frame_size;
+};
+
+static string makeH265Frame(bool key, size_t size) {
+    string ret("\x00\x00\x00\x01", 4);
+    // IDR_W_RADL or TRAIL_R, first_slice_segment_in_pic_flag = 1
+    ret.append(key ? "\x26\x01\x80" : "\x02\x01\x80", 3);
+    ret.resize(size, 'x');
+    return ret;
+}
+
+static void runBench(const BenchProfile &profile, bool fast_ts_muxer, size_t frame_count) {
+    mINI::Instance()[General::kFastTsMuxer] = fast_ts_muxer;
+    // GET_CONFIG缓存了配置值，需广播重载才能生效
+    // GET_CONFIG caches the value, a reload broadcast is needed for it to take effect
+    NOTICE_EMIT(BroadcastReloadConfigArgs, Broadcast::kBroadcastReloadConfig);
+
+    auto key_frame = makeH265Frame(true, profile.key_size);
+    auto frame = makeH265Frame(false, profile.frame_size);
+    auto track = Factory::getTrackByCodecId(CodecH265);
+    track->setIndex(0);
+
+    TsMuxerBench muxer;
+    muxer.addTrack(track);
+
+    size_t input_bytes = 0;
+    Ticker ticker;
+    for (size_t i = 0; i < frame_count; ++i) {
+        auto &data = i % 50 == 0 ? key_frame : frame;
+        auto ptr = Factory::getFrameFromPtr(CodecH265, data.data(), data.size(), i * 40, i * 40);
+        ptr->setIndex(0);
+        muxer.inputFrame(ptr);
+        input_bytes += data.size();
+    }
+    muxer.flush();
+    auto ms = MAX(ticker.elapsedTime(), (uint64_t)1);
+
+    InfoL << profile.name << (fast_ts_muxer ? " fast_ts_muxer" : " mpeg_muxer")
+          << ", frames: " << frame_count
+          << ", input: " << (input_bytes >> 20) << "MB"
+          << ", output: " << (muxer.bytes >> 20) << "MB"
+          << ", cost: " << ms << "ms"
+          << ", throughput: " << input_bytes / 1024.0 / 1024.0 * 1000 / ms << "MB/s per core";
+}
+
+int main(int argc, char *argv[]) {
+    Logger::Instance().add(std::make_shared<ConsoleChannel>());
+    Logger::Instance().setLevel(LInfo);
+
+    size_t frame_count = argc > 1 ? atoi(argv[1]) : 10000;
+    BenchProfile profiles[] = {
+        // 1080p h265约4Mbps
+        // 1080p h265 at about 4Mbps
+        { "1080p h265", 150 * 1024, 16 * 1024 },
+        // 4k h265约16Mbps
+        // 4k h265 at about 16Mbps
+        { "4k h265", 600 * 1024, 64 * 1024 },
+    };
+    for (auto &profile : profiles) {
+        runBench(profile, false, frame_count);
+        runBench(profile, true, frame_count);
+    }
+    return 0;
+}
+
+#else
+
+int main(int argc, char *argv[]) {
+    cout << "ENABLE_HLS and ENABLE_RTPPROXY disabled" << endl;
+    return 0;
+}
+
+#endif
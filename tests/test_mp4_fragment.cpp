@@ -0,0 +1,270 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <iostream>
+#include <fstream>
+#include "Util/util.h"
+#include "Util/logger.h"
+#include "Util/File.h"
+#include "Common/config.h"
+#include "Extension/Factory.h"
+#include "Record/MP4Demuxer.h"
+#include "Record/MP4Muxer.h"
+
+using namespace std;
+using namespace toolkit;
+using namespace mediakit;
+
+// fmp4录制fragment测试：每个fragment必须以同步帧开始，写到一半被截断的文件仍可解析
+// fmp4 recording fragment test: each fragment must start with a sync sample, and a file cut off mid-write must still parse
+
+#if defined(ENABLE_MP4)
+
+#define TEST_CHECK(exp) \
+    if (!(exp)) { \
+        ErrorL << "check failed: " << #exp; \
+        return false; \
+    }
+
+static constexpr size_t kGopSize = 25;
+static constexpr size_t kGopCount = 8;
+static constexpr uint32_t kFrameMS = 40;
+// trun/tfhd/trex sample_flags中的sample_is_non_sync_sample位
+// The sample_is_non_sync_sample bit of trun/tfhd/trex sample_flags
+static constexpr uint32_t kNonSyncSample = 0x00010000;
+
+static uint32_t readUint32(const string &data, size_t pos) {
+    auto ptr = (const uint8_t *)data.data() + pos;
+    return (ptr[0] << 24) | (ptr[1] << 16) | (ptr[2] << 8) | ptr[3];
+}
+
+struct Mp4Box {
+    string type;
+    size_t offset;
+    size_t header;
+    size_t size;
+};
+
+// 解析[begin, end)范围内的box，不完整的box也会返回
+// Parse the boxes in [begin, end), an incomplete box is returned too
+static vector<Mp4Box> parseBoxes(const string &data, size_t begin, size_t end) {
+    vector<Mp4Box> ret;
+    while (begin + 8 <= end) {
+        Mp4Box box { data.substr(begin + 4, 4), begin, 8, readUint32(data, begin) };
+        if (box.size == 1 && begin + 16 <= end) {
+            box.header = 16;
+            box.size = ((uint64_t)readUint32(data, begin + 8) << 32) | readUint32(data, begin + 12);
+        }
+        if (box.size < box.header) {
+            break;
+        }
+        ret.emplace_back(box);
+        begin += box.size;
+    }
+    return ret;
+}
+
+static const Mp4Box *findBox(const vector<Mp4Box> &boxes, const string &type) {
+    for (auto &box : boxes) {
+        if (box.type == type) {
+            return &box;
+        }
+    }
+    return nullptr;
+}
+
+struct Fragment {
+    size_t moof_offset;
+    size_t mdat_offset;
+    size_t mdat_size;
+    uint32_t sample_count = 0;
+    bool first_sync = false;
+};
+
+// 按moof解析fragment，首个样本的sample_flags依次取trun first_sample_flags、trun逐样本flags、tfhd与trex的默认值
+// Parse fragments by moof, the sample_flags of the first sample comes from trun first_sample_flags, the per sample flags of trun,
+// then the defaults of tfhd and trex in that order
+static bool parseFragments(const string &data, vector<Fragment> &fragments) {
+    auto top = parseBoxes(data, 0, data.size());
+    auto moov = findBox(top, "moov");
+    TEST_CHECK(moov);
+    auto mvex = findBox(parseBoxes(data, moov->offset + moov->header, moov->offset + moov->size), "mvex");
+    TEST_CHECK(mvex);
+    auto trex = findBox(parseBoxes(data, mvex->offset + mvex->header, mvex->offset + mvex->size), "trex");
+    TEST_CHECK(trex);
+    auto trex_flags = readUint32(data, trex->offset + trex->header + 20);
+
+    for (size_t i = 0; i < top.size(); ++i) {
+        if (top[i].type != "moof") {
+            continue;
+        }
+        TEST_CHECK(i + 1 < top.size() && top[i + 1].type == "mdat");
+        Fragment fragment;
+        fragment.moof_offset = top[i].offset;
+        fragment.mdat_offset = top[i + 1].offset;
+        fragment.mdat_size = top[i + 1].size;
+
+        auto traf = findBox(parseBoxes(data, top[i].offset + top[i].header, top[i].offset + top[i].size), "traf");
+        TEST_CHECK(traf);
+        auto children = parseBoxes(data, traf->offset + traf->header, traf->offset + traf->size);
+        auto tfhd = findBox(children, "tfhd");
+        auto trun = findBox(children, "trun");
+        TEST_CHECK(tfhd && trun);
+
+        auto first_flags = trex_flags;
+        auto pos = tfhd->offset + tfhd->header;
+        auto tfhd_flags = readUint32(data, pos) & 0xFFFFFF;
+        pos += 8;
+        pos += (tfhd_flags & 0x01) ? 8 : 0;
+        pos += (tfhd_flags & 0x02) ? 4 : 0;
+        pos += (tfhd_flags & 0x08) ? 4 : 0;
+        pos += (tfhd_flags & 0x10) ? 4 : 0;
+        if (tfhd_flags & 0x20) {
+            first_flags = readUint32(data, pos);
+        }
+
+        pos = trun->offset + trun->header;
+        auto trun_flags = readUint32(data, pos) & 0xFFFFFF;
+        fragment.sample_count = readUint32(data, pos + 4);
+        pos += 8;
+        pos += (trun_flags & 0x01) ? 4 : 0;
+        if (trun_flags & 0x04) {
+            first_flags = readUint32(data, pos);
+        } else if (trun_flags & 0x400) {
+            pos += (trun_flags & 0x100) ? 4 : 0;
+            pos += (trun_flags & 0x200) ? 4 : 0;
+            first_flags = readUint32(data, pos);
+        }
+        fragment.first_sync = !(first_flags & kNonSyncSample);
+        fragments.emplace_back(fragment);
+    }
+    return true;
+}
+
+static string makeH264Frame(bool key, size_t size) {
+    string ret("\x00\x00\x00\x01", 4);
+    // IDR或非IDR slice，first_mb_in_slice = 0
+    // IDR or non-IDR slice, first_mb_in_slice = 0
+    ret.append(key ? "\x65\x88" : "\x41\x9a", 2);
+    ret.resize(size, 'x');
+    return ret;
+}
+
+static Frame::Ptr makeFrame(const string &data, uint64_t dts) {
+    auto frame = Factory::getFrameFromPtr(CodecH264, data.data(), data.size(), dts, dts);
+    frame->setIndex(0);
+    return Frame::getCacheAbleFrame(frame);
+}
+
+/**
+ * @param repeat_config 每个关键帧前是否带sps/pps
+ * @param repeat_config Whether sps/pps comes before each key frame
+ */
+static bool testFragment(const string &path, bool repeat_config) {
+    // RFC 6184示例中的176x144 baseline sps/pps
+    // 176x144 baseline sps/pps from the RFC 6184 example
+    string sps("\x00\x00\x00\x01\x67\x42\x00\x0a\x96\x53\x05\x89\x88", 13);
+    string pps("\x00\x00\x00\x01\x68\xc9\x63\x88", 8);
+
+    auto track = Factory::getTrackByCodecId(CodecH264);
+    track->setIndex(0);
+    track->inputFrame(makeFrame(sps, 0));
+    track->inputFrame(makeFrame(pps, 0));
+    TEST_CHECK(track->ready());
+
+    auto muxer = std::make_shared<MP4Muxer>();
+    muxer->openMP4(path);
+    TEST_CHECK(muxer->addTrack(track));
+    for (size_t i = 0; i < kGopSize * kGopCount; ++i) {
+        uint64_t dts = i * kFrameMS;
+        bool key = i % kGopSize == 0;
+        if (key && (repeat_config || !i)) {
+            muxer->inputFrame(makeFrame(sps, dts));
+            muxer->inputFrame(makeFrame(pps, dts));
+        }
+        muxer->inputFrame(makeFrame(makeH264Frame(key, key ? 4000 : 500), dts));
+    }
+    muxer->flush();
+    muxer->closeMP4();
+
+    auto data = File::loadFile(path);
+    vector<Fragment> fragments;
+    TEST_CHECK(parseFragments(data, fragments));
+    // fragment最大时长大于gop时长，每个gop恰好一个fragment
+    // The max fragment duration is longer than the gop, so each gop is exactly one fragment
+    TEST_CHECK(fragments.size() == kGopCount);
+    for (auto &fragment : fragments) {
+        TEST_CHECK(fragment.first_sync);
+        TEST_CHECK(fragment.sample_count == kGopSize);
+    }
+
+    // 在最后一个fragment的mdat中间截断，模拟写到一半时进程退出
+    // Cut off in the middle of the mdat of the last fragment, simulating a process exit mid-write
+    auto &last = fragments.back();
+    auto cut_path = path + ".cut.mp4";
+    {
+        ofstream out(cut_path, ios::binary | ios::trunc);
+        out.write(data.data(), last.mdat_offset + last.mdat_size / 2);
+    }
+    size_t frames = 0;
+    bool first_key = false;
+    try {
+        MP4Demuxer demuxer;
+        demuxer.openMP4(cut_path);
+        TEST_CHECK(!demuxer.getTracks(false).empty());
+        bool key_frame = false;
+        bool eof = false;
+        while (!eof) {
+            auto frame = demuxer.readFrame(key_frame, eof);
+            if (!frame) {
+                continue;
+            }
+            if (!frames++) {
+                first_key = key_frame;
+            }
+        }
+    } catch (std::exception &ex) {
+        ErrorL << "parse truncated file failed: " << ex.what();
+        return false;
+    }
+    File::delete_file(cut_path);
+    TEST_CHECK(first_key);
+    // 完整fragment中的样本必须都能读出
+    // All samples in complete fragments must be readable
+    TEST_CHECK(frames >= kGopSize * (kGopCount - 1));
+    File::delete_file(path);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    Logger::Instance().add(std::make_shared<ConsoleChannel>());
+    Logger::Instance().setLevel(LInfo);
+
+    mINI::Instance()[Record::kEnableFmp4] = true;
+    mINI::Instance()[Record::kFmp4FragmentMS] = kGopSize * kFrameMS * 2;
+
+    string path = argc > 1 ? argv[1] : exeDir() + "test_mp4_fragment.mp4";
+    bool ok = true;
+    for (auto repeat_config : { false, true }) {
+        auto passed = testFragment(path, repeat_config);
+        InfoL << "repeat sps/pps: " << repeat_config << (passed ? ", passed" : ", failed");
+        ok = ok && passed;
+    }
+    return ok ? 0 : -1;
+}
+
+#else
+
+int main(int argc, char *argv[]) {
+    cout << "ENABLE_MP4 disabled" << endl;
+    return 0;
+}
+
+#endif
@@ -10,6 +10,9 @@
 #include "Util/SSLBox.h"
 #include "Util/logger.h"
 #include "Util/util.h"
+#include "Util/TimeTicker.h"
+#include "Thread/WorkThreadPool.h"
+#include <atomic>
 #include <iostream>
 #include <map>
 
@@ -90,6 +93,78 @@ static bool loadFile(const char *path, const EventPoller::Ptr &poller) {
     return true;
 }
 
+// 只统计帧数的sink，用于解复用性能测试
+// Sink that only counts frames, used for demux benchmark
+class CountSink : public MediaSinkInterface {
+public:
+    bool inputFrame(const Frame::Ptr &frame) override {
+        ++frames;
+        return true;
+    }
+    bool addTrack(const Track::Ptr &track) override { return true; }
+
+    size_t frames = 0;
+};
+
+// 按rtp解包后的大小(最大32KB)分块输入，与GB28181Process一致
+// Input in chunks of the rtp unpacked size (up to 32KB), the same as GB28181Process
+static constexpr size_t kChunkSize = 32 * 1024;
+
+static size_t demuxOnce(const string &data) {
+    CountSink sink;
+    auto decoder = DecoderImp::createDecoder(DecoderImp::decoder_ps, &sink);
+    for (size_t offset = 0; offset < data.size(); offset += kChunkSize) {
+        decoder->input((uint8_t *)data.data() + offset, MIN(kChunkSize, data.size() - offset));
+    }
+    decoder->flush();
+    return sink.frames;
+}
+
+// ps解复用吞吐量测试: 先在单线程内串行解复用，再把每路流投递到后台线程池中并行解复用
+// ps demux throughput benchmark: demux serially in one thread first, then post each stream to the background thread pool to demux in parallel
+static void benchDemux(const char *path, size_t streams, size_t loops) {
+    auto data = File::loadFile(path);
+    if (data.empty()) {
+        WarnL << "open file failed:" << path;
+        return;
+    }
+    auto total_mb = data.size() * streams * loops / 1024.0 / 1024.0;
+
+    {
+        size_t frames = 0;
+        Ticker ticker;
+        for (size_t i = 0; i < streams * loops; ++i) {
+            frames += demuxOnce(data);
+        }
+        auto ms = MAX(ticker.elapsedTime(), (uint64_t)1);
+        InfoL << "serial demux, streams: " << streams << ", frames: " << frames << ", cost: " << ms << "ms"
+              << ", throughput: " << total_mb * 1000 / ms << "MB/s";
+    }
+
+    {
+        std::atomic<size_t> frames { 0 };
+        semaphore done;
+        Ticker ticker;
+        for (size_t i = 0; i < streams; ++i) {
+            // 同一路流固定在同一线程，与rtp_proxy.demux_in_worker一致
+            // One stream is bound to one thread, the same as rtp_proxy.demux_in_worker
+            WorkThreadPool::Instance().getPoller()->async([&, loops]() {
+                for (size_t j = 0; j < loops; ++j) {
+                    frames += demuxOnce(data);
+                }
+                done.post();
+            });
+        }
+        for (size_t i = 0; i < streams; ++i) {
+            done.wait();
+        }
+        auto ms = MAX(ticker.elapsedTime(), (uint64_t)1);
+        InfoL << "parallel demux, streams: " << streams << ", threads: " << WorkThreadPool::Instance().getExecutorSize()
+              << ", frames: " << frames << ", cost: " << ms << "ms"
+              << ", throughput: " << total_mb * 1000 / ms << "MB/s";
+    }
+}
+
 int main(int argc, char *argv[]) {
     // 设置日志
     Logger::Instance().add(std::make_shared<ConsoleChannel>("ConsoleChannel"));
@@ -98,6 +173,14 @@ int main(int argc, char *argv[]) {
     Logger::Instance().setWriter(std::make_shared<AsyncLogWriter>());
     loadIniConfig((exeDir() + "config.ini").data());
 
+    if (argc >= 3 && string(argv[2]) == "bench") {
+        // test_ps file.ps bench [streams] [loops]
+        size_t streams = argc > 3 ? atoi(argv[3]) : 64;
+        size_t loops = argc > 4 ? atoi(argv[4]) : 4;
+        benchDemux(argv[1], MAX(streams, (size_t)1), MAX(loops, (size_t)1));
+        return 0;
+    }
+
     TcpServer::Ptr rtspSrv(new TcpServer());
     TcpServer::Ptr rtmpSrv(new TcpServer());
     TcpServer::Ptr httpSrv(new TcpServer());
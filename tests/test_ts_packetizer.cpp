@@ -0,0 +1,284 @@
+﻿/*
+ * Copyright (c) 2016-present The ZLMediaKit project authors. All Rights Reserved.
+ *
+ * This file is part of ZLMediaKit(https://github.com/ZLMediaKit/ZLMediaKit).
+ *
+ * Use of this source code is governed by MIT-like license that can be found in the
+ * LICENSE file in the root of the source tree. All contributing project authors
+ * may be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <map>
+#include <cstring>
+#include <set>
+#include <random>
+#include <iostream>
+#include "Util/util.h"
+#include "Util/logger.h"
+#include "Common/config.h"
+#include "Extension/Factory.h"
+#include "Record/MPEG.h"
+
+using namespace std;
+using namespace toolkit;
+using namespace mediakit;
+
+// 内置ts打包器(fast_ts_muxer)与media-server的mpeg_muxer输出逐字节对比：
+// pat/pmt、pes(头与负载)、pcr、随机访问标记需完全一致，且两者各自的连续计数器都必须连续
+// Byte level comparison of the built-in ts packetizer (fast_ts_muxer) with media-server's mpeg_muxer:
+// pat/pmt, pes (header and payload), pcr and random access indicators must be identical,
+// and the continuity counters of each output must be continuous
+
+#if defined(ENABLE_HLS) || defined(ENABLE_RTPPROXY)
+
+#define TEST_CHECK(exp) \
+    if (!(exp)) { \
+        ErrorL << "check failed: " << #exp; \
+        return false; \
+    }
+
+class TsCollector : public MpegMuxer {
+public:
+    string bytes;
+
+protected:
+    void onWrite(std::shared_ptr<Buffer> buffer, uint64_t timestamp, bool key_pos) override {
+        if (buffer) {
+            bytes.append(buffer->data(), buffer->size());
+        }
+    }
+};
+
+struct TsParsed {
+    uint16_t pmt_pid = 0;
+    set<string> pat;
+    set<string> pmt;
+    // 按pid归类的完整pes
+    // Complete pes grouped by pid
+    map<uint16_t, vector<string> > pes;
+    map<uint16_t, vector<uint64_t> > pcr;
+    // 带随机访问标记的pes序号
+    // Index of the pes that carries the random access indicator
+    map<uint16_t, vector<size_t> > random_access;
+};
+
+static bool parseTs(const string &data, TsParsed &out) {
+    TEST_CHECK(!data.empty() && data.size() % TsPacketizer::kPacketSize == 0);
+    map<uint16_t, uint8_t> last_cc;
+    bool psi_before_key = false;
+    for (size_t pos = 0; pos < data.size(); pos += TsPacketizer::kPacketSize) {
+        auto ts = (const uint8_t *)data.data() + pos;
+        TEST_CHECK(ts[0] == 0x47);
+        bool unit_start = ts[1] & 0x40;
+        uint16_t pid = ((ts[1] & 0x1F) << 8) | ts[2];
+        auto adaptation_control = (ts[3] >> 4) & 0x03;
+        uint8_t cc = ts[3] & 0x0F;
+        bool have_payload = adaptation_control & 0x01;
+
+        if (have_payload) {
+            auto it = last_cc.find(pid);
+            if (it != last_cc.end()) {
+                TEST_CHECK(cc == ((it->second + 1) & 0x0F));
+            }
+            last_cc[pid] = cc;
+        }
+
+        size_t offset = 4;
+        bool random_access = false;
+        if (adaptation_control & 0x02) {
+            size_t length = ts[4];
+            TEST_CHECK(offset + 1 + length <= TsPacketizer::kPacketSize);
+            if (length) {
+                auto flags = ts[5];
+                random_access = flags & 0x40;
+                if (flags & 0x10) {
+                    TEST_CHECK(length >= 7);
+                    uint64_t base = ((uint64_t)ts[6] << 25) | (ts[7] << 17) | (ts[8] << 9) | (ts[9] << 1) | (ts[10] >> 7);
+                    out.pcr[pid].emplace_back(base);
+                }
+            }
+            offset += 1 + length;
+        }
+        if (!have_payload || offset >= TsPacketizer::kPacketSize) {
+            continue;
+        }
+        auto payload = ts + offset;
+        auto payload_size = TsPacketizer::kPacketSize - offset;
+
+        if (pid == 0 || (out.pmt_pid && pid == out.pmt_pid)) {
+            // pat/pmt总是单包携带
+            // pat/pmt always fits in one packet
+            TEST_CHECK(unit_start && payload_size > 1 + payload[0] + 3);
+            auto section = payload + 1 + payload[0];
+            size_t section_size = 3 + (((section[1] & 0x0F) << 8) | section[2]);
+            TEST_CHECK(1 + payload[0] + section_size <= payload_size);
+            string str((const char *)section, section_size);
+            if (pid == 0) {
+                TEST_CHECK(section_size >= 16);
+                out.pmt_pid = ((section[10] & 0x1F) << 8) | section[11];
+                out.pat.emplace(str);
+            } else {
+                out.pmt.emplace(str);
+                psi_before_key = true;
+            }
+            continue;
+        }
+
+        auto &pes = out.pes[pid];
+        if (unit_start) {
+            TEST_CHECK(payload_size >= 4 && !memcmp(payload, "\x00\x00\x01", 3));
+            bool is_video = payload[3] >= 0xE0;
+            if (random_access) {
+                out.random_access[pid].emplace_back(pes.size());
+                if (is_video) {
+                    // 视频关键帧之前必须有pat/pmt
+                    // pat/pmt must come before a video key frame
+                    TEST_CHECK(psi_before_key);
+                }
+            }
+            if (is_video) {
+                psi_before_key = false;
+            }
+            pes.emplace_back();
+        }
+        TEST_CHECK(!pes.empty());
+        pes.back().append((const char *)payload, payload_size);
+    }
+    return true;
+}
+
+static string makeH264Frame(uint8_t nal, size_t size, mt19937 &rng) {
+    string ret("\x00\x00\x00\x01", 4);
+    ret.push_back(nal);
+    while (ret.size() < size) {
+        // 避开0x00，防止负载中出现起始码
+        // Avoid 0x00 so that no start code shows up in the payload
+        ret.push_back((char)(1 + rng() % 255));
+    }
+    return ret;
+}
+
+static string makeAACFrame(size_t size, mt19937 &rng) {
+    // adts头：aac-lc，44100Hz，双声道
+    // adts header: aac-lc, 44100Hz, stereo
+    size_t length = 7 + size;
+    string ret;
+    ret.push_back((char)0xFF);
+    ret.push_back((char)0xF1);
+    ret.push_back((char)0x50);
+    ret.push_back((char)(0x80 | ((length >> 11) & 0x03)));
+    ret.push_back((char)((length >> 3) & 0xFF));
+    ret.push_back((char)(((length & 0x07) << 5) | 0x1F));
+    ret.push_back((char)0xFC);
+    while (ret.size() < length) {
+        ret.push_back((char)(rng() % 256));
+    }
+    return ret;
+}
+
+static Frame::Ptr makeFrame(CodecId codec, int index, const string &data, uint64_t dts, uint64_t pts) {
+    auto frame = Factory::getFrameFromPtr(codec, data.data(), data.size(), dts, pts);
+    frame->setIndex(index);
+    return Frame::getCacheAbleFrame(frame);
+}
+
+/**
+ * @param with_audio 是否含aac音轨
+ * @param with_aud 视频帧是否自带aud
+ * @param with_audio Whether there is an aac track
+ * @param with_aud Whether the video frames carry an aud themselves
+ */
+static string mux(bool fast_ts_muxer, bool with_audio, bool with_aud) {
+    mINI::Instance()[General::kFastTsMuxer] = fast_ts_muxer;
+    // GET_CONFIG缓存了配置值，需广播重载才能生效
+    // GET_CONFIG caches the value, a reload broadcast is needed for it to take effect
+    NOTICE_EMIT(BroadcastReloadConfigArgs, Broadcast::kBroadcastReloadConfig);
+
+    TsCollector muxer;
+    auto video = Factory::getTrackByCodecId(CodecH264);
+    video->setIndex(0);
+    muxer.addTrack(video);
+    if (with_audio) {
+        auto audio = Factory::getTrackByCodecId(CodecAAC, 44100, 2, 16);
+        audio->setIndex(1);
+        muxer.addTrack(audio);
+    }
+    muxer.addTrackCompleted();
+
+    // 两次打包使用相同的随机序列
+    // Both runs use the same random sequence
+    mt19937 rng(20240610);
+    uint64_t audio_dts = 0;
+    for (size_t i = 0; i < 150; ++i) {
+        uint64_t dts = i * 40;
+        // 每3帧中两帧带b帧偏移，pts与dts不同
+        // Two out of every 3 frames have a b-frame offset, so pts differs from dts
+        uint64_t pts = dts + (i % 3 ? 80 : 40);
+        bool key = i % 50 == 0;
+        if (with_aud) {
+            muxer.inputFrame(makeFrame(CodecH264, 0, string("\x00\x00\x00\x01\x09\xF0", 6), dts, pts));
+        }
+        if (key) {
+            muxer.inputFrame(makeFrame(CodecH264, 0, makeH264Frame(0x67, 16, rng), dts, pts));
+            muxer.inputFrame(makeFrame(CodecH264, 0, makeH264Frame(0x68, 8, rng), dts, pts));
+        }
+        // 关键帧跨越多个ts包，p帧大小随机，覆盖末包填充的各种长度
+        // Key frames span many ts packets, p frame sizes are random to cover all padding lengths of the last packet
+        muxer.inputFrame(makeFrame(CodecH264, 0, makeH264Frame(key ? 0x65 : 0x41, key ? 20000 : 100 + rng() % 3000, rng), dts, pts));
+        while (with_audio && audio_dts <= dts) {
+            muxer.inputFrame(makeFrame(CodecAAC, 1, makeAACFrame(100 + rng() % 600, rng), audio_dts, audio_dts));
+            audio_dts += 23;
+        }
+    }
+    muxer.flush();
+    return std::move(muxer.bytes);
+}
+
+static bool compare(bool with_audio, bool with_aud) {
+    TsParsed expect, actual;
+    TEST_CHECK(parseTs(mux(false, with_audio, with_aud), expect));
+    TEST_CHECK(parseTs(mux(true, with_audio, with_aud), actual));
+    TEST_CHECK(expect.pmt_pid == actual.pmt_pid);
+    TEST_CHECK(expect.pat == actual.pat);
+    TEST_CHECK(expect.pmt == actual.pmt);
+    TEST_CHECK(expect.pes.size() == actual.pes.size());
+    for (auto &pr : expect.pes) {
+        auto &other = actual.pes[pr.first];
+        TEST_CHECK(pr.second.size() == other.size());
+        for (size_t i = 0; i < pr.second.size(); ++i) {
+            if (pr.second[i] != other[i]) {
+                ErrorL << "pes mismatch, pid: " << pr.first << ", index: " << i << "\n"
+                       << hexdump(pr.second[i].data(), MIN(pr.second[i].size(), (size_t)32))
+                       << hexdump(other[i].data(), MIN(other[i].size(), (size_t)32));
+                return false;
+            }
+        }
+    }
+    TEST_CHECK(expect.pcr == actual.pcr);
+    TEST_CHECK(expect.random_access == actual.random_access);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    Logger::Instance().add(std::make_shared<ConsoleChannel>());
+    Logger::Instance().setLevel(LInfo);
+
+    bool ok = true;
+    for (auto with_audio : { false, true }) {
+        for (auto with_aud : { false, true }) {
+            auto passed = compare(with_audio, with_aud);
+            InfoL << "audio: " << with_audio << ", aud: " << with_aud << (passed ? ", passed" : ", failed");
+            ok = ok && passed;
+        }
+    }
+    return ok ? 0 : -1;
+}
+
+#else
+
+int main(int argc, char *argv[]) {
+    cout << "ENABLE_HLS and ENABLE_RTPPROXY disabled" << endl;
+    return 0;
+}
+
+#endif
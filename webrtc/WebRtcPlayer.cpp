@@ -11,6 +11,7 @@
 #include "WebRtcPlayer.h"
 
 #include "Common/config.h"
+#include "Common/PollerMonitor.h"
 #include "Extension/Factory.h"
 #include "Util/base64.h"
 
@@ -50,6 +51,7 @@ void WebRtcPlayer::onStartWebRTC() {
     if (canSendRtp()) {
         playSrc->pause(false);
         _reader = playSrc->getRing()->attach(getPoller(), true);
+        _egress_tracer = EgressTracer(playSrc->getMetrics(), StreamMetrics::kLatencyWebRtc);
         weak_ptr<WebRtcPlayer> weak_self = static_pointer_cast<WebRtcPlayer>(shared_from_this());
         weak_ptr<Session> weak_session = static_pointer_cast<Session>(getSession());
         _reader->setGetInfoCB([weak_session]() {
@@ -62,6 +64,7 @@ void WebRtcPlayer::onStartWebRTC() {
             if (!strong_self) {
                 return;
             }
+            PollerMonitor::TaskTracer tracer(PollerMonitor::kOriginSend, strong_self->_media_info);
 
             if (strong_self->_send_config_frames_once && !pkt->empty()) {
                 const auto &first_rtp = pkt->front();
@@ -70,11 +73,15 @@ void WebRtcPlayer::onStartWebRTC() {
             }
 
             size_t i = 0;
+            uint64_t ingest_stamp = 0;
             pkt->for_each([&](const RtpPacket::Ptr &rtp) {
                 //TraceL<<"send track type:"<<rtp->type<<" ts:"<<rtp->getStamp()<<" ntp:"<<rtp->ntp_stamp<<" size:"<<rtp->getPayloadSize()<<" i:"<<i;
                 strong_self->onSendRtp(rtp, ++i == pkt->size());
+                ingest_stamp = ingest_stamp ? ingest_stamp : rtp->ingest_stamp;
             });
+            strong_self->_egress_tracer.trace(ingest_stamp);
         });
+        _egress_tracer.setLive();
         _reader->setDetachCB([weak_self]() {
             auto strong_self = weak_self.lock();
             if (!strong_self) {
@@ -128,6 +135,14 @@ void WebRtcPlayer::onRtcConfigure(RtcConfigure &configure) const {
     configure.setPlayRtspInfo(playSrc->getSdp());
 }
 
+void WebRtcPlayer::onNack() {
+    // 播放器请求重传，统计到被播放的流
+    // The player requests retransmission, count it to the played stream
+    if (auto play_src = _play_src.lock()) {
+        play_src->getMetrics()->add(StreamMetrics::kNacks);
+    }
+}
+
 void WebRtcPlayer::sendConfigFrames(uint32_t before_seq, uint32_t sample_rate, uint32_t timestamp, uint64_t ntp_timestamp) {
     auto play_src = _play_src.lock();
     if (!play_src) {
@@ -27,6 +27,7 @@ protected:
     void onStartWebRTC() override;
     void onDestory() override;
     void onRtcConfigure(RtcConfigure &configure) const override;
+    void onNack() override;
 
 private:
     WebRtcPlayer(const EventPoller::Ptr &poller, const RtspMediaSource::Ptr &src, const MediaInfo &info);
@@ -48,6 +49,9 @@ private:
     // 播放rtsp源的reader对象  [AUTO-TRANSLATED:7b305055]
     // Reader object for playing rtsp source
     RtspMediaSource::RingType::RingReader::Ptr _reader;
+    // 出口时延采样
+    // Egress latency sampling
+    EgressTracer _egress_tracer;
 };
 
 }// namespace mediakit
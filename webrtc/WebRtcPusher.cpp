@@ -114,6 +114,14 @@ void WebRtcPusher::onRecvRtp(MediaTrack &track, const string &rid, RtpPacket::Pt
     }
 }
 
+void WebRtcPusher::onNack() {
+    // 向推流端请求重传，统计到推流生成的流
+    // Request retransmission from the pusher, count it to the pushed stream
+    if (_push_src) {
+        _push_src->getMetrics()->add(StreamMetrics::kNacks);
+    }
+}
+
 void WebRtcPusher::onStartWebRTC() {
     WebRtcTransportImp::onStartWebRTC();
     _simulcast = _answer_sdp->supportSimulcast();
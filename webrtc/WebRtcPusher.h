@@ -28,6 +28,7 @@ protected:
     void onDestory() override;
     void onRtcConfigure(RtcConfigure &configure) const override;
     void onRecvRtp(MediaTrack &track, const std::string &rid, RtpPacket::Ptr rtp) override;
+    void onNack() override;
     void onShutdown(const SockException &ex) override;
     void onRtcpBye() override;
     // //  dtls相关的回调 ////  [AUTO-TRANSLATED:31a1f32c]
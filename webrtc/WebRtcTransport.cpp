@@ -13,6 +13,7 @@
 #include "Util/base64.h"
 #include "Network/sockutil.h"
 #include "Common/config.h"
+#include "Common/AllocProfiler.h"
 #include "Nack.h"
 #include "RtpExt.h"
 #include "Rtcp/Rtcp.h"
@@ -351,6 +352,7 @@ void WebRtcTransport::sendDatachannel(uint16_t streamId, uint32_t ppid, const ch
 void WebRtcTransport::sendSockData(const char *buf, size_t len, RTC::TransportTuple *tuple) {
     auto pkt = _packet_pool.obtain2();
     pkt->assign(buf, len);
+    AllocProfiler::record(AllocProfiler::kWebRtc, len);
     onSendSockData(std::move(pkt), true, tuple ? tuple : _ice_server->GetSelectedTuple());
 }
 
@@ -495,6 +497,7 @@ void WebRtcTransport::sendRtpPacket(const char *buf, int len, bool flush, void *
         // 预留rtx加入的两个字节  [AUTO-TRANSLATED:d1eb5cd7]
         // Reserve two bytes for rtx joining
         pkt->setCapacity((size_t)len + SRTP_MAX_TRAILER_LEN + 2);
+        AllocProfiler::record(AllocProfiler::kWebRtc, pkt->getCapacity());
         memcpy(pkt->data(), buf, len);
         onBeforeEncryptRtp(pkt->data(), len, ctx);
         if (_srtp_session_send->EncryptRtp(reinterpret_cast<uint8_t *>(pkt->data()), &len)) {
@@ -510,6 +513,7 @@ void WebRtcTransport::sendRtcpPacket(const char *buf, int len, bool flush, void
         // 预留rtx加入的两个字节  [AUTO-TRANSLATED:d1eb5cd7]
         // Reserve two bytes for rtx joining
         pkt->setCapacity((size_t)len + SRTP_MAX_TRAILER_LEN + 2);
+        AllocProfiler::record(AllocProfiler::kWebRtc, pkt->getCapacity());
         memcpy(pkt->data(), buf, len);
         onBeforeEncryptRtcp(pkt->data(), len, ctx);
         if (_srtp_session_send->EncryptRtcp(reinterpret_cast<uint8_t *>(pkt->data()), &len)) {
@@ -1008,6 +1012,7 @@ void WebRtcTransportImp::onRtcp(const char *buf, size_t len) {
                 }
                 auto &track = it->second;
                 auto &fci = fb->getFci<FCI_NACK>();
+                onNack();
                 track->nack_list.forEach(fci, [&](const RtpPacket::Ptr &rtp) {
                     // rtp重传  [AUTO-TRANSLATED:62a37e46]
                     // rtp retransmission
@@ -1156,6 +1161,7 @@ void WebRtcTransportImp::onSendNack(MediaTrack &track, const FCI_NACK &nack, uin
     rtcp->ssrc = htonl(track.answer_ssrc_rtp);
     rtcp->ssrc_media = htonl(ssrc);
     sendRtcpPacket((char *)rtcp.get(), rtcp->getSize(), true);
+    onNack();
 }
 
 void WebRtcTransportImp::onSendTwcc(uint32_t ssrc, const string &twcc_fci) {
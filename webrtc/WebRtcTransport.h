@@ -304,6 +304,9 @@ protected:
     void onDestory() override;
     void onShutdown(const SockException &ex) override;
     virtual void onRecvRtp(MediaTrack &track, const std::string &rid, RtpPacket::Ptr rtp) {}
+    // 收到或发送rtcp nack，用于统计
+    // Receive or send rtcp nack, used for statistics
+    virtual void onNack() {}
     void updateTicker();
     float getLossRate(TrackType type);
     void onRtcpBye() override;